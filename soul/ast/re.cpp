@@ -860,11 +860,180 @@ void Dfa::Print(LexerContext& lexerContext, CodeFormatter& formatter)
     formatter.WriteLine();
 }
 
+void Dfa::MakeTable(LexerContext& lexerContext, std::vector<int32_t>& transitions, std::vector<int32_t>& ruleIndeces) const
+{
+    int stateCount = 0;
+    for (DfaState* state : states)
+    {
+        stateCount = std::max(stateCount, state->Id() + 1);
+    }
+    int classCount = lexerContext.Partition().size();
+    transitions.assign(static_cast<std::size_t>(stateCount) * classCount, -1);
+    ruleIndeces.assign(stateCount, -1);
+    for (DfaState* state : states)
+    {
+        for (int i = 0; i < classCount; ++i)
+        {
+            DfaState* next = state->Next(i);
+            if (next)
+            {
+                transitions[static_cast<std::size_t>(state->Id()) * classCount + i] = next->Id();
+            }
+        }
+        if (state->Accept())
+        {
+            ruleIndeces[state->Id()] = state->RuleIndex();
+        }
+    }
+}
+
+void Dfa::WriteTable(LexerContext& lexerContext, CodeFormatter& formatter) const
+{
+    std::vector<int32_t> transitions;
+    std::vector<int32_t> ruleIndeces;
+    MakeTable(lexerContext, transitions, ruleIndeces);
+    int stateCount = ruleIndeces.size();
+    int classCount = lexerContext.Partition().size();
+    formatter.WriteLine("static const soul::lexer::DfaTable& Table()");
+    formatter.WriteLine("{");
+    formatter.IncIndent();
+    formatter.WriteLine("static const int32_t transitions[] = {");
+    formatter.IncIndent();
+    for (int s = 0; s < stateCount; ++s)
+    {
+        std::string row;
+        for (int i = 0; i < classCount; ++i)
+        {
+            row.append(std::to_string(transitions[static_cast<std::size_t>(s) * classCount + i])).append(", ");
+        }
+        row.append("// " + std::to_string(s));
+        formatter.WriteLine(row);
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("};");
+    std::string rules;
+    for (int s = 0; s < stateCount; ++s)
+    {
+        if (s > 0)
+        {
+            rules.append(", ");
+        }
+        rules.append(std::to_string(ruleIndeces[s]));
+    }
+    formatter.WriteLine("static const int32_t ruleIndeces[] = { " + rules + " };");
+    formatter.WriteLine("static const soul::lexer::DfaTable table(" + std::to_string(stateCount) + ", " + std::to_string(classCount) + ", transitions, ruleIndeces);");
+    formatter.WriteLine("return table;");
+    formatter.DecIndent();
+    formatter.WriteLine("}");
+}
+
+std::vector<int32_t> MakeClassMapData(LexerContext& lexerContext)
+{
+    int32_t upperBound = 0;
+    for (Class* cls : lexerContext.Partition())
+    {
+        for (const Range& range : cls->Ranges())
+        {
+            upperBound = std::max(upperBound, static_cast<int32_t>(range.End()) + 1);
+        }
+    }
+    std::vector<int32_t> data(upperBound, -1);
+    for (Class* cls : lexerContext.Partition())
+    {
+        for (const Range& range : cls->Ranges())
+        {
+            std::fill(data.begin() + range.Start(), data.begin() + range.End() + 1, cls->Index());
+        }
+    }
+    return data;
+}
+
+void WriteClassMap(LexerContext& lexerContext, const std::string& functionName, CodeFormatter& formatter)
+{
+    const int32_t pageShift = 8; // soul::lexer::classMapPageShift
+    const int32_t pageSize = 1 << pageShift;
+    std::vector<int32_t> data = MakeClassMapData(lexerContext);
+    int32_t upperBound = static_cast<int32_t>(data.size());
+    int32_t pageCount = std::max(1, (upperBound + pageSize - 1) / pageSize);
+    data.resize(static_cast<std::size_t>(pageCount) * pageSize, -1);
+    std::map<std::vector<int32_t>, int32_t> pageMap;
+    std::vector<int32_t> pageOffsets;
+    std::vector<std::vector<int32_t>> pages;
+    for (int32_t p = 0; p < pageCount; ++p)
+    {
+        std::vector<int32_t> page(data.begin() + static_cast<std::size_t>(p) * pageSize, data.begin() + static_cast<std::size_t>(p + 1) * pageSize);
+        auto it = pageMap.find(page);
+        if (it != pageMap.end())
+        {
+            pageOffsets.push_back(it->second);
+        }
+        else
+        {
+            int32_t offset = static_cast<int32_t>(pages.size()) * pageSize;
+            pageMap[page] = offset;
+            pageOffsets.push_back(offset);
+            pages.push_back(std::move(page));
+        }
+    }
+    formatter.WriteLine("template<typename Char>");
+    formatter.WriteLine("soul::lexer::ClassMap<Char>* " + functionName + "()");
+    formatter.WriteLine("{");
+    formatter.IncIndent();
+    formatter.WriteLine("static constexpr int32_t pageOffsets[] = {");
+    formatter.IncIndent();
+    for (int32_t p = 0; p < pageCount; p += 16)
+    {
+        std::string line;
+        for (int32_t i = p; i < std::min(p + 16, pageCount); ++i)
+        {
+            line.append(std::to_string(pageOffsets[i])).append(",");
+            if (i + 1 < std::min(p + 16, pageCount))
+            {
+                line.append(" ");
+            }
+        }
+        formatter.WriteLine(line);
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("};");
+    formatter.WriteLine("static constexpr int32_t entries[] = {");
+    formatter.IncIndent();
+    for (int32_t p = 0; p < static_cast<int32_t>(pages.size()); ++p)
+    {
+        const std::vector<int32_t>& page = pages[p];
+        for (int32_t i = 0; i < pageSize; i += 32)
+        {
+            std::string line;
+            for (int32_t j = i; j < i + 32; ++j)
+            {
+                line.append(std::to_string(page[j])).append(",");
+                if (j + 1 < i + 32)
+                {
+                    line.append(" ");
+                }
+            }
+            if (i == 0)
+            {
+                line.append(" // " + std::to_string(p * pageSize));
+            }
+            formatter.WriteLine(line);
+        }
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("};");
+    formatter.WriteLine("static soul::lexer::ClassMap<Char> classMap(pageOffsets, entries, " + std::to_string(upperBound) + ");");
+    formatter.WriteLine("return &classMap;");
+    formatter.DecIndent();
+    formatter.WriteLine("}");
+}
+
 std::vector<int> EpsilonClosure(LexerContext& lexerContext, const std::vector<int>& stateIds)
 {
+    std::vector<bool>& member = lexerContext.NfaStateMarks();
     std::vector<int> stack;
     for (int state : stateIds)
     {
+        member[state] = true;
         stack.push_back(state);
     }
     std::vector<int> epsilonClosure = stateIds;
@@ -873,17 +1042,24 @@ std::vector<int> EpsilonClosure(LexerContext& lexerContext, const std::vector<in
         int s = stack.back();
         stack.pop_back();
         NfaState* state = lexerContext.GetNfaState(s);
-        std::vector<NfaState*> u = state->Next(eps);
-        for (NfaState* vs : u)
+        for (const auto& edge : state->Edges())
         {
-            int v = vs->Id();
-            if (std::find(epsilonClosure.cbegin(), epsilonClosure.cend(), v) == epsilonClosure.cend())
+            if (edge.GetSymbol()->Match(eps))
             {
-                epsilonClosure.push_back(v);
-                stack.push_back(v);
+                int v = edge.Next()->Id();
+                if (!member[v])
+                {
+                    member[v] = true;
+                    epsilonClosure.push_back(v);
+                    stack.push_back(v);
+                }
             }
         }
     }
+    for (int s : epsilonClosure)
+    {
+        member[s] = false;
+    }
     return epsilonClosure;
 }
 
@@ -895,25 +1071,249 @@ std::vector<int> EpsilonClosure(LexerContext& lexerContext, int stateId)
 
 std::vector<int> Move(LexerContext& lexerContext, const std::vector<int>& stateIds, char32_t c)
 {
+    std::vector<bool>& member = lexerContext.NfaStateMarks();
     std::vector<int> next;
     for (int stateId : stateIds)
     {
         NfaState* state = lexerContext.GetNfaState(stateId);
-        std::vector<NfaState*> n = state->Next(c);
-        for (NfaState* sn : n)
+        for (const auto& edge : state->Edges())
         {
-            int s = sn->Id();
-            if (std::find(next.cbegin(), next.cend(), s) == next.cend())
+            if (edge.GetSymbol()->Match(c))
             {
-                next.push_back(s);
+                int s = edge.Next()->Id();
+                if (!member[s])
+                {
+                    member[s] = true;
+                    next.push_back(s);
+                }
             }
         }
     }
+    for (int s : next)
+    {
+        member[s] = false;
+    }
     return next;
 }
 
+Dfa Minimize(LexerContext& lexerContext, const Dfa& dfa)
+{
+    const std::vector<DfaState*>& states = dfa.States();
+    int n = states.size();
+    if (n == 0)
+    {
+        return Dfa();
+    }
+    std::unordered_map<DfaState*, int> stateIndex;
+    for (int i = 0; i < n; ++i)
+    {
+        stateIndex[states[i]] = i;
+    }
+    int classCount = 0;
+    for (Class* cls : lexerContext.Partition())
+    {
+        if (!cls->Chars().empty())
+        {
+            ++classCount;
+        }
+    }
+    int sink = n;
+    int stateCount = n + 1;
+    std::size_t transitionCount = static_cast<std::size_t>(stateCount) * classCount;
+    std::vector<int> next(transitionCount, sink);
+    std::vector<int> prevStart(transitionCount + 1, 0);
+    for (int s = 0; s < n; ++s)
+    {
+        for (int c = 0; c < classCount; ++c)
+        {
+            DfaState* nextState = states[s]->Next(c);
+            if (nextState)
+            {
+                next[static_cast<std::size_t>(s) * classCount + c] = stateIndex[nextState];
+            }
+        }
+    }
+    for (std::size_t i = 0; i < transitionCount; ++i)
+    {
+        int c = static_cast<int>(i % classCount);
+        ++prevStart[static_cast<std::size_t>(c) * stateCount + next[i] + 1];
+    }
+    for (std::size_t i = 0; i < transitionCount; ++i)
+    {
+        prevStart[i + 1] += prevStart[i];
+    }
+    std::vector<int> prev(transitionCount);
+    std::vector<int> prevFill(prevStart.begin(), prevStart.end() - 1);
+    for (std::size_t i = 0; i < transitionCount; ++i)
+    {
+        int s = static_cast<int>(i / classCount);
+        int c = static_cast<int>(i % classCount);
+        prev[prevFill[static_cast<std::size_t>(c) * stateCount + next[i]]++] = s;
+    }
+    std::vector<int> blockOf(stateCount);
+    std::vector<std::vector<int>> blocks;
+    std::map<int, int> ruleBlocks;
+    for (int s = 0; s < stateCount; ++s)
+    {
+        int key = -2;
+        if (s != sink && states[s]->Accept())
+        {
+            key = states[s]->RuleIndex();
+        }
+        auto it = ruleBlocks.find(key);
+        if (it == ruleBlocks.end())
+        {
+            it = ruleBlocks.insert(std::make_pair(key, static_cast<int>(blocks.size()))).first;
+            blocks.push_back(std::vector<int>());
+        }
+        blockOf[s] = it->second;
+        blocks[it->second].push_back(s);
+    }
+    std::vector<bool> inWorkList(static_cast<std::size_t>(stateCount) * classCount);
+    std::vector<std::pair<int, int>> workList;
+    for (int b = 0; b < blocks.size(); ++b)
+    {
+        for (int c = 0; c < classCount; ++c)
+        {
+            inWorkList[static_cast<std::size_t>(b) * classCount + c] = true;
+            workList.push_back(std::make_pair(b, c));
+        }
+    }
+    std::vector<bool> marked(stateCount);
+    std::vector<int> markedStates;
+    std::vector<int> markedCount(stateCount);
+    std::vector<int> touchedBlocks;
+    while (!workList.empty())
+    {
+        std::pair<int, int> splitter = workList.back();
+        workList.pop_back();
+        int a = splitter.first;
+        int c = splitter.second;
+        inWorkList[static_cast<std::size_t>(a) * classCount + c] = false;
+        for (int t : blocks[a])
+        {
+            std::size_t key = static_cast<std::size_t>(c) * stateCount + t;
+            for (int i = prevStart[key]; i < prevStart[key + 1]; ++i)
+            {
+                int s = prev[i];
+                if (!marked[s])
+                {
+                    marked[s] = true;
+                    markedStates.push_back(s);
+                    int b = blockOf[s];
+                    if (markedCount[b]++ == 0)
+                    {
+                        touchedBlocks.push_back(b);
+                    }
+                }
+            }
+        }
+        for (int b : touchedBlocks)
+        {
+            if (markedCount[b] < blocks[b].size())
+            {
+                int z = blocks.size();
+                std::vector<int> kept;
+                std::vector<int> split;
+                for (int s : blocks[b])
+                {
+                    if (marked[s])
+                    {
+                        split.push_back(s);
+                        blockOf[s] = z;
+                    }
+                    else
+                    {
+                        kept.push_back(s);
+                    }
+                }
+                blocks[b] = std::move(kept);
+                blocks.push_back(std::move(split));
+                for (int d = 0; d < classCount; ++d)
+                {
+                    int add = z;
+                    if (!inWorkList[static_cast<std::size_t>(b) * classCount + d] && blocks[b].size() < blocks[z].size())
+                    {
+                        add = b;
+                    }
+                    inWorkList[static_cast<std::size_t>(add) * classCount + d] = true;
+                    workList.push_back(std::make_pair(add, d));
+                }
+            }
+            markedCount[b] = 0;
+        }
+        touchedBlocks.clear();
+        for (int s : markedStates)
+        {
+            marked[s] = false;
+        }
+        markedStates.clear();
+    }
+    int sinkBlock = blockOf[sink];
+    std::vector<DfaState*> blockStates(blocks.size(), nullptr);
+    std::vector<int> order;
+    int startBlock = blockOf[0];
+    int nextId = 0;
+    blockStates[startBlock] = lexerContext.MakeMinimizedDfaState(nextId++, std::vector<int>());
+    order.push_back(startBlock);
+    for (int i = 0; i < order.size(); ++i)
+    {
+        int b = order[i];
+        int rep = blocks[b].front();
+        for (int c = 0; c < classCount; ++c)
+        {
+            int t = blockOf[next[static_cast<std::size_t>(rep) * classCount + c]];
+            if (t != sinkBlock && !blockStates[t])
+            {
+                blockStates[t] = lexerContext.MakeMinimizedDfaState(nextId++, std::vector<int>());
+                order.push_back(t);
+            }
+        }
+    }
+    Dfa minimizedDfa;
+    for (int b : order)
+    {
+        DfaState* state = blockStates[b];
+        int rep = blocks[b].front();
+        std::vector<int> nfaStateIds;
+        for (int s : blocks[b])
+        {
+            if (s != sink)
+            {
+                const std::vector<int>& ids = states[s]->NfaStateIds();
+                nfaStateIds.insert(nfaStateIds.end(), ids.begin(), ids.end());
+            }
+        }
+        std::sort(nfaStateIds.begin(), nfaStateIds.end());
+        nfaStateIds.erase(std::unique(nfaStateIds.begin(), nfaStateIds.end()), nfaStateIds.end());
+        state->SetNfaStateIds(nfaStateIds);
+        if (rep != sink && states[rep]->Accept())
+        {
+            state->SetAccept(true);
+            state->SetRuleIndex(states[rep]->RuleIndex());
+        }
+        for (int c = 0; c < classCount; ++c)
+        {
+            int t = blockOf[next[static_cast<std::size_t>(rep) * classCount + c]];
+            if (t == sinkBlock)
+            {
+                state->AddNext(nullptr);
+            }
+            else
+            {
+                state->AddNext(blockStates[t]);
+            }
+        }
+        state->Mark();
+        minimizedDfa.AddState(state);
+    }
+    return minimizedDfa;
+}
+
 Dfa Compile(LexerContext& lexerContext, Nfa& nfa)
 {
+    DfaStats& stats = lexerContext.Stats();
+    auto phaseStart = std::chrono::steady_clock::now();
     Dfa dfa;
     std::vector<int> start = EpsilonClosure(lexerContext, nfa.Start()->Id());
     DfaState* s = lexerContext.MakeDfaState(start);
@@ -948,8 +1348,46 @@ Dfa Compile(LexerContext& lexerContext, Nfa& nfa)
             }
         }
     }
+    auto phaseEnd = std::chrono::steady_clock::now();
+    stats.subsetConstructionTime = std::chrono::duration_cast<std::chrono::nanoseconds>(phaseEnd - phaseStart);
+    phaseStart = phaseEnd;
     dfa.Finalize(lexerContext);
-    return dfa;
+    phaseEnd = std::chrono::steady_clock::now();
+    stats.finalizeTime = std::chrono::duration_cast<std::chrono::nanoseconds>(phaseEnd - phaseStart);
+    phaseStart = phaseEnd;
+    Dfa minimizedDfa = Minimize(lexerContext, dfa);
+    phaseEnd = std::chrono::steady_clock::now();
+    stats.minimizationTime = std::chrono::duration_cast<std::chrono::nanoseconds>(phaseEnd - phaseStart);
+    stats.nfaStateCount = lexerContext.NfaStates().size();
+    stats.dfaStateCount = dfa.States().size();
+    stats.minimizedDfaStateCount = minimizedDfa.States().size();
+    return minimizedDfa;
+}
+
+DfaStats::DfaStats() : 
+    nfaStateCount(0), dfaStateCount(0), minimizedDfaStateCount(0), subsetConstructionTime(0), finalizeTime(0), minimizationTime(0)
+{
+}
+
+void DfaStats::Print(CodeFormatter& formatter) const
+{
+    formatter.WriteLine("NFA states: " + std::to_string(nfaStateCount));
+    formatter.WriteLine("DFA states: " + std::to_string(dfaStateCount));
+    formatter.WriteLine("minimized DFA states: " + std::to_string(minimizedDfaStateCount));
+    formatter.WriteLine("subset construction: " + util::DurationStr(subsetConstructionTime));
+    formatter.WriteLine("finalize: " + util::DurationStr(finalizeTime));
+    formatter.WriteLine("minimization: " + util::DurationStr(minimizationTime));
+}
+
+std::size_t NfaStateIdsHash::operator()(const std::vector<int>& nfaStateIds) const
+{
+    std::size_t h = 14695981039346656037ull;
+    for (int id : nfaStateIds)
+    {
+        h ^= static_cast<std::size_t>(id);
+        h *= 1099511628211ull;
+    }
+    return h;
 }
 
 ExprParser::~ExprParser()
@@ -1819,16 +2257,14 @@ NfaState* LexerContext::MakeNfaState()
 {
     NfaState* state = new NfaState(nextNfaStateId++, ruleIndex);
     nfaStates.push_back(state);
-    nfaStateMap[state->Id()] = state;
     return state;
 }
 
 NfaState* LexerContext::GetNfaState(int id) const
 {
-    auto it = nfaStateMap.find(id);
-    if (it != nfaStateMap.cend())
+    if (id >= 0 && id < nfaStates.size())
     {
-        return it->second;
+        return nfaStates[id];
     }
     else
     {
@@ -1840,15 +2276,30 @@ DfaState* LexerContext::MakeDfaState(const std::vector<int>& nfaStates)
 {
     std::vector<int> s(nfaStates);
     std::sort(s.begin(), s.end());
-    for (DfaState* state : dfaStates)
+    auto it = dfaStateMap.find(s);
+    if (it != dfaStateMap.end())
     {
-        if (state->NfaStateIds() == s)
-        {
-            return state;
-        }
+        return it->second;
     }
     DfaState* state = new DfaState(nextDfaStateId++, s);
     dfaStates.push_back(state);
+    dfaStateMap[s] = state;
+    return state;
+}
+
+std::vector<bool>& LexerContext::NfaStateMarks()
+{
+    if (nfaStateMarks.size() < nfaStates.size())
+    {
+        nfaStateMarks.resize(nfaStates.size());
+    }
+    return nfaStateMarks;
+}
+
+DfaState* LexerContext::MakeMinimizedDfaState(int id, const std::vector<int>& nfaStates)
+{
+    DfaState* state = new DfaState(id, nfaStates);
+    dfaStates.push_back(state);
     return state;
 }
 
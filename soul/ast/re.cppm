@@ -210,6 +210,7 @@ public:
     int RuleIndex() const { return ruleIndex; }
     void SetRuleIndex(int index) { ruleIndex = index; }
     const std::vector<int>& NfaStateIds() const { return nfaStateIds; }
+    void SetNfaStateIds(const std::vector<int>& nfaStateIds_) { nfaStateIds = nfaStateIds_; }
     void AddNext(DfaState* next);
     DfaState* Next(int i) const;
     void Print(LexerContext& context, CodeFormatter& formatter);
@@ -229,6 +230,8 @@ public:
     const std::vector<DfaState*>& States() const { return states; }
     void Finalize(LexerContext& lexerContext);
     void Print(LexerContext& lexerContext, CodeFormatter& formatter);
+    void MakeTable(LexerContext& lexerContext, std::vector<int32_t>& transitions, std::vector<int32_t>& ruleIndeces) const;
+    void WriteTable(LexerContext& lexerContext, CodeFormatter& formatter) const;
 private:
     std::vector<DfaState*> states;
 };
@@ -236,8 +239,49 @@ private:
 std::vector<int> EpsilonClosure(LexerContext& lexerContext, const std::vector<int>& stateIds);
 std::vector<int> EpsilonClosure(LexerContext& lexerContext, int nfaStateId);
 std::vector<int> Move(LexerContext& lexerContext, const std::vector<int>& stateIds, char32_t c);
+
+//  ===================================================================================================
+//  Minimize merges equivalent states of a finalized DFA using Hopcroft's partition refinement.
+//  The initial partition separates the states by the rule they accept, so the minimized DFA
+//  recognizes the same tokens. Dead states are removed and the start state gets id 0.
+//  ===================================================================================================
+
+Dfa Minimize(LexerContext& lexerContext, const Dfa& dfa);
+
+//  ===================================================================================================
+//  Compile builds a DFA from an NFA by subset construction and minimizes it.
+//  The state counts and the time spent in each phase are recorded to the stats of the lexer context.
+//  ===================================================================================================
+
 Dfa Compile(LexerContext& lexerContext, Nfa& nfa);
 
+//  ===================================================================================================
+//  MakeClassMapData returns the class index of each character below the upper bound of the partition,
+//  -1 for characters that belong to no class. WriteClassMap writes the class map as constexpr two-level
+//  tables and a function returning a soul::lexer::ClassMap over them, so that the lexer does not need
+//  to inflate a class map resource at startup. Equal pages are written once.
+//  ===================================================================================================
+
+std::vector<int32_t> MakeClassMapData(LexerContext& lexerContext);
+void WriteClassMap(LexerContext& lexerContext, const std::string& functionName, CodeFormatter& formatter);
+
+struct DfaStats
+{
+    DfaStats();
+    void Print(CodeFormatter& formatter) const;
+    int nfaStateCount;
+    int dfaStateCount;
+    int minimizedDfaStateCount;
+    std::chrono::nanoseconds subsetConstructionTime;
+    std::chrono::nanoseconds finalizeTime;
+    std::chrono::nanoseconds minimizationTime;
+};
+
+struct NfaStateIdsHash
+{
+    std::size_t operator()(const std::vector<int>& nfaStateIds) const;
+};
+
 class ExprParser
 {
 public:
@@ -255,7 +299,9 @@ public:
     NfaState* MakeNfaState();
     NfaState* GetNfaState(int id) const;
     const std::vector<NfaState*>& NfaStates() const { return nfaStates; }
+    std::vector<bool>& NfaStateMarks();
     DfaState* MakeDfaState(const std::vector<int>& nfaStates);
+    DfaState* MakeMinimizedDfaState(int id, const std::vector<int>& nfaStates);
     Symbol* MakeChar(char32_t c);
     Symbol* MakeAny() { return &any; }
     Symbol* MakeEpsilon() { return &epsilon; }
@@ -289,6 +335,8 @@ public:
     void SetMasterNfaIndex(int masterNfaIndex_) { masterNfaIndex = masterNfaIndex_; }
     void SetDfa(Dfa&& dfa_);
     const Dfa& GetDfa() const { return dfa; }
+    const DfaStats& Stats() const { return stats; }
+    DfaStats& Stats() { return stats; }
 private:
     std::string fileName;
     int nextNfaStateId;
@@ -296,8 +344,9 @@ private:
     int ruleIndex;
     int classIndex;
     std::vector<NfaState*> nfaStates;
-    std::map<int, NfaState*> nfaStateMap;
+    std::vector<bool> nfaStateMarks;
     std::vector<DfaState*> dfaStates;
+    std::unordered_map<std::vector<int>, DfaState*, NfaStateIdsHash> dfaStateMap;
     std::vector<Symbol*> symbols;
     std::vector<Class*> canonicalClasses;
     std::vector<Class*> partition;
@@ -319,6 +368,7 @@ private:
     std::map<int, Nfa*> nfaMap;
     int masterNfaIndex;
     Dfa dfa;
+    DfaStats stats;
 };
 
 class Visitor
@@ -166,7 +166,7 @@ Action* Actions::GetAction(int id) const
     }
 }
 
-Lexer::Lexer(const std::string& name_) : Collection(CollectionKind::lexer, name_)
+Lexer::Lexer(const std::string& name_) : Collection(CollectionKind::lexer, name_), tableDriven(false)
 {
 }
 
@@ -245,11 +245,14 @@ public:
     const Actions& GetActions() const { return actions; }
     const std::string& VariableClassName() const { return variableClassName; }
     void SetVariableClassName(const std::string& variableClassName_);
+    bool TableDriven() const { return tableDriven; }
+    void SetTableDriven() { tableDriven = true; }
 private:
     std::vector<std::unique_ptr<Rule>> rules;
     std::vector<std::unique_ptr<Variable>> variables;
     Actions actions;
     std::string variableClassName;
+    bool tableDriven;
 };
 
 class LexerFile : public File
@@ -0,0 +1,159 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.util;
+
+namespace soul::bench {
+
+const std::size_t allocationHeaderSize = alignof(std::max_align_t);
+
+std::atomic<int64_t> allocationCount = 0;
+std::atomic<int64_t> allocatedBytes = 0;
+std::atomic<int64_t> peakAllocatedBytes = 0;
+
+void* Allocate(std::size_t size)
+{
+    char* block = static_cast<char*>(std::malloc(size + allocationHeaderSize));
+    if (!block)
+    {
+        return nullptr;
+    }
+    *reinterpret_cast<std::size_t*>(block) = size;
+    ++allocationCount;
+    int64_t bytes = allocatedBytes += size;
+    int64_t peak = peakAllocatedBytes;
+    while (bytes > peak && !peakAllocatedBytes.compare_exchange_weak(peak, bytes))
+    {
+    }
+    return block + allocationHeaderSize;
+}
+
+void Free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+    char* block = static_cast<char*>(ptr) - allocationHeaderSize;
+    allocatedBytes -= *reinterpret_cast<std::size_t*>(block);
+    std::free(block);
+}
+
+int64_t AllocationCount()
+{
+    return allocationCount;
+}
+
+int64_t AllocatedBytes()
+{
+    return allocatedBytes;
+}
+
+int64_t PeakAllocatedBytes()
+{
+    return peakAllocatedBytes;
+}
+
+void ResetPeakAllocatedBytes()
+{
+    peakAllocatedBytes = static_cast<int64_t>(allocatedBytes);
+}
+
+Stopwatch::Stopwatch() : start(std::chrono::steady_clock::now())
+{
+}
+
+void Stopwatch::Restart()
+{
+    start = std::chrono::steady_clock::now();
+}
+
+double Stopwatch::Seconds() const
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double MegabytesPerSecond(int64_t bytes, double seconds)
+{
+    if (seconds <= 0)
+    {
+        return 0;
+    }
+    return bytes / (1024.0 * 1024.0) / seconds;
+}
+
+std::string FormatMegabytes(int64_t bytes)
+{
+    return FormatDouble(bytes / (1024.0 * 1024.0), 1) + " MB";
+}
+
+std::string FormatDouble(double value, int precision)
+{
+    std::ostringstream s;
+    s << std::fixed << std::setprecision(precision) << value;
+    return s.str();
+}
+
+} // namespace soul::bench
+
+extern "C++"
+{
+
+void* operator new(std::size_t size)
+{
+    void* ptr = soul::bench::Allocate(size);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return soul::bench::Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return soul::bench::Allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    soul::bench::Free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    soul::bench::Free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    soul::bench::Free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t size) noexcept
+{
+    soul::bench::Free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    soul::bench::Free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    soul::bench::Free(ptr);
+}
+
+} // extern "C++"
@@ -0,0 +1,36 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.util;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  The benchmark executable replaces the global operator new and operator delete, so that benchmarks
+//  can report the number of heap allocations and the peak number of bytes allocated from the heap.
+//  ===================================================================================================
+
+int64_t AllocationCount();
+int64_t AllocatedBytes();
+int64_t PeakAllocatedBytes();
+void ResetPeakAllocatedBytes();
+
+class Stopwatch
+{
+public:
+    Stopwatch();
+    void Restart();
+    double Seconds() const;
+private:
+    std::chrono::steady_clock::time_point start;
+};
+
+double MegabytesPerSecond(int64_t bytes, double seconds);
+std::string FormatMegabytes(int64_t bytes);
+std::string FormatDouble(double value, int precision);
+
+} // namespace soul::bench
@@ -0,0 +1,71 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.class.map;
+
+import soul.bench.util;
+import soul.lexer.classmap;
+import soul.xml.xpath.lexer;
+import util;
+
+namespace soul::bench {
+
+const char* xpathClassMapName = "soul.xml.xpath.lexer.classmap";
+
+std::vector<int32_t> ReadFlatClassMap(const std::string& classMapName)
+{
+    std::string currentExecutableName = util::Path::GetFileName(util::GetFullPath(util::GetPathToExecutable()));
+    util::BinaryResourcePtr resource(currentExecutableName, classMapName);
+    util::MemoryStream memoryStream(resource.Data(), resource.Size());
+    util::BinaryStreamReader rawReader(memoryStream);
+    int32_t size = rawReader.ReadInt();
+    std::vector<int32_t> data(size);
+    util::DeflateStream compressedStream(util::CompressionMode::decompress, memoryStream);
+    util::BinaryStreamReader reader(compressedStream);
+    for (int32_t i = 0; i < size; ++i)
+    {
+        data[i] = reader.ReadInt();
+    }
+    return data;
+}
+
+void MeasureClassMapLoad(const std::string& name, const std::function<int64_t()>& load)
+{
+    const int rounds = 10;
+    double bestSeconds = 0;
+    int64_t residentSize = 0;
+    for (int i = 0; i < rounds; ++i)
+    {
+        Stopwatch stopwatch;
+        residentSize = load();
+        double seconds = stopwatch.Seconds();
+        if (i == 0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+    }
+    std::cout << "  " << name << ": " << FormatDouble(bestSeconds * 1000.0, 2) << " ms, resident size " << FormatDouble(residentSize / 1024.0, 1) << " KB" << "\n";
+}
+
+void RunClassMapBenchmark()
+{
+    std::cout << "class_map: " << xpathClassMapName << "\n";
+    MeasureClassMapLoad("constexpr", []()
+        {
+            return soul::xml::xpath::lexer::GetClassMap<char32_t>()->ResidentSize();
+        });
+    MeasureClassMapLoad("MakeClassMap", []()
+        {
+            std::unique_ptr<soul::lexer::ClassMap<char32_t>> classMap(soul::lexer::MakeClassMap<char32_t>(xpathClassMapName));
+            return classMap->ResidentSize();
+        });
+    MeasureClassMapLoad("flat", []()
+        {
+            std::vector<int32_t> data = ReadFlatClassMap(xpathClassMapName);
+            return static_cast<int64_t>(data.size() * sizeof(int32_t));
+        });
+}
+
+} // namespace soul::bench
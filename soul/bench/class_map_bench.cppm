@@ -0,0 +1,22 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.class.map;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunClassMapBenchmark measures the startup cost of the XPath lexer class map. The lexer uses constexpr
+//  page tables compiled into the binary, so getting the map costs nothing and its size is the size of
+//  the tables. For comparison it measures the time MakeClassMap takes to build the paged class map from
+//  the compressed resource, and loading the resource the way class maps were loaded before the paged
+//  layout: one int at a time through a BinaryStreamReader into a flat array of one class per character.
+//  ===================================================================================================
+
+void RunClassMapBenchmark();
+
+} // namespace soul::bench
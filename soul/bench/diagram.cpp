@@ -0,0 +1,44 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.diagram;
+
+namespace soul::bench {
+
+std::string Bounds(int64_t index, int64_t part)
+{
+    return "<bounds height=\"" + std::to_string(4 + part) + ".943945\" width=\"" + std::to_string(40 + index % 17) + ".130051\" x=\"" +
+        std::to_string(10 + (index % 20) * 50) + ".500000\" y=\"" + std::to_string(35 + (index / 20) * 30 + part * 4) + ".556053\"/>";
+}
+
+std::string MakeDiagramXml(int64_t classCount)
+{
+    std::string xml;
+    xml.append("<diagram>\n");
+    for (int64_t i = 0; i < classCount; ++i)
+    {
+        std::string name = "Class" + std::to_string(i);
+        xml.append(" <classElement abstract=\"").append(i % 5 == 0 ? "true" : "false").append("\" keyword=\"\" name=\"").append(name).append("\">\n");
+        xml.append("  ").append(Bounds(i, 0)).append("\n");
+        xml.append("  <attribute name=\"-count: int\">\n   ").append(Bounds(i, 1)).append("\n  </attribute>\n");
+        xml.append("  <operation abstract=\"false\" name=\"+Measure(graphics: Graphics)\">\n   ").append(Bounds(i, 2)).append("\n  </operation>\n");
+        xml.append("  <operation abstract=\"false\" name=\"+Draw(graphics: Graphics)\">\n   ").append(Bounds(i, 3)).append("\n  </operation>\n");
+        xml.append(" </classElement>\n");
+        if (i > 0)
+        {
+            xml.append(" <relationshipElement cardinality=\"one\" rkind=\"").append(i % 3 == 0 ? "inheritance" : "composition").append("\">\n");
+            xml.append("  ").append(Bounds(i, 4)).append("\n");
+            xml.append("  <source connector=\"right.top\" index=\"").append(std::to_string(i - 1)).append("\" x=\"48.963867\" y=\"9.000000\">\n");
+            xml.append("   <primaryText keyword=\"\">\n    ").append(Bounds(i, 5)).append("\n    <line text=\"").append(name).append("\"/>\n   </primaryText>\n");
+            xml.append("  </source>\n");
+            xml.append("  <target connector=\"left.top\" index=\"").append(std::to_string(i)).append("\" x=\"145.000000\" y=\"9.000000\"/>\n");
+            xml.append(" </relationshipElement>\n");
+        }
+    }
+    xml.append("</diagram>\n");
+    return xml;
+}
+
+} // namespace soul::bench
@@ -0,0 +1,20 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.diagram;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  MakeDiagramXml returns a diagram document shaped like the springpp diagram files: given number of
+//  class elements with bounds, operations and attributes, and a relationship between each pair of
+//  consecutive classes. Each class element and its relationship take about 1 KB.
+//  ===================================================================================================
+
+std::string MakeDiagramXml(int64_t classCount);
+
+} // namespace soul::bench
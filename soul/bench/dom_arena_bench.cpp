@@ -0,0 +1,57 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.dom.arena;
+
+import soul.bench.util;
+import soul.bench.diagram;
+import soul.xml.dom;
+import soul.xml.dom.parser;
+
+namespace soul::bench {
+
+void MeasureBuildAndDestroy(const std::string& name, const std::string& xml, soul::xml::ParsingFlags flags)
+{
+    const int rounds = 3;
+    double bestBuildSeconds = 0;
+    double bestDestroySeconds = 0;
+    int64_t peakBytes = 0;
+    int64_t allocations = 0;
+    for (int i = 0; i < rounds; ++i)
+    {
+        int64_t bytesBefore = AllocatedBytes();
+        int64_t allocationsBefore = AllocationCount();
+        ResetPeakAllocatedBytes();
+        Stopwatch stopwatch;
+        std::unique_ptr<soul::xml::Document> document = soul::xml::ParseXmlContent(xml, "bench.xml", flags);
+        double buildSeconds = stopwatch.Seconds();
+        stopwatch.Restart();
+        document.reset();
+        double destroySeconds = stopwatch.Seconds();
+        if (i == 0 || buildSeconds < bestBuildSeconds)
+        {
+            bestBuildSeconds = buildSeconds;
+        }
+        if (i == 0 || destroySeconds < bestDestroySeconds)
+        {
+            bestDestroySeconds = destroySeconds;
+        }
+        peakBytes = PeakAllocatedBytes() - bytesBefore;
+        allocations = AllocationCount() - allocationsBefore;
+    }
+    std::cout << "  " << name << ": build " << FormatDouble(bestBuildSeconds * 1000.0, 1) << " ms (" << FormatDouble(MegabytesPerSecond(xml.length(), bestBuildSeconds), 1) <<
+        " MB/s), destroy " << FormatDouble(bestDestroySeconds * 1000.0, 1) << " ms, peak heap " << FormatMegabytes(peakBytes) << ", " << allocations << " allocations" << "\n";
+}
+
+void RunDomArenaBenchmark()
+{
+    const int64_t classCount = 16384;
+    std::string xml = MakeDiagramXml(classCount);
+    std::cout << "dom_arena: " << FormatMegabytes(xml.length()) << " diagram" << "\n";
+    MeasureBuildAndDestroy("heap", xml, soul::xml::ParsingFlags::none);
+    MeasureBuildAndDestroy("arena", xml, soul::xml::ParsingFlags::arenaAllocation);
+}
+
+} // namespace soul::bench
@@ -0,0 +1,20 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.dom.arena;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunDomArenaBenchmark builds a DOM document from a 16 MB diagram and destroys it, first with heap
+//  allocated nodes and then with arena allocated nodes, and reports the build and destroy times, the
+//  peak heap size and the number of allocations of each.
+//  ===================================================================================================
+
+void RunDomArenaBenchmark();
+
+} // namespace soul::bench
@@ -0,0 +1,86 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.id.index;
+
+import soul.bench.util;
+import soul.xml.dom;
+import soul.xml.dom.parser;
+
+namespace soul::bench {
+
+void CheckElementById(soul::xml::Document* document, const std::string& expectedName, const std::string& step)
+{
+    soul::xml::Element* element = document->GetElementById("x");
+    std::string name = element ? element->GetAttribute("n") : "null";
+    if (name != expectedName)
+    {
+        throw std::runtime_error("id_index: GetElementById(\"x\") returned '" + name + "' instead of '" + expectedName + "' " + step);
+    }
+}
+
+void CheckDuplicateIds()
+{
+    std::unique_ptr<soul::xml::Document> document = soul::xml::ParseXmlContent(
+        "<doc><a id=\"x\" n=\"a\"/><b id=\"y\" n=\"b\"><c id=\"x\" n=\"c\"/></b><d id=\"x\" n=\"d\"/></doc>", "id_index.xml");
+    soul::xml::Element* doc = document->DocumentElement();
+    CheckElementById(document.get(), "d", "after parsing");
+    soul::xml::Element* e = soul::xml::MakeElement("e");
+    e->SetAttribute("id", "x");
+    e->SetAttribute("n", "e");
+    doc->InsertBefore(e, doc->FirstChild());
+    CheckElementById(document.get(), "d", "after inserting a first child with the same id");
+    std::unique_ptr<soul::xml::Node> d = doc->RemoveChild(doc->LastChild());
+    CheckElementById(document.get(), "c", "after removing the last element");
+    soul::xml::Element* b = document->GetElementById("y");
+    std::unique_ptr<soul::xml::Node> removedB = doc->RemoveChild(b);
+    CheckElementById(document.get(), "a", "after removing the parent of the last element");
+    doc->InsertBefore(removedB.release(), doc->FirstChild());
+    CheckElementById(document.get(), "a", "after inserting the removed subtree before the other elements");
+    doc->AppendChild(d.release());
+    CheckElementById(document.get(), "d", "after appending the removed element");
+}
+
+void RunIdIndexBenchmark()
+{
+    CheckDuplicateIds();
+    const int64_t elementCount = 100000;
+    std::string xml = "<doc>";
+    for (int64_t i = 0; i < elementCount; ++i)
+    {
+        xml.append("<e id=\"e").append(std::to_string(i % 10 == 0 ? i + 1 : i)).append("\"/>");
+    }
+    xml.append("</doc>");
+    std::unique_ptr<soul::xml::Document> document = soul::xml::ParseXmlContent(xml, "id_index.xml");
+    std::vector<std::string> ids;
+    for (int64_t i = 0; i < elementCount; ++i)
+    {
+        ids.push_back("e" + std::to_string(i));
+    }
+    const int rounds = 3;
+    double bestSeconds = 0;
+    int64_t found = 0;
+    for (int i = 0; i < rounds; ++i)
+    {
+        found = 0;
+        Stopwatch stopwatch;
+        for (const auto& id : ids)
+        {
+            if (document->GetElementById(id))
+            {
+                ++found;
+            }
+        }
+        double seconds = stopwatch.Seconds();
+        if (i == 0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+    }
+    std::cout << "id_index: " << elementCount << " elements, " << found << " ids found" << "\n";
+    std::cout << "  GetElementById: " << FormatDouble(ids.size() / bestSeconds / 1000000.0, 2) << " million lookups/s" << "\n";
+}
+
+} // namespace soul::bench
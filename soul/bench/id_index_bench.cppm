@@ -0,0 +1,21 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.id.index;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunIdIndexBenchmark first checks that GetElementById returns the last element with a duplicated
+//  id in document order when elements are inserted out of document order and removed, and throws if
+//  it does not. Then it reports the lookups per second of GetElementById in a document of 100000
+//  elements in which every tenth id is shared by two elements.
+//  ===================================================================================================
+
+void RunIdIndexBenchmark();
+
+} // namespace soul::bench
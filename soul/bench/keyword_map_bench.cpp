@@ -0,0 +1,94 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.keyword.map;
+
+import soul.bench.util;
+import soul.lexer;
+import soul.xml.xpath.token;
+
+namespace soul::bench {
+
+using namespace soul::xml::xpath::token;
+
+const soul::lexer::Keyword<char> xpathKeywords[] = {
+    { "or", OR },
+    { "and", AND },
+    { "div", DIV },
+    { "mod", MOD },
+    { "ancestor", ANCESTOR },
+    { "ancestor-or-self", ANCESTOR_OR_SELF },
+    { "attribute", ATTRIBUTE },
+    { "child", CHILD },
+    { "descendant", DESCENDANT },
+    { "descendant-or-self", DESCENDANT_OR_SELF },
+    { "following", FOLLOWING },
+    { "following-sibling", FOLLOWING_SIBLING },
+    { "namespace", NAMESPACE },
+    { "parent", PARENT },
+    { "preceding", PRECEDING },
+    { "preceding-sibling", PRECEDING_SIBLING },
+    { "self", SELF },
+    { "processing-instruction", PROCESSING_INSTRUCTION },
+    { "comment", COMMENT },
+    { "text", TEXT },
+    { "node", NODE },
+    { nullptr, -1 }
+};
+
+std::vector<std::string> identifiers =
+{
+    "child", "bounds", "descendant", "classElement", "name", "attribute", "operation", "x", "text", "relationshipElement",
+    "following-sibling", "source", "index", "self", "position", "count", "node", "y", "ancestor-or-self", "diagram",
+    "and", "rkind", "or", "sourceEndPoint", "parent", "width", "preceding", "height", "comment", "theme"
+};
+
+template<typename Lookup>
+void MeasureLookups(const std::string& name, const std::vector<soul::lexer::Lexeme<char>>& lexemes, const Lookup& lookup)
+{
+    const int rounds = 200000;
+    int64_t keywordCount = 0;
+    Stopwatch stopwatch;
+    for (int i = 0; i < rounds; ++i)
+    {
+        for (const auto& lexeme : lexemes)
+        {
+            if (lookup(lexeme) != soul::lexer::INVALID_TOKEN)
+            {
+                ++keywordCount;
+            }
+        }
+    }
+    double seconds = stopwatch.Seconds();
+    int64_t lookups = static_cast<int64_t>(rounds) * lexemes.size();
+    std::cout << "  " << name << ": " << FormatDouble(lookups / seconds / 1000000.0, 1) << " million lookups/s, " <<
+        FormatDouble(seconds * 1000000000.0 / lookups, 1) << " ns per lookup, " << keywordCount / rounds << " keywords" << "\n";
+}
+
+void RunKeywordMapBenchmark()
+{
+    std::vector<soul::lexer::Lexeme<char>> lexemes;
+    for (const auto& identifier : identifiers)
+    {
+        lexemes.push_back(soul::lexer::Lexeme<char>(identifier.data(), identifier.data() + identifier.length()));
+    }
+    std::cout << "keyword_map: " << lexemes.size() << " identifiers" << "\n";
+    soul::lexer::KeywordMap<char> keywordMap(xpathKeywords);
+    MeasureLookups("KeywordMap", lexemes, [&](const soul::lexer::Lexeme<char>& lexeme) { return keywordMap.GetKeywordToken(lexeme); });
+    std::map<soul::lexer::Lexeme<char>, int64_t, soul::lexer::LexemeCompare<char>> lexemeMap;
+    const soul::lexer::Keyword<char>* kw = xpathKeywords;
+    while (kw->str)
+    {
+        lexemeMap[soul::lexer::Lexeme<char>(kw->str, soul::lexer::StrEnd(kw->str))] = kw->tokenID;
+        ++kw;
+    }
+    MeasureLookups("std::map", lexemes, [&](const soul::lexer::Lexeme<char>& lexeme)
+        {
+            auto it = lexemeMap.find(lexeme);
+            return it != lexemeMap.end() ? it->second : soul::lexer::INVALID_TOKEN;
+        });
+}
+
+} // namespace soul::bench
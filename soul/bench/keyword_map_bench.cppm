@@ -0,0 +1,20 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.keyword.map;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunKeywordMapBenchmark looks up a mix of XPath keywords and ordinary names in the perfect hash
+//  KeywordMap and in a std::map keyed by lexemes, the way keyword maps were built before KeywordMap,
+//  and reports the lookups per second of both.
+//  ===================================================================================================
+
+void RunKeywordMapBenchmark();
+
+} // namespace soul::bench
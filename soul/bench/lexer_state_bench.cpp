@@ -0,0 +1,56 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.lexer.state;
+
+import soul.bench.util;
+import soul.bench.xpath.parser;
+import soul.xml.xpath.lexer;
+import util.unicode;
+
+namespace soul::bench {
+
+void MeasureSnapshots(const std::u32string& corpus, int64_t tokenCount, int advance)
+{
+    const int snapshots = 2000;
+    auto lexer = soul::xml::xpath::lexer::MakeLexer(corpus.c_str(), corpus.c_str() + corpus.length(), "corpus");
+    for (int64_t i = 0; i < tokenCount; ++i)
+    {
+        ++lexer;
+    }
+    Stopwatch stopwatch;
+    for (int i = 0; i < snapshots; ++i)
+    {
+        lexer.PushState();
+        for (int j = 0; j < advance; ++j)
+        {
+            ++lexer;
+        }
+        lexer.PopState();
+    }
+    double seconds = stopwatch.Seconds();
+    std::cout << "  " << tokenCount << " tokens, advance " << advance << ": " << FormatDouble(seconds * 1000000000.0 / snapshots, 1) << " ns per snapshot" << "\n";
+}
+
+void RunLexerStateBenchmark()
+{
+    std::string corpus;
+    while (corpus.length() < 4 * 1024 * 1024)
+    {
+        for (const auto& xpathExpr : XPathExpressions())
+        {
+            corpus.append(xpathExpr).append(1, '\n');
+        }
+    }
+    std::u32string u32corpus = util::ToUtf32(corpus);
+    std::cout << "lexer_state:" << "\n";
+    for (int64_t tokenCount : { 1000, 10000, 100000 })
+    {
+        MeasureSnapshots(u32corpus, tokenCount, 0);
+        MeasureSnapshots(u32corpus, tokenCount, 8);
+    }
+}
+
+} // namespace soul::bench
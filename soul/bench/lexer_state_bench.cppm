@@ -0,0 +1,20 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.lexer.state;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunLexerStateBenchmark measures the cost of a lexer snapshot: a PushState and PopState pair taken
+//  after the lexer has produced a growing number of tokens, and a snapshot that is restored after
+//  the lexer has advanced a few tokens past it, as a parser does when an alternative fails.
+//  ===================================================================================================
+
+void RunLexerStateBenchmark();
+
+} // namespace soul::bench
@@ -0,0 +1,82 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+import soul.bench.xml.scanner;
+import soul.bench.dom.arena;
+import soul.bench.xpath.parser;
+import soul.bench.keyword.map;
+import soul.bench.xpath.lexer;
+import soul.bench.class.map;
+import soul.bench.transcoding;
+import soul.bench.xpath.query;
+import soul.bench.lexer.state;
+import soul.bench.id.index;
+import std.core;
+
+struct Benchmark
+{
+    std::string name;
+    void (*run)();
+};
+
+std::vector<Benchmark> benchmarks =
+{
+    { "xml_scanner", soul::bench::RunXmlScannerBenchmark },
+    { "xpath_parser", soul::bench::RunXPathParserBenchmark },
+    { "dom_arena", soul::bench::RunDomArenaBenchmark },
+    { "keyword_map", soul::bench::RunKeywordMapBenchmark },
+    { "xpath_lexer", soul::bench::RunXPathLexerBenchmark },
+    { "class_map", soul::bench::RunClassMapBenchmark },
+    { "transcoding", soul::bench::RunTranscodingBenchmark },
+    { "xpath_query", soul::bench::RunXPathQueryBenchmark },
+    { "lexer_state", soul::bench::RunLexerStateBenchmark },
+    { "id_index", soul::bench::RunIdIndexBenchmark }
+};
+
+void PrintHelp()
+{
+    std::cout << "Usage: soul_bench [BENCHMARK...]" << "\n";
+    std::cout << "Runs given benchmarks, or all benchmarks if none is given." << "\n";
+    std::cout << "Benchmarks:" << "\n";
+    for (const auto& benchmark : benchmarks)
+    {
+        std::cout << "  " << benchmark.name << "\n";
+    }
+}
+
+int main(int argc, const char** argv)
+{
+    try
+    {
+        std::vector<std::string> names;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h")
+            {
+                PrintHelp();
+                return 0;
+            }
+            if (std::find_if(benchmarks.begin(), benchmarks.end(), [&](const Benchmark& benchmark) { return benchmark.name == arg; }) == benchmarks.end())
+            {
+                throw std::runtime_error("unknown benchmark '" + arg + "'");
+            }
+            names.push_back(arg);
+        }
+        for (const auto& benchmark : benchmarks)
+        {
+            if (names.empty() || std::find(names.begin(), names.end(), benchmark.name) != names.end())
+            {
+                benchmark.run();
+            }
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
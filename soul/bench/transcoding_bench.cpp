@@ -0,0 +1,64 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.transcoding;
+
+import soul.bench.util;
+import util.unicode;
+
+namespace soul::bench {
+
+std::string MakeText(const std::string& sample, int64_t size)
+{
+    std::string text;
+    while (static_cast<int64_t>(text.length()) < size)
+    {
+        text.append(sample);
+    }
+    return text;
+}
+
+template<typename Convert>
+void MeasureConversion(const std::string& name, int64_t utf8Size, const Convert& convert)
+{
+    const int rounds = 5;
+    double bestSeconds = 0;
+    for (int i = 0; i < rounds; ++i)
+    {
+        Stopwatch stopwatch;
+        convert();
+        double seconds = stopwatch.Seconds();
+        if (i == 0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+    }
+    std::cout << "    " << name << ": " << FormatDouble(MegabytesPerSecond(utf8Size, bestSeconds), 1) << " MB/s" << "\n";
+}
+
+void MeasureText(const std::string& name, const std::string& utf8)
+{
+    std::u32string utf32 = util::ToUtf32(utf8);
+    std::u16string utf16 = util::ToUtf16(utf32);
+    std::cout << "  " << name << ": " << FormatMegabytes(utf8.length()) << ", " << utf32.length() << " characters" << "\n";
+    int64_t size = utf8.length();
+    MeasureConversion("UTF-8 to UTF-32", size, [&]() { return util::ToUtf32(utf8); });
+    MeasureConversion("UTF-32 to UTF-8", size, [&]() { return util::ToUtf8(utf32); });
+    MeasureConversion("UTF-8 to UTF-16", size, [&]() { return util::ToUtf16(utf8); });
+    MeasureConversion("UTF-16 to UTF-8", size, [&]() { return util::ToUtf8(utf16); });
+}
+
+void RunTranscodingBenchmark()
+{
+    const int64_t size = 16 * 1024 * 1024;
+    std::cout << "transcoding:" << "\n";
+    MeasureText("ASCII", MakeText("<classElement name=\"Class1\" abstract=\"false\"><bounds x=\"10\" y=\"20\" width=\"100\" height=\"50\"/></classElement>\n", size));
+    MeasureText("mixed Latin", MakeText(util::ToUtf8(std::u32string(
+        U"Die Gr\u00F6\u00DFe der Stra\u00DFe \u00E4ndert sich; le caf\u00E9 \u00E0 c\u00F4t\u00E9 est ferm\u00E9; el ni\u00F1o comi\u00F3 pi\u00F1ata. ")), size));
+    MeasureText("CJK", MakeText(util::ToUtf8(std::u32string(
+        U"\u6587\u5B57\u30B3\u30FC\u30C9\u306E\u5909\u63DB\u901F\u5EA6\u3092\u6E2C\u5B9A\u3057\u307E\u3059\u3002\u6C49\u5B57\u7F16\u7801\u8F6C\u6362\u7684\u541E\u5410\u91CF\u6D4B\u8BD5\u3002")), size));
+}
+
+} // namespace soul::bench
@@ -0,0 +1,19 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.transcoding;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunTranscodingBenchmark converts ASCII, mixed Latin and CJK text between UTF-8, UTF-16 and UTF-32
+//  and reports the throughput of each conversion in MB of UTF-8 per second.
+//  ===================================================================================================
+
+void RunTranscodingBenchmark();
+
+} // namespace soul::bench
@@ -0,0 +1,76 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.xml.scanner;
+
+import soul.bench.util;
+import soul.bench.diagram;
+import soul.xml.parser;
+import soul.xml.content.handler;
+import soul.xml.processor.attribute;
+import soul.ast.source.pos;
+import util.memory.stream;
+
+namespace soul::bench {
+
+class ElementCounter : public soul::xml::XmlContentHandler
+{
+public:
+    ElementCounter() : count(0) {}
+    int64_t Count() const { return count; }
+    void StartElement(const soul::ast::SourcePos& sourcePos, const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName,
+        const soul::xml::processor::Attributes& attributes) override
+    {
+        ++count;
+    }
+private:
+    int64_t count;
+};
+
+void MeasureParse(const std::string& name, int64_t size, const std::function<void(soul::xml::XmlContentHandler*)>& parse)
+{
+    const int rounds = 3;
+    double bestSeconds = 0;
+    int64_t peakBytes = 0;
+    int64_t allocations = 0;
+    int64_t elements = 0;
+    for (int i = 0; i < rounds; ++i)
+    {
+        ElementCounter counter;
+        int64_t bytesBefore = AllocatedBytes();
+        int64_t allocationsBefore = AllocationCount();
+        ResetPeakAllocatedBytes();
+        Stopwatch stopwatch;
+        parse(&counter);
+        double seconds = stopwatch.Seconds();
+        if (i == 0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+        peakBytes = PeakAllocatedBytes() - bytesBefore;
+        allocations = AllocationCount() - allocationsBefore;
+        elements = counter.Count();
+    }
+    std::cout << "  " << name << ": " << FormatDouble(MegabytesPerSecond(size, bestSeconds), 1) << " MB/s, peak heap " << FormatMegabytes(peakBytes) <<
+        ", " << allocations << " allocations, " << elements << " elements" << "\n";
+}
+
+void RunXmlScannerBenchmark()
+{
+    const int64_t classCount = 16384;
+    std::string xml = MakeDiagramXml(classCount);
+    std::cout << "xml_scanner: " << FormatMegabytes(xml.length()) << " diagram" << "\n";
+    MeasureParse("ParseXmlContent", xml.length(), [&](soul::xml::XmlContentHandler* handler)
+        {
+            soul::xml::parser::ParseXmlContent(xml, "bench.xml", handler);
+        });
+    MeasureParse("ParseXmlStream", xml.length(), [&](soul::xml::XmlContentHandler* handler)
+        {
+            util::MemoryStream stream(reinterpret_cast<uint8_t*>(xml.data()), xml.length());
+            soul::xml::parser::ParseXmlStream(stream, "bench.xml", handler);
+        });
+}
+
+} // namespace soul::bench
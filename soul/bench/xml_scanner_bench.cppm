@@ -0,0 +1,19 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.xml.scanner;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunXmlScannerBenchmark parses a 16 MB diagram document with ParseXmlContent and ParseXmlStream and
+//  reports the throughput, the peak heap size and the number of allocations of each.
+//  ===================================================================================================
+
+void RunXmlScannerBenchmark();
+
+} // namespace soul::bench
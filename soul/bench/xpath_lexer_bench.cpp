@@ -0,0 +1,73 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.xpath.lexer;
+
+import soul.bench.util;
+import soul.bench.xpath.parser;
+import soul.lexer;
+import soul.xml.xpath.lexer;
+import util.unicode;
+
+namespace soul::bench {
+
+template<typename Lexer>
+int64_t Tokenize(Lexer& lexer)
+{
+    int64_t tokenCount = 0;
+    ++lexer;
+    while (*lexer != soul::lexer::END_TOKEN)
+    {
+        ++tokenCount;
+        ++lexer;
+    }
+    return tokenCount;
+}
+
+template<typename MakeLexer>
+void MeasureLexer(const std::string& name, const std::u32string& corpus, const MakeLexer& makeLexer)
+{
+    const int rounds = 5;
+    double bestSeconds = 0;
+    int64_t tokenCount = 0;
+    for (int i = 0; i < rounds; ++i)
+    {
+        Stopwatch stopwatch;
+        auto lexer = makeLexer(corpus.c_str(), corpus.c_str() + corpus.length());
+        tokenCount = Tokenize(lexer);
+        double seconds = stopwatch.Seconds();
+        if (i == 0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+    }
+    std::cout << "  " << name << ": " << FormatDouble(MegabytesPerSecond(corpus.length(), bestSeconds), 1) << " MB/s, " <<
+        FormatDouble(tokenCount / bestSeconds / 1000000.0, 1) << " million tokens/s, " << tokenCount << " tokens" << "\n";
+}
+
+void RunXPathLexerBenchmark()
+{
+    const int64_t corpusSize = 4 * 1024 * 1024;
+    std::string corpus;
+    while (static_cast<int64_t>(corpus.length()) < corpusSize)
+    {
+        for (const auto& xpathExpr : XPathExpressions())
+        {
+            corpus.append(xpathExpr).append(1, '\n');
+        }
+    }
+    std::u32string u32corpus = util::ToUtf32(corpus);
+    std::cout << "xpath_lexer: " << FormatMegabytes(corpus.length()) << " of XPath expressions" << "\n";
+    MeasureLexer("XPathLexer", u32corpus, [](const char32_t* start, const char32_t* end)
+        {
+            return soul::xml::xpath::lexer::MakeLexer(start, end, "corpus");
+        });
+    MeasureLexer("MakeTableLexer", u32corpus, [](const char32_t* start, const char32_t* end)
+        {
+            return soul::xml::xpath::lexer::MakeTableLexer(start, end, "corpus");
+        });
+}
+
+} // namespace soul::bench
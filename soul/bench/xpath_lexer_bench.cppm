@@ -0,0 +1,19 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.xpath.lexer;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunXPathLexerBenchmark tokenizes the same corpus of XPath expressions with the generated XPath
+//  lexer (XPathLexer) and with the table-driven lexer (MakeTableLexer) and reports MB/s for both.
+//  ===================================================================================================
+
+void RunXPathLexerBenchmark();
+
+} // namespace soul::bench
@@ -0,0 +1,64 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.xpath.parser;
+
+import soul.bench.util;
+import soul.xml.xpath.evaluate;
+import soul.xml.xpath.expr;
+
+namespace soul::bench {
+
+std::vector<std::string> xpathExprs =
+{
+    "bounds",
+    "/diagram/*",
+    "/springpp.diagram.elements/*",
+    "/themes/theme",
+    "sourceEndPoint",
+    "//classElement[@name='Class1']",
+    "child::operation/attribute::name",
+    "descendant::bounds[@x > 10]",
+    "ancestor-or-self::*",
+    "../relationshipElement[@rkind='inheritance']/source/@index",
+    "count(//operation) + count(//attribute)",
+    "/diagram/classElement[position() < 10]/@name",
+    "following-sibling::classElement[1]",
+    "preceding::*[self::relationshipElement]"
+};
+
+const std::vector<std::string>& XPathExpressions()
+{
+    return xpathExprs;
+}
+
+void RunXPathParserBenchmark()
+{
+    const int rounds = 20000;
+    int64_t size = 0;
+    for (const auto& xpathExpr : xpathExprs)
+    {
+        size += xpathExpr.length();
+    }
+    int64_t allocationsBefore = AllocationCount();
+    Stopwatch stopwatch;
+    for (int i = 0; i < rounds; ++i)
+    {
+        for (const auto& xpathExpr : xpathExprs)
+        {
+            std::unique_ptr<soul::xml::xpath::expr::Expr> expr = soul::xml::xpath::ParseXPathExpr(xpathExpr);
+        }
+    }
+    double seconds = stopwatch.Seconds();
+    int64_t allocations = AllocationCount() - allocationsBefore;
+    int64_t exprCount = static_cast<int64_t>(rounds) * xpathExprs.size();
+    int64_t totalSize = rounds * size;
+    std::cout << "xpath_parser: " << xpathExprs.size() << " expressions, " << size << " bytes, parsed " << rounds << " times" << "\n";
+    std::cout << "  " << FormatDouble(exprCount / seconds / 1000.0, 1) << " k expressions/s, " << FormatDouble(MegabytesPerSecond(totalSize, seconds), 2) << " MB/s" << "\n";
+    std::cout << "  " << FormatDouble(static_cast<double>(allocations) / exprCount, 1) << " allocations per expression, " <<
+        FormatDouble(allocations / (totalSize / (1024.0 * 1024.0)) / 1000000.0, 2) << " million allocations per MB" << "\n";
+}
+
+} // namespace soul::bench
@@ -0,0 +1,25 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.xpath.parser;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  XPathExpressions returns the XPath expressions the XPath benchmarks use as their input.
+//  ===================================================================================================
+
+const std::vector<std::string>& XPathExpressions();
+
+//  ===================================================================================================
+//  RunXPathParserBenchmark parses a set of XPath expressions repeatedly without the expression cache
+//  and reports the throughput and the number of allocations per expression and per MB of input.
+//  ===================================================================================================
+
+void RunXPathParserBenchmark();
+
+} // namespace soul::bench
@@ -0,0 +1,61 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.bench.xpath.query;
+
+import soul.bench.util;
+import soul.bench.diagram;
+import soul.xml.dom;
+import soul.xml.dom.parser;
+import soul.xml.xpath;
+
+namespace soul::bench {
+
+const int64_t elementsPerClass = 15;
+
+std::vector<std::string> queries =
+{
+    "/diagram/*",
+    "//*",
+    "//classElement[@name='Class1']"
+};
+
+void MeasureQuery(const std::string& query, soul::xml::Document* document)
+{
+    const int rounds = 3;
+    double bestSeconds = 0;
+    int count = 0;
+    soul::xml::xpath::XPathEvaluator evaluator;
+    for (int i = 0; i < rounds; ++i)
+    {
+        Stopwatch stopwatch;
+        std::unique_ptr<soul::xml::xpath::NodeSet> nodeSet = evaluator.EvaluateToNodeSet(query, document);
+        double seconds = stopwatch.Seconds();
+        if (i == 0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+        count = nodeSet->Count();
+        evaluator.Release(std::move(nodeSet));
+    }
+    std::cout << "    " << query << ": " << FormatDouble(bestSeconds * 1000.0, 2) << " ms, " << count << " nodes" << "\n";
+}
+
+void RunXPathQueryBenchmark()
+{
+    std::cout << "xpath_query:" << "\n";
+    for (int64_t elementCount : { 10000, 100000, 1000000 })
+    {
+        std::string xml = MakeDiagramXml(elementCount / elementsPerClass);
+        std::unique_ptr<soul::xml::Document> document = soul::xml::ParseXmlContent(xml, "bench.xml");
+        std::cout << "  " << elementCount << " elements, " << FormatMegabytes(xml.length()) << ":" << "\n";
+        for (const auto& query : queries)
+        {
+            MeasureQuery(query, document.get());
+        }
+    }
+}
+
+} // namespace soul::bench
@@ -0,0 +1,20 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.bench.xpath.query;
+
+import std.core;
+
+export namespace soul::bench {
+
+//  ===================================================================================================
+//  RunXPathQueryBenchmark evaluates a child step, a descendant step and a descendant step with an
+//  attribute predicate on generated diagram documents of about 10 thousand, 100 thousand and one
+//  million elements and reports the evaluation time and the number of nodes in each result.
+//  ===================================================================================================
+
+void RunXPathQueryBenchmark();
+
+} // namespace soul::bench
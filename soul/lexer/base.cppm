@@ -31,7 +31,7 @@ public:
     virtual Lexeme<Char>& CurrentLexeme() = 0;
     virtual soul::ast::Span GetSpan() const = 0;
     virtual soul::ast::Span GetSpan(int64_t pos) const = 0;
-    virtual const soul::lexer::Token<Char, Self>& GetToken(int64_t pos) const = 0;
+    virtual soul::lexer::Token<Char, Self> GetToken(int64_t pos) const = 0;
     virtual const std::string& FileName() const = 0;
     virtual int File() const = 0;
     virtual int Line() const = 0;
@@ -10,67 +10,140 @@ import util;
 
 export namespace soul::lexer {
 
+//  ===================================================================================================
+//  ClassMap maps a character to the index of its character class, or -1 if the character does not
+//  belong to any class. The map is a two-level table: pageOffsets[c >> classMapPageShift] is the offset
+//  of the page of c in entries, so the class of c is found with two loads. Pages with equal contents
+//  share their entries, so the large uniform ranges of the upper planes take only a few pages.
+//
+//  The tables are either constexpr arrays emitted by the lexer generator (soul::ast::re::WriteClassMap)
+//  and compiled into the binary, or built once from a compressed class map resource.
+//  ===================================================================================================
+
+constexpr int32_t classMapPageShift = 8;
+constexpr int32_t classMapPageSize = 1 << classMapPageShift;
+constexpr int32_t classMapOffsetMask = classMapPageSize - 1;
+
 template<typename Char>
 class ClassMap
 {
 public:
-    ClassMap(const int32_t* data_, int32_t upperBound_) : data(data_), upperBound(upperBound_) { }
+    template<std::size_t pageCount, std::size_t entryCount>
+    constexpr ClassMap(const int32_t (&pageOffsets_)[pageCount], const int32_t (&entries_)[entryCount], int32_t upperBound_) :
+        pageOffsets(pageOffsets_), entries(entries_), upperBound(upperBound_), tableSize((pageCount + entryCount) * sizeof(int32_t)), pageOffsetStorage(), entryStorage()
+    {
+    }
+    ClassMap(std::vector<int32_t>&& pageOffsetStorage_, std::vector<int32_t>&& entryStorage_, int32_t upperBound_) :
+        pageOffsets(nullptr), entries(nullptr), upperBound(upperBound_), tableSize(0), pageOffsetStorage(std::move(pageOffsetStorage_)), entryStorage(std::move(entryStorage_))
+    {
+        pageOffsets = pageOffsetStorage.data();
+        entries = entryStorage.data();
+        tableSize = (pageOffsetStorage.size() + entryStorage.size()) * sizeof(int32_t);
+    }
+    ClassMap(const ClassMap&) = delete;
+    ClassMap& operator=(const ClassMap&) = delete;
     int32_t GetClass(Char c) const
     {
-        int32_t i = static_cast<int32_t>(c);
-        if (i < upperBound)
+        uint32_t i = static_cast<uint32_t>(c);
+        if (i < static_cast<uint32_t>(upperBound))
         {
-            return data[i];
+            return entries[pageOffsets[i >> classMapPageShift] + (i & classMapOffsetMask)];
         }
         else
         {
             return -1;
         }
     }
+    int32_t UpperBound() const { return upperBound; }
+    int64_t ResidentSize() const { return tableSize; }
 private:
-    const int32_t* data;
+    const int32_t* pageOffsets;
+    const int32_t* entries;
     int32_t upperBound;
+    int64_t tableSize;
+    std::vector<int32_t> pageOffsetStorage;
+    std::vector<int32_t> entryStorage;
 };
 
-#ifndef OTAVA
+//  ===================================================================================================
+//  MakeClassMap builds a paged class map from flat class data of given size. A page equal to the
+//  preceding page is not stored again; this single linear pass catches the long runs of equal pages
+//  without the cost of a full page deduplication at startup.
+//  ===================================================================================================
 
 template<typename Char>
-ClassMap<Char>* MakeClassMap(const std::string& classMapName)
+ClassMap<Char>* MakeClassMap(const int32_t* data, int32_t size)
+{
+    int32_t pageCount = (size + classMapPageSize - 1) >> classMapPageShift;
+    std::vector<int32_t> pageOffsets(pageCount);
+    std::vector<int32_t> entries;
+    int32_t prevOffset = -1;
+    for (int32_t p = 0; p < pageCount; ++p)
+    {
+        int32_t start = p << classMapPageShift;
+        int32_t count = std::min(classMapPageSize, size - start);
+        if (prevOffset != -1 && count == classMapPageSize && std::equal(data + start, data + start + count, entries.begin() + prevOffset))
+        {
+            pageOffsets[p] = prevOffset;
+            continue;
+        }
+        prevOffset = static_cast<int32_t>(entries.size());
+        pageOffsets[p] = prevOffset;
+        entries.insert(entries.end(), data + start, data + start + count);
+        entries.resize(prevOffset + classMapPageSize, -1);
+    }
+    return new ClassMap<Char>(std::move(pageOffsets), std::move(entries), size);
+}
+
+#ifndef OTAVA
+
+//  ===================================================================================================
+//  ReadClassMapData inflates a class map resource: a big-endian int32 size followed by the deflated
+//  big-endian int32 classes. The classes are inflated in one bulk read and byte-swapped in place.
+//  ===================================================================================================
+
+inline std::vector<int32_t> ReadClassMapData(util::BinaryResourcePtr& resource)
 {
-    std::string currentExecutableName = util::Path::GetFileName(util::GetFullPath(util::GetPathToExecutable()));
-    util::BinaryResourcePtr resource(currentExecutableName, classMapName);
     util::MemoryStream memoryStream(resource.Data(), resource.Size());
     util::BinaryStreamReader rawReader(memoryStream);
     int32_t size = rawReader.ReadInt();
-    int32_t* data = new int32_t[size];
+    std::vector<int32_t> data(size);
     util::DeflateStream compressedStream(util::CompressionMode::decompress, memoryStream);
-    util::BinaryStreamReader reader(compressedStream);
-    for (int64_t i = 0; i < size; ++i)
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(data.data());
+    int64_t byteCount = static_cast<int64_t>(size) * sizeof(int32_t);
+    int64_t bytesRead = 0;
+    while (bytesRead < byteCount)
+    {
+        int64_t n = compressedStream.Read(bytes + bytesRead, byteCount - bytesRead);
+        if (n <= 0)
+        {
+            throw std::runtime_error("class map resource '" + resource.ResourceName() + "' is truncated");
+        }
+        bytesRead += n;
+    }
+    for (int32_t& x : data)
     {
-        int32_t x = reader.ReadInt();
-        data[i] = x;
+        const uint8_t* b = reinterpret_cast<const uint8_t*>(&x);
+        x = static_cast<int32_t>((static_cast<uint32_t>(b[0]) << 24) | (static_cast<uint32_t>(b[1]) << 16) | (static_cast<uint32_t>(b[2]) << 8) | static_cast<uint32_t>(b[3]));
     }
-    ClassMap<Char>* classMap = new ClassMap<Char>(data, size);
-    return classMap;
+    return data;
+}
+
+template<typename Char>
+ClassMap<Char>* MakeClassMap(const std::string& classMapName)
+{
+    std::string currentExecutableName = util::Path::GetFileName(util::GetFullPath(util::GetPathToExecutable()));
+    util::BinaryResourcePtr resource(currentExecutableName, classMapName);
+    std::vector<int32_t> data = ReadClassMapData(resource);
+    return MakeClassMap<Char>(data.data(), static_cast<int32_t>(data.size()));
 }
 
 template<typename Char>
 ClassMap<Char>* MakeClassMap(const std::string& moduleFileName, const std::string& classMapName, util::ResourceFlags resourceFlags)
 {
     util::BinaryResourcePtr resource(moduleFileName, classMapName, resourceFlags);
-    util::MemoryStream memoryStream(resource.Data(), resource.Size());
-    util::BinaryStreamReader rawReader(memoryStream);
-    int32_t size = rawReader.ReadInt();
-    int32_t* data = new int32_t[size];
-    util::DeflateStream compressedStream(util::CompressionMode::decompress, memoryStream);
-    util::BinaryStreamReader reader(compressedStream);
-    for (int64_t i = 0; i < size; ++i)
-    {
-        int32_t x = reader.ReadInt();
-        data[i] = x;
-    }
-    ClassMap<Char>* classMap = new ClassMap<Char>(data, size);
-    return classMap;
+    std::vector<int32_t> data = ReadClassMapData(resource);
+    return MakeClassMap<Char>(data.data(), static_cast<int32_t>(data.size()));
 }
 
 #else
@@ -83,7 +156,8 @@ ClassMap<Char>* MakeClassMap(const std::string& classMapName)
 {
     int32_t size = 0;
     int32_t* data = read_lexer_resource(classMapName.c_str(), size);
-    ClassMap<Char>* cm = new ClassMap<Char>(data, size);
+    ClassMap<Char>* cm = MakeClassMap<Char>(data, size);
+    free_lexer_resource(data);
     return cm;
 }
 
@@ -0,0 +1,120 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.lexer.dfa.table;
+
+import std.core;
+import soul.lexer.base;
+import soul.lexer.token;
+
+export namespace soul::lexer {
+
+//  ===================================================================================================
+//  DfaTable is the transition table of a table-driven lexer: a stateCount x classCount matrix of next
+//  state ids stored row by row, -1 meaning no transition, and for each state the index of the rule
+//  it accepts or -1 if the state is not accepting.
+//  The rows are precomputed when the table is constructed: the row of a state holds the start of its
+//  transitions and the rule it accepts, so a lexer step needs one row load. Row(state).next[cls] is
+//  not range checked: it takes a class id of the class map generated with the table, which is either
+//  -1 or less than classCount.
+//  ===================================================================================================
+
+struct DfaRow
+{
+    const int32_t* next;
+    int32_t ruleIndex;
+};
+
+struct DfaTable
+{
+    DfaTable(int32_t stateCount_, int32_t classCount_, const int32_t* transitions_, const int32_t* ruleIndeces_) :
+        stateCount(stateCount_), classCount(classCount_), transitions(transitions_), ruleIndeces(ruleIndeces_), rows(stateCount_)
+    {
+        for (int32_t state = 0; state < stateCount; ++state)
+        {
+            rows[state].next = transitions + state * classCount;
+            rows[state].ruleIndex = ruleIndeces[state];
+        }
+    }
+    int32_t Next(int32_t state, int32_t cls) const
+    {
+        if (cls < 0 || cls >= classCount)
+        {
+            return -1;
+        }
+        return transitions[state * classCount + cls];
+    }
+    int32_t RuleIndex(int32_t state) const
+    {
+        return ruleIndeces[state];
+    }
+    const DfaRow& Row(int32_t state) const
+    {
+        return rows[state];
+    }
+    int32_t stateCount;
+    int32_t classCount;
+    const int32_t* transitions;
+    const int32_t* ruleIndeces;
+    std::vector<DfaRow> rows;
+};
+
+//  ===================================================================================================
+//  A table-driven machine provides its transition table and the token actions of its rules.
+//  Lexer::NextToken steps such a machine over the rows of its table and runs the token actions
+//  itself, without calling the NextState of the machine, TableNextState or Accept.
+//  ===================================================================================================
+
+template<typename Machine, typename Char>
+concept TableDrivenMachine = requires(int32_t ruleIndex, LexerBase<Char>& lexer)
+{
+    { Machine::Table() } -> std::same_as<const DfaTable&>;
+    Machine::GetTokenId(ruleIndex, lexer);
+};
+
+//  ===================================================================================================
+//  Accept runs the token action of the rule accepted by the current state the same way the switch
+//  generated for an accepting state does. Returns false if the action requested to continue
+//  scanning from the end of the current match.
+//  ===================================================================================================
+
+template<typename Machine, typename Char>
+bool Accept(int32_t ruleIndex, LexerBase<Char>& lexer)
+{
+    auto& token = lexer.CurrentToken();
+    auto prevMatch = token.match;
+    token.match = lexer.CurrentLexeme();
+    int64_t tokenId = Machine::GetTokenId(ruleIndex, lexer);
+    if (tokenId == CONTINUE_TOKEN)
+    {
+        token.id = CONTINUE_TOKEN;
+        return false;
+    }
+    else if (tokenId != INVALID_TOKEN)
+    {
+        token.id = tokenId;
+    }
+    else
+    {
+        token.match = prevMatch;
+    }
+    return true;
+}
+
+template<typename Machine, typename Char>
+int32_t TableNextState(const DfaTable& table, int32_t state, int32_t cls, LexerBase<Char>& lexer)
+{
+    int32_t ruleIndex = table.RuleIndex(state);
+    if (ruleIndex != -1)
+    {
+        if (!Accept<Machine, Char>(ruleIndex, lexer))
+        {
+            return -1;
+        }
+    }
+    return table.Next(state, cls);
+}
+
+} // namespace soul::lexer
@@ -22,13 +22,17 @@ int32_t FileMap::MapFile(const std::string& filePath)
 
 void FileMap::MapFile(const std::string& filePath, int32_t fileId)
 {
-    filePathMap[fileId] = filePath;
+    Shard& shard = GetShard(fileId);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    shard.filePathMap[fileId] = filePath;
 }
 
 const std::string& FileMap::GetFilePath(int32_t fileId) const
 {
-    auto it = filePathMap.find(fileId);
-    if (it != filePathMap.end())
+    const Shard& shard = GetShard(fileId);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.filePathMap.find(fileId);
+    if (it != shard.filePathMap.end())
     {
         return it->second;
     }
@@ -40,18 +44,24 @@ const std::string& FileMap::GetFilePath(int32_t fileId) const
 
 void FileMap::AddFileContent(int32_t fileId, std::u32string&& fileContent, std::vector<int>&& lineStartIndeces)
 {
-    fileContentsMap[fileId] = std::make_pair(std::move(fileContent), std::move(lineStartIndeces));
+    Shard& shard = GetShard(fileId);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    shard.fileContentsMap[fileId] = std::make_pair(std::move(fileContent), std::move(lineStartIndeces));
 }
 
 bool FileMap::HasFileContent(int32_t fileId) const
 {
-    return fileContentsMap.find(fileId) != fileContentsMap.end();
+    const Shard& shard = GetShard(fileId);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    return shard.fileContentsMap.find(fileId) != shard.fileContentsMap.end();
 }
 
 const std::pair<std::u32string, std::vector<int>>& FileMap::GetFileContent(int32_t fileId) const
 {
-    auto it = fileContentsMap.find(fileId);
-    if (it != fileContentsMap.end())
+    const Shard& shard = GetShard(fileId);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.fileContentsMap.find(fileId);
+    if (it != shard.fileContentsMap.end())
     {
         return it->second;
     }
@@ -88,7 +98,9 @@ void FileMap::ReadFile(int32_t fileId)
     std::string fileContent = util::ReadFile(filePath);
     std::u32string ucontent = util::ToUtf32(fileContent);
     std::vector<int> lineStartIndeces = ComputeLineStartIndeces(ucontent);
-    AddFileContent(fileId, std::move(ucontent), std::move(lineStartIndeces));
+    Shard& shard = GetShard(fileId);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    shard.fileContentsMap.try_emplace(fileId, std::move(ucontent), std::move(lineStartIndeces));
 }
 
 std::u32string FileMap::GetFileLine(int32_t fileId, int line) 
@@ -120,20 +132,20 @@ std::u32string FileMap::GetFileLine(int32_t fileId, int line)
     return trimmedLine;
 }
 
-std::mutex tokenMapMutex;
-
 void FileMap::SetTokens(int32_t fileId, TokenVec&& tokens)
 {
-    std::lock_guard<std::mutex> lock(tokenMapMutex);
-    tokenMap[fileId] = std::move(tokens);
+    Shard& shard = GetShard(fileId);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    shard.tokenMap[fileId] = std::move(tokens);
 }
 
 const TokenVec& FileMap::GetTokens(int32_t fileId) const
 {
-    std::lock_guard<std::mutex> lock(tokenMapMutex);
-    static TokenVec empty;
-    auto it = tokenMap.find(fileId);
-    if (it != tokenMap.cend())
+    const Shard& shard = GetShard(fileId);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    static const TokenVec empty;
+    auto it = shard.tokenMap.find(fileId);
+    if (it != shard.tokenMap.cend())
     {
         return it->second;
     }
@@ -13,6 +13,13 @@ export namespace soul::lexer {
 
 using TokenVec = std::vector<soul::lexer::Token<char32_t, LexerBase<char32_t>>>;
 
+//  ===================================================================================================
+//  FileMap is thread-safe, so files can be mapped and parsed concurrently: file ids are allocated
+//  with an atomic counter and the maps are split into shards selected by the file id, each shard
+//  guarded by its own mutex. A reference returned by GetFilePath, GetFileContent or GetTokens stays
+//  valid until the entry of that file id is replaced.
+//  ===================================================================================================
+
 class FileMap
 {
 public:
@@ -27,12 +34,20 @@ public:
     std::u32string GetFileLine(int32_t fileId, int line);
     void SetTokens(int32_t fileId, TokenVec&& tokens);
     const TokenVec& GetTokens(int32_t fileId) const;
-    int32_t NextFileId() const { return nextFileId; }
+    int32_t NextFileId() const { return nextFileId.load(); }
 private:
-    int32_t nextFileId;
-    std::map<int32_t, std::string> filePathMap;
-    std::map<int32_t, std::pair<std::u32string, std::vector<int>>> fileContentsMap;
-    std::map<int32_t, TokenVec> tokenMap;
+    static const int shardCount = 16;
+    struct Shard
+    {
+        mutable std::mutex mtx;
+        std::map<int32_t, std::string> filePathMap;
+        std::map<int32_t, std::pair<std::u32string, std::vector<int>>> fileContentsMap;
+        std::map<int32_t, TokenVec> tokenMap;
+    };
+    Shard& GetShard(int32_t fileId) { return shards[static_cast<uint32_t>(fileId) % shardCount]; }
+    const Shard& GetShard(int32_t fileId) const { return shards[static_cast<uint32_t>(fileId) % shardCount]; }
+    std::atomic<int32_t> nextFileId;
+    Shard shards[shardCount];
 };
 
 FileMap* GetGlobalFileMap();
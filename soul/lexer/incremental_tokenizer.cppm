@@ -0,0 +1,143 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.lexer.incremental;
+
+import std.core;
+
+export namespace soul::lexer {
+
+//  ===================================================================================================
+//  IncrementalTokenizer keeps the lines of a text tokenized with Lexer::TokenizeLine and the lexer
+//  state at the start and end of each line. When lines are replaced, inserted or removed, only the
+//  changed lines are tokenized again, followed by the lines after them until a line whose start
+//  state equals the end state of the line before it. From that line on the cached tokens are still
+//  valid, so the cost of an edit does not depend on the size of the text unless the edit changes
+//  the state of the rest of the text, for example by opening a block comment.
+//
+//  The tokens of a line point to the text of the line kept by the tokenizer, and remain valid until
+//  the line is changed or removed. The line numbers of the tokens are the numbers the lines had when
+//  they were tokenized; after lines have been inserted or removed above a line, use its index instead.
+//  The lexer is used for tokenizing only and should not be used for parsing at the same time.
+//  ===================================================================================================
+
+template<typename LexerT>
+class IncrementalTokenizer
+{
+public:
+    using Char = LexerT::CharType;
+    using TokenLineType = LexerT::TokenLineType;
+    using StringType = std::basic_string<Char>;
+
+    IncrementalTokenizer(LexerT& lexer_) : lexer(lexer_)
+    {
+    }
+    void SetText(const StringType& text)
+    {
+        std::vector<StringType> textLines;
+        std::size_t start = 0;
+        while (true)
+        {
+            std::size_t end = text.find('\n', start);
+            std::size_t lineEnd = end == StringType::npos ? text.length() : end;
+            if (lineEnd > start && text[lineEnd - 1] == '\r')
+            {
+                --lineEnd;
+            }
+            textLines.push_back(text.substr(start, lineEnd - start));
+            if (end == StringType::npos)
+            {
+                break;
+            }
+            start = end + 1;
+        }
+        SetLines(std::move(textLines));
+    }
+    void SetLines(std::vector<StringType>&& textLines)
+    {
+        lines.clear();
+        Update(0, 0, std::move(textLines));
+    }
+    int LineCount() const
+    {
+        return static_cast<int>(lines.size());
+    }
+    const StringType& GetLine(int lineIndex) const
+    {
+        return lines[lineIndex]->text;
+    }
+    const TokenLineType& GetTokenLine(int lineIndex) const
+    {
+        return lines[lineIndex]->tokenLine;
+    }
+    int ReplaceLine(int lineIndex, const StringType& text)
+    {
+        std::vector<StringType> textLines;
+        textLines.push_back(text);
+        return Update(lineIndex, 1, std::move(textLines));
+    }
+    int InsertLines(int lineIndex, std::vector<StringType>&& textLines)
+    {
+        return Update(lineIndex, 0, std::move(textLines));
+    }
+    int RemoveLines(int lineIndex, int count)
+    {
+        return Update(lineIndex, count, std::vector<StringType>());
+    }
+
+    //  ===============================================================================================
+    //  Update replaces removedCount lines starting at lineIndex with given lines and tokenizes them.
+    //  Returns the index of the line after the last line tokenized, so lines in range
+    //  [lineIndex, returned index) have changed tokens and need to be repainted or revalidated.
+    //  ===============================================================================================
+
+    int Update(int lineIndex, int removedCount, std::vector<StringType>&& textLines)
+    {
+        if (lineIndex < 0 || lineIndex > LineCount() || removedCount < 0 || lineIndex + removedCount > LineCount())
+        {
+            throw std::runtime_error("incremental tokenizer: invalid line range");
+        }
+        lines.erase(lines.begin() + lineIndex, lines.begin() + lineIndex + removedCount);
+        std::vector<std::unique_ptr<Line>> newLines;
+        for (StringType& text : textLines)
+        {
+            newLines.push_back(std::unique_ptr<Line>(new Line(std::move(text))));
+        }
+        lines.insert(lines.begin() + lineIndex, std::make_move_iterator(newLines.begin()), std::make_move_iterator(newLines.end()));
+        int changedEnd = lineIndex + static_cast<int>(textLines.size());
+        int state = 0;
+        if (lineIndex > 0)
+        {
+            state = lines[lineIndex - 1]->tokenLine.endState;
+        }
+        int i = lineIndex;
+        int n = LineCount();
+        while (i < n)
+        {
+            Line* line = lines[i].get();
+            if (i >= changedEnd && line->tokenized && line->tokenLine.startState == state)
+            {
+                break;
+            }
+            line->tokenLine = lexer.TokenizeLine(line->text, i + 1, state);
+            line->tokenized = true;
+            state = line->tokenLine.endState;
+            ++i;
+        }
+        return i;
+    }
+private:
+    struct Line
+    {
+        Line(StringType&& text_) : text(std::move(text_)), tokenLine(), tokenized(false) {}
+        StringType text;
+        TokenLineType tokenLine;
+        bool tokenized;
+    };
+    LexerT& lexer;
+    std::vector<std::unique_ptr<Line>> lines;
+};
+
+} // namespace soul::lexer
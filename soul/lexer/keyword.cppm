@@ -24,32 +24,71 @@ constexpr const Char* StrEnd(const Char* s)
 template<typename Char>
 struct Keyword
 {
-    Keyword() : str(nullptr), tokenID(INVALID_TOKEN) {}
-    Keyword(const Char* str_, int64_t tokenID_) : str(str_), tokenID(tokenID_) { }
+    constexpr Keyword() : str(nullptr), tokenID(INVALID_TOKEN) {}
+    constexpr Keyword(const Char* str_, int64_t tokenID_) : str(str_), tokenID(tokenID_) { }
     const Char* str;
     int64_t tokenID;
 };
 
+template<typename Char>
+struct KeywordEntry
+{
+    KeywordEntry() : str(nullptr), length(-1), tokenID(INVALID_TOKEN) {}
+    const Char* str;
+    int64_t length;
+    int64_t tokenID;
+};
+
+//  ===================================================================================================
+//  KeywordMap recognizes keywords with a perfect hash table built when the map is constructed:
+//  it searches for a hash seed and a power-of-two table size that map each keyword to a slot of
+//  its own. An identifier is then resolved with a length check, one hash and one memcmp.
+//  ===================================================================================================
+
 template<typename Char>
 class KeywordMap
 {
 public:
-    constexpr KeywordMap(const soul::lexer::Keyword<Char>* keywords_) : keywords(keywords_)
+    KeywordMap(const soul::lexer::Keyword<Char>* keywords_) : keywords(keywords_), seed(0), mask(0), minLength(std::numeric_limits<int64_t>::max()), maxLength(-1)
     {
+        int64_t count = 0;
         const soul::lexer::Keyword<Char>* kw = keywords;
         while (kw->str)
         {
-            Lexeme<Char> lexeme(kw->str, StrEnd(kw->str));
-            keywordMap[lexeme] = kw->tokenID;
+            int64_t length = StrEnd(kw->str) - kw->str;
+            minLength = std::min(minLength, length);
+            maxLength = std::max(maxLength, length);
+            ++count;
             ++kw;
         }
+        uint32_t size = 1;
+        while (size < 2 * count)
+        {
+            size <<= 1;
+        }
+        while (true)
+        {
+            for (uint32_t s = 1; s <= maxSeedsPerSize; ++s)
+            {
+                if (Build(size, s))
+                {
+                    return;
+                }
+            }
+            size <<= 1;
+        }
     }
     int64_t GetKeywordToken(const Lexeme<Char>& lexeme) const
     {
-        auto it = keywordMap.find(lexeme);
-        if (it != keywordMap.cend())
+        int64_t length = lexeme.end - lexeme.begin;
+        if (length < minLength || length > maxLength)
         {
-            return it->second;
+            return INVALID_TOKEN;
+        }
+        const KeywordEntry<Char>& entry = table[Hash(lexeme.begin, lexeme.end, seed) & mask];
+        if (entry.length == length && std::memcmp(entry.str, lexeme.begin, length * sizeof(Char)) == 0)
+        {
+            return entry.tokenID;
         }
         else
         {
@@ -57,8 +96,46 @@ public:
         }
     }
 private:
+    static const uint32_t maxSeedsPerSize = 64;
+    static uint32_t Hash(const Char* begin, const Char* end, uint32_t seed)
+    {
+        uint32_t h = 2166136261u ^ (seed * 16777619u);
+        for (const Char* p = begin; p != end; ++p)
+        {
+            h ^= static_cast<uint32_t>(*p);
+            h *= 16777619u;
+        }
+        return h ^ (h >> 15);
+    }
+    bool Build(uint32_t size, uint32_t s)
+    {
+        std::vector<KeywordEntry<Char>> t(size);
+        const soul::lexer::Keyword<Char>* kw = keywords;
+        while (kw->str)
+        {
+            const Char* end = StrEnd(kw->str);
+            KeywordEntry<Char>& entry = t[Hash(kw->str, end, s) & (size - 1)];
+            int64_t length = end - kw->str;
+            if (entry.str && (entry.length != length || std::memcmp(entry.str, kw->str, length * sizeof(Char)) != 0))
+            {
+                return false;
+            }
+            entry.str = kw->str;
+            entry.length = length;
+            entry.tokenID = kw->tokenID;
+            ++kw;
+        }
+        table = std::move(t);
+        seed = s;
+        mask = size - 1;
+        return true;
+    }
     const soul::lexer::Keyword<Char>* keywords;
-    std::map<Lexeme<Char>, int64_t, LexemeCompare<Char>> keywordMap;
+    std::vector<KeywordEntry<Char>> table;
+    uint32_t seed;
+    uint32_t mask;
+    int64_t minLength;
+    int64_t maxLength;
 };
 
 } // namespace soul::lexer
@@ -11,13 +11,16 @@ export import soul.lexer.keyword;
 export import soul.lexer.base;
 export import soul.lexer.classmap;
 export import soul.lexer.concepts;
+export import soul.lexer.dfa.table;
 export import soul.lexer.variables;
 export import soul.lexer.error;
 export import soul.lexer.parsing.log;
 export import soul.lexer.xml.parsing.log;
+export import soul.lexer.rule.profile;
 export import soul.lexer.file.map;
 export import soul.lexer.lexing.util;
 export import soul.lexer.test;
 export import soul.lexer.token.parser;
 export import soul.lexer.cls;
 export import soul.lexer.trivial;
+export import soul.lexer.incremental;
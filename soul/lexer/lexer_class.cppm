@@ -12,8 +12,10 @@ import soul.ast.slg;
 import soul.lexer.token.parser;
 import soul.lexer.base;
 import soul.lexer.concepts;
+import soul.lexer.dfa.table;
 import soul.lexer.error;
 import soul.lexer.parsing.log;
+import soul.lexer.rule.profile;
 import soul.lexer.token;
 import soul.ast.lexer.pos.pair;
 import soul.ast.span;
@@ -42,25 +44,64 @@ constexpr LexerFlags operator~(LexerFlags flag)
 
 bool parsing_error_thrown = false;
 
+//  ===================================================================================================
+//  LexerState is a snapshot of the lexer taken by PushState. It does not copy the token vector or the 
+//  rule context: tokens are only appended while the snapshot is active, so it records their count and 
+//  the state is restored by truncation. Tokens that are modified or erased while a snapshot is active 
+//  are saved to the token log of the lexer first. Likewise rule ids popped below the depth of the 
+//  innermost snapshot are saved to the rule context log. The farthest rule context is saved to the 
+//  innermost snapshot only when it is about to change.
+//  ===================================================================================================
+
 template<class Char, class LexerBaseT>
 struct LexerState
 {
-    LexerState(LexerBaseT* lexer) : token(lexer), line(0), lexeme(), pos(), tokens(), flags(), recordedPosPair(), farthestPos(), currentPos()
+    LexerState() : 
+        token(), line(0), lexeme(), pos(), tokenCount(0), tokenLogSize(0), flags(), recordedPosPair(), farthestPos(), ruleContextSize(0), 
+        ruleContextLogSize(0), farthestRuleContextSaved(false), farthestRuleContext(), currentPos()
     {
     }
     soul::lexer::Token<Char, LexerBaseT> token;
     int line;
     Lexeme<Char> lexeme;
     const Char* pos;
-    std::vector<soul::lexer::Token<Char, LexerBaseT>> tokens;
+    int64_t tokenCount;
+    int64_t tokenLogSize;
     LexerFlags flags;
     soul::ast::lexer::pos::pair::LexerPosPair recordedPosPair;
     int64_t farthestPos;
-    std::vector<int64_t> ruleContext;
+    int64_t ruleContextSize;
+    int64_t ruleContextLogSize;
+    bool farthestRuleContextSaved;
     std::vector<int64_t> farthestRuleContext;
     int64_t currentPos;
 };
 
+enum class TokenLogEntryKind
+{
+    modify, erase
+};
+
+template<class Char, class LexerBaseT>
+struct TokenLogEntry
+{
+    TokenLogEntry(TokenLogEntryKind kind_, int64_t index_) : kind(kind_), index(index_), tokens()
+    {
+    }
+    TokenLogEntryKind kind;
+    int64_t index;
+    std::vector<PackedToken> tokens;
+};
+
+struct RuleContextLogEntry
+{
+    RuleContextLogEntry(int64_t index_, int64_t ruleId_) : index(index_), ruleId(ruleId_)
+    {
+    }
+    int64_t index;
+    int64_t ruleId;
+};
+
 template<typename Stack>
     requires RuleStack<Stack>
 struct RuleGuard
@@ -117,7 +158,7 @@ public:
         file(-1),
         line(1),
         current(tokens.end()),
-        token(this),
+        token(),
         separatorChar('\0'),
         start(start_),
         end(end_),
@@ -128,19 +169,26 @@ public:
         tokenCollection(nullptr),
         keywordMap(nullptr),
         ruleNameMapPtr(nullptr),
+        ruleProfile(nullptr),
         farthestPos(GetPos()),
         log(nullptr),
         vars(),
-        state(this),
         ppHook(nullptr),
         skip(false),
-        commentTokenId(-1)
+        commentTokenId(-1),
+        dfaTable(GetDfaTable()),
+        lineStartsComputed(false),
+        tokenSetBits(0),
+        tokenSetBitsKnown(false)
     {
-        ComputeLineStarts();
+        if (end - start > std::numeric_limits<int32_t>::max())
+        {
+            throw std::runtime_error("soul::lexer::Lexer: input of file '" + fileName + "' is too large for 32-bit token offsets");
+        }
     }
     int64_t operator*() const
     {
-        return current->id;
+        return GetTokenId(*current);
     }
     void operator++()
     {
@@ -151,14 +199,13 @@ public:
             if (currentPos == recordedPosPair.end)
             {
                 current = tokens.end() - 1; // set current to last token whose id is END_TOKEN
-                auto token = tokens.back();
-                pos = token.match.end;
+                const PackedToken& token = tokens.back();
+                pos = start + token.offset + token.length;
             }
             else
             {
                 ++current;
             }
-            line = current->line;
         }
         else
         {
@@ -170,27 +217,22 @@ public:
             {
                 NextToken();
             }
-            else
-            {
-                line = current->line;
-            }
             int64_t p = GetPos();
             if (p > farthestPos)
             {
                 farthestPos = p;
+                SaveFarthestRuleContext();
                 farthestRuleContext = ruleContext;
             }
         }
     }
     int64_t GetPos() const override
     {
-        int32_t p = static_cast<int32_t>(current - tokens.begin());
-        return (static_cast<int64_t>(line) << 32) | static_cast<int64_t>(p);
+        return static_cast<int64_t>(current - tokens.begin());
     }
     void SetPos(int64_t pos)
     {
-        current = tokens.begin() + static_cast<int32_t>(pos);
-        line = static_cast<int32_t>(pos >> 32);
+        current = tokens.begin() + pos;
     }
     soul::ast::Span GetSpan() const override
     {
@@ -198,21 +240,35 @@ public:
     }
     soul::ast::Span GetSpan(int64_t pos) const override
     {
-        const auto& token = GetToken(pos);
-        return soul::ast::Span(static_cast<int>(token.match.begin - start), token.match.Length());
+        const PackedToken& token = GetPackedToken(pos);
+        return soul::ast::Span(static_cast<int>(token.offset), static_cast<int>(token.length));
     }
-    const soul::lexer::Token<Char, LexerBase<Char>>& GetToken(int64_t pos) const override
+    soul::lexer::Token<Char, LexerBase<Char>> GetToken(int64_t pos) const override
     {
-        int32_t tokenIndex = static_cast<int32_t>(pos);
-        if (tokenIndex >= 0 && tokenIndex < tokens.size())
+        return UnpackToken(GetPackedToken(pos));
+    }
+    const PackedToken& GetPackedToken(int64_t pos) const
+    {
+        if (pos >= 0 && pos < static_cast<int64_t>(tokens.size()))
         {
-            return tokens[tokenIndex];
+            return tokens[pos];
         }
         else
         {
             throw std::runtime_error("invalid token index");
         }
     }
+    int64_t GetTokenId(const PackedToken& token) const
+    {
+        if (token.id > 0)
+        {
+            return tokenSetBits | static_cast<int64_t>(static_cast<uint32_t>(token.id));
+        }
+        else
+        {
+            return token.id;
+        }
+    }
     const std::string& FileName() const override
     {
         return fileName;
@@ -265,6 +321,14 @@ public:
     {
         ruleNameMapPtr = ruleNameMapPtr_;
     }
+    RuleProfile* GetRuleProfile() const
+    {
+        return ruleProfile;
+    }
+    void SetRuleProfile(RuleProfile* ruleProfile_)
+    {
+        ruleProfile = ruleProfile_;
+    }
     LexerFlags Flags() const { return flags; }
     bool GetFlag(LexerFlags flag) const { return (flags & flag) != LexerFlags::none; }
     void SetFlag(LexerFlags flag) { flags = flags | flag; }
@@ -275,6 +339,10 @@ public:
     }
     void PopRule()
     {
+        if (!stateStack.empty() && static_cast<int64_t>(ruleContext.size()) <= stateStack.top().ruleContextSize)
+        {
+            ruleContextLog.push_back(RuleContextLogEntry(ruleContext.size() - 1, ruleContext.back()));
+        }
         ruleContext.pop_back();
     }
     int64_t GetKeywordToken(const Lexeme<Char>& lexeme) const override
@@ -298,6 +366,12 @@ public:
     }
     void EraseTail() override
     {
+        if (!stateStack.empty() && current + 1 != tokens.end())
+        {
+            TokenLogEntry<Char, LexerBase<Char>> entry(TokenLogEntryKind::erase, current + 1 - tokens.begin());
+            entry.tokens.assign(current + 1, tokens.end());
+            tokenLog.push_back(std::move(entry));
+        }
         tokens.erase(current + 1, tokens.end());
     }
     const Lexeme<Char>& CurrentLexeme() const override
@@ -334,20 +408,15 @@ public:
             return "<unknown token>";
         }
     }
-    inline int GetLine(int64_t pos) const
+    int GetLine(int64_t pos) const
     {
-        return pos >> 32;
+        return LineOf(GetPackedToken(pos).offset);
     }
     soul::ast::SourcePos GetSourcePos(int64_t pos) const
     {
-        const Char* s = start;
-        int line = GetLine(pos);
-        if (line < lineStarts.size())
-        {
-            s = lineStarts[line];
-        }
-        auto token = GetToken(pos);
-        int col = static_cast<int>(token.match.begin - s + 1);
+        const PackedToken& token = GetPackedToken(pos);
+        int line = LineOf(token.offset);
+        int col = static_cast<int>(token.offset - LineStarts()[line] + 1);
         return soul::ast::SourcePos(pos, file, line, col);
     }
     std::string ErrorLines(int64_t pos) const override
@@ -426,7 +495,8 @@ public:
     }
     std::string RestOfLine(int maxLineLength) const
     {
-        std::string restOfLine(util::ToUtf8(current->match.ToString()) + ToString(current->match.end, pos) + ToString(pos, LineEnd(end, pos)));
+        TokenType currentToken = UnpackToken(*current);
+        std::string restOfLine(util::ToUtf8(currentToken.match.ToString()) + ToString(currentToken.match.end, pos) + ToString(pos, LineEnd(end, pos)));
         if (maxLineLength != 0)
         {
             restOfLine = restOfLine.substr(0, maxLineLength);
@@ -435,12 +505,8 @@ public:
     }
     std::vector<int> GetLineStartIndeces() const override
     {
-        std::vector<int> lineStartIndeces;
-        for (int i = 0; i < lineStarts.size(); ++i)
-        {
-            lineStartIndeces.push_back(static_cast<int>(lineStarts[i] - start));
-        }
-        return lineStartIndeces;
+        const std::vector<uint32_t>& lineStarts = LineStarts();
+        return std::vector<int>(lineStarts.begin(), lineStarts.end());
     }
     soul::lexer::Variables* GetVariables() const override
     {
@@ -462,17 +528,36 @@ public:
     {
         return end;
     }
-    const std::vector<soul::lexer::Token<Char, LexerBase<Char>>>& Tokens() const
+    const std::vector<PackedToken>& PackedTokens() const
     {
         return tokens;
     }
+    std::vector<soul::lexer::Token<Char, LexerBase<Char>>> Tokens() const
+    {
+        std::vector<soul::lexer::Token<Char, LexerBase<Char>>> unpackedTokens;
+        unpackedTokens.reserve(tokens.size());
+        for (const PackedToken& token : tokens)
+        {
+            unpackedTokens.push_back(UnpackToken(token));
+        }
+        return unpackedTokens;
+    }
     std::vector<soul::lexer::Token<Char, LexerBase<Char>>> ReleaseTokens()
     {
-        return std::move(tokens);
+        std::vector<soul::lexer::Token<Char, LexerBase<Char>>> unpackedTokens = Tokens();
+        tokens.clear();
+        current = tokens.end();
+        return unpackedTokens;
     }
     void SetCurrentMatchEnd(const Char* end) override
     {
-        current->match.end = end;
+        if (!stateStack.empty())
+        {
+            TokenLogEntry<Char, LexerBase<Char>> entry(TokenLogEntryKind::modify, current - tokens.begin());
+            entry.tokens.push_back(*current);
+            tokenLog.push_back(std::move(entry));
+        }
+        current->length = static_cast<uint32_t>(end - (start + current->offset));
     }
     void Increment() override
     {
@@ -480,10 +565,7 @@ public:
     }
     void MoveToEnd() override
     {
-        TokenType endToken(END_TOKEN, this);
-        endToken.match.begin = end;
-        endToken.match.end = end;
-        tokens.push_back(endToken);
+        tokens.push_back(PackedToken(static_cast<uint32_t>(end - start), 0, END_TOKEN));
         current = tokens.end() - 1;
     }
     void BeginRecordedParse(const soul::ast::lexer::pos::pair::LexerPosPair& lexerPosPair) override
@@ -491,10 +573,7 @@ public:
         PushState();
         if (tokens.empty() || tokens.back().id != END_TOKEN)
         {
-            TokenType endToken(END_TOKEN, this);
-            endToken.match.begin = end;
-            endToken.match.end = end;
-            tokens.push_back(endToken);
+            tokens.push_back(PackedToken(static_cast<uint32_t>(end - start), 0, END_TOKEN));
         }
         recordedPosPair = lexerPosPair;
         SetPos(recordedPosPair.start);
@@ -523,36 +602,11 @@ public:
     {
         SetState(stateStack.top());
         stateStack.pop();
-    }
-    LexerState<Char, LexerBase<Char>> GetState()
-    {
-        LexerState<Char, LexerBase<Char>> state(this);
-        state.token = token;
-        state.line = line;
-        state.lexeme = lexeme;
-        state.pos = pos;
-        state.tokens = tokens;
-        state.flags = flags;
-        state.recordedPosPair = recordedPosPair;
-        state.farthestPos = farthestPos;
-        state.ruleContext = ruleContext;
-        state.farthestRuleContext = farthestRuleContext;
-        state.currentPos = GetPos();
-        return state;
-    }
-    void SetState(const LexerState<Char, LexerBase<Char>>& state)
-    {
-        token = state.token;
-        line = state.line;
-        lexeme = state.lexeme;
-        pos = state.pos;
-        tokens = state.tokens;
-        flags = state.flags;
-        recordedPosPair = state.recordedPosPair;
-        farthestPos = state.farthestPos;
-        ruleContext = state.ruleContext;
-        farthestRuleContext = state.farthestRuleContext;
-        SetPos(state.currentPos);
+        if (stateStack.empty())
+        {
+            tokenLog.clear();
+            ruleContextLog.clear();
+        }
     }
     void Skip(bool skip_) 
     {
@@ -614,7 +668,7 @@ public:
                 tokenLine.tokens.push_back(token);
                 if (pos + 1 < end && *pos == '\"' && *(pos + 1) == '\\' && prevPrevState == 13 && prevState == 71)
                 {
-                    TokenType tok(nullptr);
+                    TokenType tok;
                     tok.match.begin = pos;
                     tok.match.end = pos + 2;
                     tokenLine.tokens.push_back(tok);
@@ -659,6 +713,84 @@ public:
         return tokenLine;
     }
 private:
+    LexerState<Char, LexerBase<Char>> GetState()
+    {
+        LexerState<Char, LexerBase<Char>> state;
+        state.token = token;
+        state.line = line;
+        state.lexeme = lexeme;
+        state.pos = pos;
+        state.tokenCount = tokens.size();
+        state.tokenLogSize = tokenLog.size();
+        state.flags = flags;
+        state.recordedPosPair = recordedPosPair;
+        state.farthestPos = farthestPos;
+        state.ruleContextSize = ruleContext.size();
+        state.ruleContextLogSize = ruleContextLog.size();
+        state.currentPos = GetPos();
+        return state;
+    }
+    void SetState(LexerState<Char, LexerBase<Char>>& state)
+    {
+        token = state.token;
+        line = state.line;
+        lexeme = state.lexeme;
+        pos = state.pos;
+        while (static_cast<int64_t>(tokenLog.size()) > state.tokenLogSize)
+        {
+            TokenLogEntry<Char, LexerBase<Char>>& entry = tokenLog.back();
+            switch (entry.kind)
+            {
+                case TokenLogEntryKind::modify:
+                {
+                    tokens[entry.index] = entry.tokens.front();
+                    break;
+                }
+                case TokenLogEntryKind::erase:
+                {
+                    tokens.erase(tokens.begin() + entry.index, tokens.end());
+                    tokens.insert(tokens.end(), entry.tokens.begin(), entry.tokens.end());
+                    break;
+                }
+            }
+            tokenLog.pop_back();
+        }
+        if (static_cast<int64_t>(tokens.size()) > state.tokenCount)
+        {
+            tokens.erase(tokens.begin() + state.tokenCount, tokens.end());
+        }
+        flags = state.flags;
+        recordedPosPair = state.recordedPosPair;
+        farthestPos = state.farthestPos;
+        while (static_cast<int64_t>(ruleContextLog.size()) > state.ruleContextLogSize)
+        {
+            const RuleContextLogEntry& entry = ruleContextLog.back();
+            ruleContext.resize(entry.index);
+            ruleContext.push_back(entry.ruleId);
+            ruleContextLog.pop_back();
+        }
+        if (static_cast<int64_t>(ruleContext.size()) > state.ruleContextSize)
+        {
+            ruleContext.erase(ruleContext.begin() + state.ruleContextSize, ruleContext.end());
+        }
+        if (state.farthestRuleContextSaved)
+        {
+            std::swap(farthestRuleContext, state.farthestRuleContext);
+        }
+        SetPos(state.currentPos);
+    }
+    void SaveFarthestRuleContext()
+    {
+        if (!stateStack.empty())
+        {
+            LexerState<Char, LexerBase<Char>>& state = stateStack.top();
+            if (!state.farthestRuleContextSaved)
+            {
+                std::swap(state.farthestRuleContext, farthestRuleContext);
+                state.farthestRuleContextSaved = true;
+            }
+        }
+    }
     void NextToken()
     {
         int state = 0;
@@ -687,7 +819,7 @@ private:
             {
                 lexeme.end = pos + 1;
             }
-            state = Machine::NextState(state, c, *static_cast<LexerBase<Char>*>(this));
+            state = NextState(state, c);
             if (state == -1)
             {
                 if (token.id == soul::lexer::CONTINUE_TOKEN)
@@ -718,7 +850,7 @@ private:
                 {
                     if (!skip)
                     {
-                        tokens.push_back(token);
+                        tokens.push_back(PackToken(token));
                         current = tokens.end() - 1;
                         pos = token.match.end;
                         return;
@@ -737,18 +869,15 @@ private:
             ++pos;
         }
         token.id = soul::lexer::INVALID_TOKEN;
-        state = Machine::NextState(state, '\0', *this);
+        state = NextState(state, '\0');
         int64_t p = -1;
         if (token.id != soul::lexer::INVALID_TOKEN && token.id != soul::lexer::CONTINUE_TOKEN)
         {
-            tokens.push_back(token);
+            tokens.push_back(PackToken(token));
             current = tokens.end() - 1;
             p = GetPos();
         }
-        TokenType endToken(soul::lexer::END_TOKEN, this);
-        endToken.match.begin = end;
-        endToken.match.end = end;
-        tokens.push_back(endToken);
+        tokens.push_back(PackedToken(static_cast<uint32_t>(end - start), 0, END_TOKEN));
         if (p == -1)
         {
             current = tokens.end() - 1;
@@ -756,27 +885,151 @@ private:
         }
         SetPos(p);
     }
-    void ComputeLineStarts()
+    PackedToken PackToken(const TokenType& token)
+    {
+        return PackedToken(static_cast<uint32_t>(token.match.begin - start), static_cast<uint32_t>(token.match.end - token.match.begin), PackTokenId(token.id));
+    }
+    int32_t PackTokenId(int64_t tokenId)
     {
-        lineStarts.push_back(pos);
-        const Char* p = pos;
-        bool startOfLine = true;
+        if (tokenId <= 0)
+        {
+            return static_cast<int32_t>(tokenId);
+        }
+        int64_t setBits = tokenId & ~static_cast<int64_t>(0xFFFFFFFF);
+        int32_t id = static_cast<int32_t>(tokenId & 0xFFFFFFFF);
+        if (!tokenSetBitsKnown)
+        {
+            tokenSetBits = setBits;
+            tokenSetBitsKnown = true;
+        }
+        if (setBits != tokenSetBits || id <= 0)
+        {
+            throw std::runtime_error("soul::lexer::Lexer: token id " + std::to_string(tokenId) + " does not belong to the token set of the lexer");
+        }
+        return id;
+    }
+    TokenType UnpackToken(const PackedToken& token) const
+    {
+        const Char* begin = start + token.offset;
+        return TokenType(GetTokenId(token), Lexeme<Char>(begin, begin + token.length), LineOf(token.offset));
+    }
+    static const DfaTable* GetDfaTable()
+    {
+        if constexpr (TableDrivenMachine<Machine, Char>)
+        {
+            return &Machine::Table();
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+    int32_t NextState(int32_t state, Char c)
+    {
+        if constexpr (TableDrivenMachine<Machine, Char>)
+        {
+            const DfaRow& row = dfaTable->Row(state);
+            if (row.ruleIndex != -1 && !AcceptRule(row.ruleIndex))
+            {
+                return -1;
+            }
+            int32_t cls = classMap->GetClass(c);
+            if (cls == -1)
+            {
+                return -1;
+            }
+            return row.next[cls];
+        }
+        else
+        {
+            return Machine::NextState(state, c, *static_cast<LexerBase<Char>*>(this));
+        }
+    }
+    bool AcceptRule(int32_t ruleIndex)
+    {
+        auto prevMatch = token.match;
+        token.match = lexeme;
+        int64_t tokenId = Machine::GetTokenId(ruleIndex, *this);
+        if (tokenId == CONTINUE_TOKEN)
+        {
+            token.id = CONTINUE_TOKEN;
+            return false;
+        }
+        else if (tokenId != INVALID_TOKEN)
+        {
+            token.id = tokenId;
+        }
+        else
+        {
+            token.match = prevMatch;
+        }
+        return true;
+    }
+    //  ===============================================================================================
+    //  The line start offsets are computed on first use, that is when a source position or the line
+    //  starts of the file are requested, so a successful parse does not scan the input twice.
+    //  Element i is the offset of line i (the first line has number 1), the last element is the
+    //  offset of the end of input.
+    //  ===============================================================================================
+    int LineOf(uint32_t offset) const
+    {
+        const std::vector<uint32_t>& lineStarts = LineStarts();
+        if (lineStarts.size() <= 2)
+        {
+            return 1;
+        }
+        auto it = std::upper_bound(lineStarts.begin() + 1, lineStarts.end() - 1, offset);
+        return static_cast<int>(it - lineStarts.begin()) - 1;
+    }
+    const std::vector<uint32_t>& LineStarts() const
+    {
+        if (!lineStartsComputed)
+        {
+            ComputeLineStarts();
+        }
+        return lineStarts;
+    }
+    void ComputeLineStarts() const
+    {
+        lineStarts.clear();
+        lineStarts.push_back(0);
+        const Char* p = start;
+        if (p != end)
+        {
+            lineStarts.push_back(0);
+        }
         while (p != end)
         {
-            if (startOfLine)
+            p = FindNewLine(p);
+            if (p != end)
             {
-                lineStarts.push_back(p);
+                ++p;
+                if (p != end)
+                {
+                    lineStarts.push_back(static_cast<uint32_t>(p - start));
+                }
             }
-            startOfLine = *p == '\n';
-            ++p;
         }
-        lineStarts.push_back(end);
+        lineStarts.push_back(static_cast<uint32_t>(end - start));
+        lineStartsComputed = true;
+    }
+    const Char* FindNewLine(const Char* p) const
+    {
+        if constexpr (sizeof(Char) == 1)
+        {
+            const void* nl = std::memchr(p, '\n', end - p);
+            return nl ? static_cast<const Char*>(nl) : end;
+        }
+        else
+        {
+            return std::find(p, end, static_cast<Char>('\n'));
+        }
     }
     LexerFlags flags;
     soul::ast::lexer::pos::pair::LexerPosPair recordedPosPair;
     Char separatorChar;
-    std::vector<soul::lexer::Token<Char, LexerBase<Char>>> tokens;
-    std::vector<soul::lexer::Token<Char, LexerBase<Char>>>::iterator current;
+    std::vector<PackedToken> tokens;
+    std::vector<PackedToken>::iterator current;
     soul::lexer::Token<Char, LexerBase<Char>> token;
     Lexeme<Char> lexeme;
     int32_t file;
@@ -792,16 +1045,22 @@ private:
     int64_t farthestPos;
     std::vector<int64_t> ruleContext;
     std::vector<int64_t> farthestRuleContext;
-    std::vector<const Char*> lineStarts;
+    mutable std::vector<uint32_t> lineStarts;
+    mutable bool lineStartsComputed;
     std::map<int64_t, std::string>* ruleNameMapPtr;
+    RuleProfile* ruleProfile;
     ParsingLog* log;
     Machine::Variables vars;
-    LexerState<Char, LexerBase<Char>> state;
     std::stack<LexerState<Char, LexerBase<Char>>> stateStack;
+    std::vector<TokenLogEntry<Char, LexerBase<Char>>> tokenLog;
+    std::vector<RuleContextLogEntry> ruleContextLog;
     PPHook ppHook;
     bool skip;
     int64_t commentTokenId;
     std::set<int> blockCommentStates;
+    const DfaTable* dfaTable;
+    int64_t tokenSetBits;
+    bool tokenSetBitsKnown;
 };
 
 inline std::string GetEndTokenInfo()
@@ -0,0 +1,106 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.lexer.rule.profile;
+
+import util;
+
+namespace soul::lexer {
+
+RuleCounters::RuleCounters() : ruleId(-1), entries(0), successes(0), backtracks(0), tokens(0), time(0), activeCount(0), startTime()
+{
+}
+
+RuleProfile::RuleProfile(std::map<int64_t, std::string>* ruleNameMapPtr_) : ruleNameMapPtr(ruleNameMapPtr_)
+{
+    if (!ruleNameMapPtr) return;
+    for (const auto& rule : *ruleNameMapPtr)
+    {
+        int64_t ruleId = rule.first;
+        int32_t parserId = static_cast<int32_t>(ruleId >> 32);
+        uint32_t ruleIndex = static_cast<uint32_t>(ruleId);
+        auto it = std::find_if(parsers.begin(), parsers.end(), [&](const ParserCounters& parser) { return parser.parserId == parserId; });
+        if (it == parsers.end())
+        {
+            parsers.push_back(ParserCounters());
+            it = parsers.end() - 1;
+            it->parserId = parserId;
+        }
+        if (ruleIndex >= it->rules.size())
+        {
+            it->rules.resize(static_cast<std::size_t>(ruleIndex) + 1);
+        }
+        it->rules[ruleIndex].ruleId = ruleId;
+    }
+}
+
+void RuleProfile::Merge(const RuleProfile& that)
+{
+    for (const ParserCounters& parser : that.parsers)
+    {
+        for (const RuleCounters& rule : parser.rules)
+        {
+            if (rule.ruleId == -1) continue;
+            RuleCounters* counters = GetCounters(rule.ruleId);
+            if (counters)
+            {
+                counters->entries += rule.entries;
+                counters->successes += rule.successes;
+                counters->backtracks += rule.backtracks;
+                counters->tokens += rule.tokens;
+                counters->time += rule.time;
+            }
+        }
+    }
+}
+
+void RuleProfile::Reset()
+{
+    for (ParserCounters& parser : parsers)
+    {
+        for (RuleCounters& rule : parser.rules)
+        {
+            int64_t ruleId = rule.ruleId;
+            rule = RuleCounters();
+            rule.ruleId = ruleId;
+        }
+    }
+}
+
+void RuleProfile::Print(util::CodeFormatter& formatter) const
+{
+    std::vector<const RuleCounters*> rules;
+    for (const ParserCounters& parser : parsers)
+    {
+        for (const RuleCounters& rule : parser.rules)
+        {
+            if (rule.ruleId != -1 && rule.entries > 0)
+            {
+                rules.push_back(&rule);
+            }
+        }
+    }
+    std::sort(rules.begin(), rules.end(), [](const RuleCounters* left, const RuleCounters* right) { return left->time > right->time; });
+    formatter.WriteLine(util::Format("time (us)", 12, util::FormatWidth::min, util::FormatJustify::right) + util::Format("entries", 12, util::FormatWidth::min, util::FormatJustify::right) +
+        util::Format("successes", 12, util::FormatWidth::min, util::FormatJustify::right) + util::Format("backtracks", 12, util::FormatWidth::min, util::FormatJustify::right) +
+        util::Format("tokens", 12, util::FormatWidth::min, util::FormatJustify::right) + "  rule");
+    for (const RuleCounters* rule : rules)
+    {
+        std::string ruleName = std::to_string(rule->ruleId);
+        auto it = ruleNameMapPtr->find(rule->ruleId);
+        if (it != ruleNameMapPtr->end())
+        {
+            ruleName = it->second;
+        }
+        int64_t us = std::chrono::duration_cast<std::chrono::microseconds>(rule->time).count();
+        formatter.WriteLine(util::Format(std::to_string(us), 12, util::FormatWidth::min, util::FormatJustify::right) +
+            util::Format(std::to_string(rule->entries), 12, util::FormatWidth::min, util::FormatJustify::right) +
+            util::Format(std::to_string(rule->successes), 12, util::FormatWidth::min, util::FormatJustify::right) +
+            util::Format(std::to_string(rule->backtracks), 12, util::FormatWidth::min, util::FormatJustify::right) +
+            util::Format(std::to_string(rule->tokens), 12, util::FormatWidth::min, util::FormatJustify::right) + "  " + ruleName);
+    }
+}
+
+} // namespace soul::lexer
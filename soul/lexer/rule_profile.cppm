@@ -0,0 +1,124 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.lexer.rule.profile;
+
+import std.core;
+import util.code.formatter;
+
+export namespace soul::lexer {
+
+//  ===================================================================================================
+//  RuleProfile collects per-rule counters of a generated parser: how many times a rule was entered,
+//  how many times it matched and how many times it failed so that the parser had to backtrack, the
+//  number of tokens consumed by its matches, and the inclusive time spent in it. Time spent in
+//  recursive activations of a rule is counted once, by its outermost activation.
+//
+//  The counters are kept in arrays indexed by the rule index part (the low 32 bits) of the rule id,
+//  one array per parser (the high 32 bits). The arrays are allocated in the constructor from the rule
+//  name map of the parser, so collecting does not allocate. Rules not in the map are not profiled.
+//
+//  Profiling is compiled in only when the generated parser is compiled with
+//  SOUL_PARSER_PROFILING_SUPPORT defined, and enabled by setting a profile to the lexer with
+//  Lexer::SetRuleProfile. Of the parsers in this tree only the XPath parser contains the profiling
+//  guards. A profile is not thread-safe: each thread should use its own and merge them afterwards.
+//  ===================================================================================================
+
+struct RuleCounters
+{
+    RuleCounters();
+    int64_t ruleId;
+    int64_t entries;
+    int64_t successes;
+    int64_t backtracks;
+    int64_t tokens;
+    std::chrono::nanoseconds time;
+    int32_t activeCount;
+    std::chrono::steady_clock::time_point startTime;
+};
+
+class RuleProfile
+{
+public:
+    RuleProfile(std::map<int64_t, std::string>* ruleNameMapPtr_);
+    RuleCounters* GetCounters(int64_t ruleId)
+    {
+        int32_t parserId = static_cast<int32_t>(ruleId >> 32);
+        uint32_t ruleIndex = static_cast<uint32_t>(ruleId);
+        for (ParserCounters& parser : parsers)
+        {
+            if (parser.parserId == parserId)
+            {
+                if (ruleIndex < parser.rules.size() && parser.rules[ruleIndex].ruleId == ruleId)
+                {
+                    return &parser.rules[ruleIndex];
+                }
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+    void Merge(const RuleProfile& that);
+    void Reset();
+    void Print(util::CodeFormatter& formatter) const;
+private:
+    struct ParserCounters
+    {
+        int32_t parserId;
+        std::vector<RuleCounters> rules;
+    };
+    std::map<int64_t, std::string>* ruleNameMapPtr;
+    std::vector<ParserCounters> parsers;
+};
+
+template<typename LexerT>
+class RuleProfileGuard
+{
+public:
+    RuleProfileGuard(LexerT& lexer_, int64_t ruleId) : lexer(lexer_), counters(nullptr), startPos(0), success(false)
+    {
+        RuleProfile* profile = lexer.GetRuleProfile();
+        if (profile)
+        {
+            counters = profile->GetCounters(ruleId);
+            if (counters)
+            {
+                ++counters->entries;
+                startPos = lexer.GetPos();
+                if (counters->activeCount++ == 0)
+                {
+                    counters->startTime = std::chrono::steady_clock::now();
+                }
+            }
+        }
+    }
+    ~RuleProfileGuard()
+    {
+        if (counters)
+        {
+            if (success)
+            {
+                ++counters->successes;
+                counters->tokens += static_cast<int32_t>(lexer.GetPos()) - static_cast<int32_t>(startPos);
+            }
+            else
+            {
+                ++counters->backtracks;
+            }
+            if (--counters->activeCount == 0)
+            {
+                counters->time += std::chrono::steady_clock::now() - counters->startTime;
+            }
+        }
+    }
+    void SetSuccess() { success = true; }
+private:
+    LexerT& lexer;
+    RuleCounters* counters;
+    int64_t startPos;
+    bool success;
+};
+
+} // namespace soul::lexer
@@ -20,28 +20,44 @@ struct Token
 {
     using CharType = Char;
 
-    Token(LexerBaseT* lexer_) : match(), lexer(lexer_), id(INVALID_TOKEN), line(1) {}
-    Token(int64_t id_, LexerBaseT* lexer_) : match(), lexer(lexer_), id(id_), line(1) {}
-    Token(int64_t id_, const Lexeme<Char>& match_, LexerBaseT* lexer_, int line_) : match(match_), lexer(lexer_), id(id_), line(line_) {}
+    Token() : match(), id(INVALID_TOKEN), line(1) {}
+    Token(int64_t id_) : match(), id(id_), line(1) {}
+    Token(int64_t id_, const Lexeme<Char>& match_, int line_) : match(match_), id(id_), line(line_) {}
     std::basic_string<Char> ToString() const { return match.ToString(); }
     Char Chr() const { return *match.begin; }
-    int8_t ToSByte() const { return ParseSByte(match.begin, match.end, lexer, line); }
-    uint8_t ToByte() const { return ParseByte(match.begin, match.end, lexer, line); }
-    int16_t ToShort() const { return ParseShort(match.begin, match.end, lexer, line); }
-    uint16_t ToUShort() const { return ParseUShort(match.begin, match.end, lexer, line); }
-    int32_t ToInt() const { return ParseInt(match.begin, match.end, lexer, line); }
-    uint32_t ToUInt() const { return ParseUInt(match.begin, match.end, lexer, line); }
-    int64_t ToLong() const { return ParseLong(match.begin, match.end, lexer, line); }
-    uint64_t ToULong() const { return ParseULong(match.begin, match.end, lexer, line); }
-    uint64_t ToHexULong() const { return ParseHexULong(match.begin, match.end, lexer, line); }
-    uint64_t ToOctalULong() const { return ParseOctalULong(match.begin, match.end, lexer, line); }
-    float ToFloat() const { return ParseFloat(match.begin, match.end, lexer, line); }
-    double ToDouble() const { return ParseDouble(match.begin, match.end, lexer, line); }
-    bool ToBool() const { return ParseBool(match.begin, match.end, lexer, line); }
+    int8_t ToSByte(LexerBaseT* lexer) const { return ParseSByte(match.begin, match.end, lexer, line); }
+    uint8_t ToByte(LexerBaseT* lexer) const { return ParseByte(match.begin, match.end, lexer, line); }
+    int16_t ToShort(LexerBaseT* lexer) const { return ParseShort(match.begin, match.end, lexer, line); }
+    uint16_t ToUShort(LexerBaseT* lexer) const { return ParseUShort(match.begin, match.end, lexer, line); }
+    int32_t ToInt(LexerBaseT* lexer) const { return ParseInt(match.begin, match.end, lexer, line); }
+    uint32_t ToUInt(LexerBaseT* lexer) const { return ParseUInt(match.begin, match.end, lexer, line); }
+    int64_t ToLong(LexerBaseT* lexer) const { return ParseLong(match.begin, match.end, lexer, line); }
+    uint64_t ToULong(LexerBaseT* lexer) const { return ParseULong(match.begin, match.end, lexer, line); }
+    uint64_t ToHexULong(LexerBaseT* lexer) const { return ParseHexULong(match.begin, match.end, lexer, line); }
+    uint64_t ToOctalULong(LexerBaseT* lexer) const { return ParseOctalULong(match.begin, match.end, lexer, line); }
+    float ToFloat(LexerBaseT* lexer) const { return ParseFloat(match.begin, match.end, lexer, line); }
+    double ToDouble(LexerBaseT* lexer) const { return ParseDouble(match.begin, match.end, lexer, line); }
+    bool ToBool(LexerBaseT* lexer) const { return ParseBool(match.begin, match.end, lexer, line); }
     Lexeme<Char> match;
-    LexerBaseT* lexer;
     int64_t id;
-    int line;
+    int32_t line;
+};
+
+//  ===================================================================================================
+//  PackedToken is the form in which the lexer stores the tokens it has read: the offset and length of
+//  the match in the source buffer and the low 32 bits of the token id. The token ids of a lexer share 
+//  the token set id in their high 32 bits, so the lexer maps a packed id back to the full id when it 
+//  is requested. The line of a token is not stored but computed from the line starts of the source 
+//  when the token is requested. A packed token takes 12 bytes instead of the 32 bytes of Token.
+//  ===================================================================================================
+
+struct PackedToken
+{
+    PackedToken() : offset(0), length(0), id(static_cast<int32_t>(INVALID_TOKEN)) {}
+    PackedToken(uint32_t offset_, uint32_t length_, int32_t id_) : offset(offset_), length(length_), id(id_) {}
+    uint32_t offset;
+    uint32_t length;
+    int32_t id;
 };
 
 template<typename Char, typename LexerBaseT>
@@ -6,6 +6,7 @@
 export module soul.parser.match;
 
 import std.core;
+import soul.parser.value;
 
 export namespace soul::parser {
 
@@ -13,8 +14,16 @@ struct Match
 {
     Match(bool hit_) : hit(hit_), value(nullptr) {}
     Match(bool hit_, void* value_) : hit(hit_), value(value_) {}
+    template<InlineValueType T>
+    Match(bool hit_, const InlineValue<T>& inlineValue_) : hit(hit_), inlineValue(static_cast<uint64_t>(inlineValue_.value)) {}
+    template<InlineValueType T>
+    InlineValue<T> GetInlineValue() const { return hit ? InlineValue<T>(static_cast<T>(inlineValue)) : InlineValue<T>(); }
     bool hit;
-    void* value;
+    union
+    {
+        void* value;
+        uint64_t inlineValue;
+    };
 };
 
 } // namespace soul::parser;
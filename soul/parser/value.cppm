@@ -16,4 +16,22 @@ struct Value
     T value;
 };
 
+template<class T>
+concept InlineValueType = std::is_integral_v<T> || std::is_enum_v<T>;
+
+//  ===============================================================================================
+//  InlineValue is the allocation-free counterpart of Value for scalar rule results:
+//  characters, booleans, integers and enumerations. It is stored in the Match itself.
+//  The generated XPath parser returns its axis results this way. XML documents are parsed by
+//  the hand-written XmlScanner, which does not produce Match values at all.
+//  ===============================================================================================
+
+template<InlineValueType T>
+struct InlineValue
+{
+    InlineValue() : value() {}
+    InlineValue(const T& value_) : value(value_) {}
+    T value;
+};
+
 } // namespace soul::parser
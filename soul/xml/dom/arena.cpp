@@ -0,0 +1,137 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.xml.arena;
+
+namespace soul::xml {
+
+Arena::Arena() : Arena(defaultArenaBlockSize)
+{
+}
+
+Arena::Arena(int64_t blockSize_) : blockSize(blockSize_), free(nullptr), end(nullptr), size(0)
+{
+}
+
+void* Arena::Allocate(int64_t size_, int64_t alignment)
+{
+    char* p = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(free) + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+    if (!free || p + size_ > end)
+    {
+        NewBlock(size_ + alignment);
+        p = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(free) + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+    }
+    free = p + size_;
+    size += size_;
+    return p;
+}
+
+void Arena::NewBlock(int64_t minSize)
+{
+    int64_t n = std::max(blockSize, minSize);
+    blocks.push_back(std::unique_ptr<char[]>(new char[n]));
+    free = blocks.back().get();
+    end = free + n;
+}
+
+ArenaString::ArenaString() : chars(nullptr), length(0), ownsChars(false)
+{
+}
+
+ArenaString::ArenaString(std::string_view str, Arena* arena) : chars(nullptr), length(0), ownsChars(false)
+{
+    if (str.length() > std::numeric_limits<uint32_t>::max())
+    {
+        throw std::length_error("soul::xml::ArenaString: string too long");
+    }
+    length = static_cast<uint32_t>(str.length());
+    if (IsInline())
+    {
+        std::memcpy(inlineChars, str.data(), length);
+    }
+    else
+    {
+        char* p = nullptr;
+        if (arena)
+        {
+            p = static_cast<char*>(arena->Allocate(length, 1));
+        }
+        else
+        {
+            p = new char[length];
+            ownsChars = true;
+        }
+        std::memcpy(p, str.data(), length);
+        chars = p;
+    }
+}
+
+ArenaString::ArenaString(ArenaString&& that) noexcept : chars(nullptr), length(0), ownsChars(false)
+{
+    MoveFrom(that);
+}
+
+ArenaString& ArenaString::operator=(ArenaString&& that) noexcept
+{
+    if (this != &that)
+    {
+        Release();
+        MoveFrom(that);
+    }
+    return *this;
+}
+
+ArenaString::~ArenaString()
+{
+    Release();
+}
+
+void ArenaString::Assign(std::string_view str, Arena* arena)
+{
+    ArenaString that(str, arena); // str may refer to the characters of this string
+    Release();
+    MoveFrom(that);
+}
+
+void ArenaString::MoveFrom(ArenaString& that)
+{
+    length = that.length;
+    ownsChars = that.ownsChars;
+    if (IsInline())
+    {
+        std::memcpy(inlineChars, that.inlineChars, length);
+    }
+    else
+    {
+        chars = that.chars;
+    }
+    that.chars = nullptr;
+    that.length = 0;
+    that.ownsChars = false;
+}
+
+void ArenaString::Release()
+{
+    if (ownsChars)
+    {
+        delete[] chars;
+        ownsChars = false;
+    }
+    chars = nullptr;
+    length = 0;
+}
+
+void AddArenaRefs(ArenaRefs& arenaRefs, const ArenaRefs& refsToAdd)
+{
+    for (const auto& arena : refsToAdd)
+    {
+        if (std::find(arenaRefs.begin(), arenaRefs.end(), arena) == arenaRefs.end())
+        {
+            arenaRefs.push_back(arena);
+        }
+    }
+}
+
+} // namespace soul::xml
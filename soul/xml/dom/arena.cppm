@@ -0,0 +1,121 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.xml.arena;
+
+import std.core;
+
+export namespace soul::xml {
+
+//  ===================================================================================================
+//  Arena is a monotonic allocator for the nodes of a document and for their text and attributes. 
+//  Memory is allocated from blocks of fixed size and released all at once when the arena is destroyed.
+//  ===================================================================================================
+
+const int64_t defaultArenaBlockSize = 65536;
+
+class Arena
+{
+public:
+    Arena();
+    Arena(int64_t blockSize_);
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    void* Allocate(int64_t size, int64_t alignment);
+    int64_t Size() const { return size; }
+    int64_t BlockCount() const { return blocks.size(); }
+private:
+    void NewBlock(int64_t minSize);
+    int64_t blockSize;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char* free;
+    char* end;
+    int64_t size;
+};
+
+//  ===================================================================================================
+//  ArenaAllocator allocates the elements of a standard container from given arena, or from the heap if 
+//  the arena is null. Memory allocated from an arena is released with the arena.
+//  ===================================================================================================
+
+template<typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+    ArenaAllocator() noexcept : arena(nullptr) {}
+    ArenaAllocator(Arena* arena_) noexcept : arena(arena_) {}
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& that) noexcept : arena(that.GetArena()) {}
+    Arena* GetArena() const noexcept { return arena; }
+    T* allocate(std::size_t n)
+    {
+        if (arena)
+        {
+            return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (!arena)
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+private:
+    Arena* arena;
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T>& left, const ArenaAllocator<U>& right) noexcept
+{
+    return left.GetArena() == right.GetArena();
+}
+
+//  ===================================================================================================
+//  ArenaString holds the text of a node. A string of up to 16 characters is stored in the object 
+//  itself. The characters of a longer string are allocated from given arena, or from the heap if the
+//  arena is null. An ArenaString takes 24 bytes instead of the 32 bytes of std::string.
+//  ===================================================================================================
+
+class ArenaString
+{
+public:
+    ArenaString();
+    ArenaString(std::string_view str, Arena* arena);
+    ArenaString(const ArenaString&) = delete;
+    ArenaString& operator=(const ArenaString&) = delete;
+    ArenaString(ArenaString&& that) noexcept;
+    ArenaString& operator=(ArenaString&& that) noexcept;
+    ~ArenaString();
+    void Assign(std::string_view str, Arena* arena);
+    std::string_view View() const { return IsInline() ? std::string_view(inlineChars, length) : std::string_view(chars, length); }
+    bool IsEmpty() const { return length == 0; }
+private:
+    static const uint32_t inlineCapacity = 16;
+    bool IsInline() const { return length <= inlineCapacity; }
+    void MoveFrom(ArenaString& that);
+    void Release();
+    union
+    {
+        const char* chars;
+        char inlineChars[inlineCapacity];
+    };
+    uint32_t length;
+    bool ownsChars;
+};
+
+//  ===================================================================================================
+//  A subtree that contains arena allocated nodes and is removed from its document keeps the arenas of
+//  the document alive until the subtree is deleted or inserted to a document, which then takes over the
+//  references. The root of such a detached subtree holds the references itself (see DetachedRefs).
+//  ===================================================================================================
+
+using ArenaRefs = std::vector<std::shared_ptr<Arena>>;
+
+void AddArenaRefs(ArenaRefs& arenaRefs, const ArenaRefs& refsToAdd);
+
+} // namespace soul::xml
@@ -6,6 +6,9 @@
 module soul.xml.attribute.node;
 
 import util;
+import soul.xml.parent.node;
+import soul.xml.document;
+import soul.xml.element;
 
 namespace soul::xml {
 
@@ -70,9 +73,27 @@ AttributeNode::AttributeNode(const soul::ast::SourcePos& sourcePos_, const std::
 {
 }
 
+AttributeNode::AttributeNode(const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_, const std::string& value_) :
+    Node(NodeKind::attributeNode, sourcePos_, name_), value(value_)
+{
+}
+
 void AttributeNode::SetValue(const std::string& value_)
 {
+    Document* document = nullptr;
+    if (Parent())
+    {
+        document = Parent()->OwnerDocument();
+    }
+    if (document)
+    {
+        document->RemoveFromIndex(static_cast<Element*>(Parent()), GetName(), value);
+    }
     value = value_;
+    if (document)
+    {
+        document->AddToIndex(static_cast<Element*>(Parent()), GetName(), value);
+    }
 }
 
 void AttributeNode::Write(util::CodeFormatter& formatter)
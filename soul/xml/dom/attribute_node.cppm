@@ -7,6 +7,7 @@ export module soul.xml.attribute.node;
 
 import std.core;
 import soul.xml.node;
+import soul.xml.name.table;
 
 export namespace soul::xml {
 
@@ -17,6 +18,7 @@ class AttributeNode : public Node
 {
 public:
     AttributeNode(const soul::ast::SourcePos& sourcePos_, const std::string& name_, const std::string& value_);
+    AttributeNode(const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_, const std::string& value_);
     const std::string& Value() const { return value; }
     void SetValue(const std::string& value_);
     void Write(util::CodeFormatter& formatter) override;
@@ -0,0 +1,246 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.xml.axis.iterator;
+
+import std.core;
+import soul.xml.node;
+import soul.xml.parent.node;
+import soul.xml.name.table;
+
+export namespace soul::xml {
+
+//  ===================================================================================================
+//  Axis ranges iterate the nodes of an axis in axis order without virtual calls or recursion:
+//
+//      for (Node* node : Descendants(contextNode, ElementNamed(name))) { ... }
+//
+//  A range is a step that moves from a node to the next node of the axis, combined with a filter
+//  that the iterator applies before yielding a node. The descendant steps walk the subtree in
+//  document order by following the child, sibling and parent links, so the depth of the document
+//  does not consume stack. The tree must not be modified while it is being iterated.
+//  ===================================================================================================
+
+inline Node* FirstChildOf(Node* node)
+{
+    switch (node->Kind())
+    {
+        case NodeKind::elementNode:
+        case NodeKind::documentNode:
+        case NodeKind::documentFragmentNode:
+        {
+            return static_cast<ParentNode*>(node)->FirstChild();
+        }
+    }
+    return nullptr;
+}
+
+struct AnyNode
+{
+    bool operator()(Node* node) const { return true; }
+};
+
+struct ElementNode
+{
+    bool operator()(Node* node) const { return node->IsElementNode(); }
+};
+
+struct ElementNamed
+{
+    ElementNamed() : name(nullptr) {}
+    ElementNamed(const soul::xml::Name* name_) : name(name_) {}
+    bool operator()(Node* node) const { return node->IsElementNode() && node->GetName() == name; }
+    const soul::xml::Name* name;
+};
+
+struct SelfStep
+{
+    Node* First(Node* contextNode) { return contextNode; }
+    Node* Next(Node* node) const { return nullptr; }
+};
+
+struct ChildStep
+{
+    Node* First(Node* contextNode) { return FirstChildOf(contextNode); }
+    Node* Next(Node* node) const { return node->Next(); }
+};
+
+struct DescendantStep
+{
+    DescendantStep() : root(nullptr) {}
+    Node* First(Node* contextNode)
+    {
+        root = contextNode;
+        return FirstChildOf(contextNode);
+    }
+    Node* Next(Node* node) const
+    {
+        Node* child = FirstChildOf(node);
+        if (child)
+        {
+            return child;
+        }
+        while (node != root)
+        {
+            if (node->Next())
+            {
+                return node->Next();
+            }
+            node = node->Parent();
+        }
+        return nullptr;
+    }
+    Node* root;
+};
+
+struct DescendantOrSelfStep : DescendantStep
+{
+    Node* First(Node* contextNode)
+    {
+        root = contextNode;
+        return contextNode;
+    }
+};
+
+struct ParentStep
+{
+    Node* First(Node* contextNode) { return contextNode->Parent(); }
+    Node* Next(Node* node) const { return nullptr; }
+};
+
+struct AncestorStep
+{
+    Node* First(Node* contextNode) { return contextNode->Parent(); }
+    Node* Next(Node* node) const { return node->Parent(); }
+};
+
+struct AncestorOrSelfStep
+{
+    Node* First(Node* contextNode) { return contextNode; }
+    Node* Next(Node* node) const { return node->Parent(); }
+};
+
+struct FollowingSiblingStep
+{
+    Node* First(Node* contextNode) { return contextNode->Next(); }
+    Node* Next(Node* node) const { return node->Next(); }
+};
+
+struct PrecedingSiblingStep
+{
+    Node* First(Node* contextNode) { return contextNode->Prev(); }
+    Node* Next(Node* node) const { return node->Prev(); }
+};
+
+template<typename Step, typename Filter>
+class AxisIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Node*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Node* const*;
+    using reference = Node* const&;
+    AxisIterator() : step(), filter(), node(nullptr) {}
+    AxisIterator(Node* contextNode, const Step& step_, const Filter& filter_) : step(step_), filter(filter_), node(step.First(contextNode))
+    {
+        Skip();
+    }
+    reference operator*() const { return node; }
+    AxisIterator& operator++()
+    {
+        node = step.Next(node);
+        Skip();
+        return *this;
+    }
+    AxisIterator operator++(int)
+    {
+        AxisIterator prev = *this;
+        ++*this;
+        return prev;
+    }
+    bool operator==(const AxisIterator& that) const { return node == that.node; }
+    bool operator!=(const AxisIterator& that) const { return node != that.node; }
+private:
+    void Skip()
+    {
+        while (node && !filter(node))
+        {
+            node = step.Next(node);
+        }
+    }
+    Step step;
+    Filter filter;
+    Node* node;
+};
+
+template<typename Step, typename Filter>
+class AxisRange
+{
+public:
+    using iterator = AxisIterator<Step, Filter>;
+    AxisRange(Node* contextNode_, const Filter& filter_) : contextNode(contextNode_), filter(filter_) {}
+    iterator begin() const { return iterator(contextNode, Step(), filter); }
+    iterator end() const { return iterator(); }
+private:
+    Node* contextNode;
+    Filter filter;
+};
+
+template<typename Filter = AnyNode>
+AxisRange<SelfStep, Filter> Self(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<SelfStep, Filter>(node, filter);
+}
+
+template<typename Filter = AnyNode>
+AxisRange<ChildStep, Filter> Children(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<ChildStep, Filter>(node, filter);
+}
+
+template<typename Filter = AnyNode>
+AxisRange<DescendantStep, Filter> Descendants(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<DescendantStep, Filter>(node, filter);
+}
+
+template<typename Filter = AnyNode>
+AxisRange<DescendantOrSelfStep, Filter> DescendantsOrSelf(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<DescendantOrSelfStep, Filter>(node, filter);
+}
+
+template<typename Filter = AnyNode>
+AxisRange<ParentStep, Filter> ParentOf(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<ParentStep, Filter>(node, filter);
+}
+
+template<typename Filter = AnyNode>
+AxisRange<AncestorStep, Filter> Ancestors(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<AncestorStep, Filter>(node, filter);
+}
+
+template<typename Filter = AnyNode>
+AxisRange<AncestorOrSelfStep, Filter> AncestorsOrSelf(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<AncestorOrSelfStep, Filter>(node, filter);
+}
+
+template<typename Filter = AnyNode>
+AxisRange<FollowingSiblingStep, Filter> FollowingSiblings(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<FollowingSiblingStep, Filter>(node, filter);
+}
+
+template<typename Filter = AnyNode>
+AxisRange<PrecedingSiblingStep, Filter> PrecedingSiblings(Node* node, const Filter& filter = Filter())
+{
+    return AxisRange<PrecedingSiblingStep, Filter>(node, filter);
+}
+
+} // namespace soul::xml
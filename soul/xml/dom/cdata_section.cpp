@@ -17,6 +17,11 @@ CDataSection::CDataSection(const soul::ast::SourcePos& sourcePos_, const std::st
 {
 }
 
+CDataSection::CDataSection(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& text_) : 
+    Text(arena, NodeKind::cdataSectionNode, sourcePos_, "cdata_section", text_)
+{
+}
+
 void CDataSection::Accept(Visitor& visitor)
 {
     visitor.Visit(*this);
@@ -25,7 +30,7 @@ void CDataSection::Accept(Visitor& visitor)
 void CDataSection::Write(util::CodeFormatter& formatter)
 {
     formatter.Write("<![CDATA[");
-    formatter.Write(Data());
+    formatter.Write(std::string(Data()));
     formatter.Write("]]>");
 }
 
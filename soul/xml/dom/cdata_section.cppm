@@ -7,6 +7,7 @@ export module soul.xml.cdata.section;
 
 import std.core;
 import soul.xml.text;
+import soul.xml.arena;
 
 export namespace soul::xml {
 
@@ -15,6 +16,7 @@ class CDataSection : public Text
 public:
     CDataSection(const soul::ast::SourcePos& sourcePos_);
     CDataSection(const soul::ast::SourcePos& sourcePos_, const std::string& text_);
+    CDataSection(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& text_);
     void Accept(Visitor& visitor) override;
     void Write(util::CodeFormatter& formatter) override;
 };
@@ -46,18 +46,28 @@ CharacterData::CharacterData(NodeKind kind_, const soul::ast::SourcePos& sourceP
 }
 
 CharacterData::CharacterData(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_, const std::string& data_) : 
-    Node(kind_, sourcePos_, name_), data(data_)
+    CharacterData(nullptr, kind_, sourcePos_, name_, data_)
 {
 }
 
+CharacterData::CharacterData(Arena* arena, NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_, const std::string& data_) :
+    Node(kind_, sourcePos_, name_), data(data_, arena)
+{
+}
+
+void CharacterData::SetData(const std::string& data_)
+{
+    data.Assign(data_, nullptr);
+}
+
 void CharacterData::Write(util::CodeFormatter& formatter)
 {
-    formatter.Write(XmlCharDataEscape(data));
+    formatter.Write(XmlCharDataEscape(std::string(data.View())));
 }
 
 bool CharacterData::ValueContainsNewLine() const
 {
-    return data.find('\n') != std::string::npos;
+    return data.View().find('\n') != std::string_view::npos;
 }
 
 } // namespace soul::xml
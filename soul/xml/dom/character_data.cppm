@@ -7,6 +7,7 @@ export module soul.xml.character.data;
 
 import std.core;
 import soul.xml.node;
+import soul.xml.arena;
 
 export namespace soul::xml {
 
@@ -17,12 +18,13 @@ class CharacterData : public Node
 public:
     CharacterData(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_);
     CharacterData(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_, const std::string& data_);
-    const std::string& Data() const { return data; }
-    std::string& Data() { return data; }
+    CharacterData(Arena* arena, NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_, const std::string& data_);
+    std::string_view Data() const { return data.View(); }
+    void SetData(const std::string& data_);
     void Write(util::CodeFormatter& formatter) override;
     bool ValueContainsNewLine() const final;
 private:
-    std::string data;
+    ArenaString data;
 };
 
 } // namespace soul::xml
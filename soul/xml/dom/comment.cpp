@@ -17,6 +17,11 @@ Comment::Comment(const soul::ast::SourcePos& sourcePos_, const std::string& comm
 {
 }
 
+Comment::Comment(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& comment_) : 
+    CharacterData(arena, NodeKind::commentNode, sourcePos_, "comment", comment_)
+{
+}
+
 void Comment::Accept(Visitor& visitor)
 {
     visitor.Visit(*this);
@@ -25,7 +30,7 @@ void Comment::Accept(Visitor& visitor)
 void Comment::Write(util::CodeFormatter& formatter)
 {
     formatter.Write("<!-- ");
-    formatter.Write(Data());
+    formatter.Write(std::string(Data()));
     formatter.Write(" -->");
 }
 
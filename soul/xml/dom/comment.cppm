@@ -7,6 +7,7 @@ export module soul.xml.comment;
 
 import std.core;
 import soul.xml.character.data;
+import soul.xml.arena;
 
 export namespace soul::xml {
 
@@ -15,6 +16,7 @@ class Comment : public CharacterData
 public:
     Comment(const soul::ast::SourcePos& sourcePos_);
     Comment(const soul::ast::SourcePos& sourcePos_, const std::string& comment_);
+    Comment(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& comment_);
     void Accept(Visitor& visitor) override;
     void Write(util::CodeFormatter& formatter) override;
 };
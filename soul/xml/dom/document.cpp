@@ -7,39 +7,133 @@ module soul.xml.document;
 
 import soul.xml.visitor;
 import soul.xml.error;
-import soul.xml.index;
 import soul.lexer.file.map;
 import soul.lexer.error;
 
 namespace soul::xml {
 
-Document::Document() :
-    ParentNode(NodeKind::documentNode, soul::ast::SourcePos(), "document"), documentElement(nullptr), indexValid(false), xmlStandalone(false)
+Document::Document() : Document(soul::ast::SourcePos(), false, std::shared_ptr<NameTable>())
 {
 }
 
-Document::Document(const soul::ast::SourcePos& sourcePos_) : 
-    ParentNode(NodeKind::documentNode, sourcePos_, "document"), documentElement(nullptr), indexValid(false), xmlStandalone(false)
+Document::Document(const soul::ast::SourcePos& sourcePos_) : Document(sourcePos_, false, std::shared_ptr<NameTable>())
 {
 }
 
-Element* Document::GetElementById(const std::string& elementId)
+Document::Document(const soul::ast::SourcePos& sourcePos_, bool arenaAllocation) : Document(sourcePos_, arenaAllocation, std::shared_ptr<NameTable>())
 {
-    if (!indexValid)
+}
+
+Document::Document(const soul::ast::SourcePos& sourcePos_, bool arenaAllocation, const std::shared_ptr<NameTable>& nameTable_) :
+    ParentNode(NodeKind::documentNode, sourcePos_, "document"), documentElement(nullptr), xmlStandalone(false), nameTable(nameTable_), idIndex(nullptr), arena(nullptr)
+{
+    if (!nameTable)
     {
-        index.clear();
-        BuildIndex(this);
-        indexValid = true;
+        nameTable.reset(new NameTable());
     }
-    auto it = index.find(elementId);
-    if (it != index.cend())
+    AddAttributeIndex("id");
+    idIndex = attributeIndexes.front().get();
+    if (arenaAllocation)
     {
-        return it->second;
+        arenaRefs.push_back(std::shared_ptr<Arena>(new Arena()));
+        arena = arenaRefs.front().get();
     }
-    else
+}
+
+Document::~Document()
+{
+    DeleteChildren();
+}
+
+void Document::AdoptDetachedRefs(Node* subtreeRoot)
+{
+    AddArenaRefs(arenaRefs, subtreeRoot->detachedRefs->arenaRefs);
+    subtreeRoot->detachedRefs.reset();
+}
+
+bool PrecedesInDocumentOrder(Node* left, Node* right)
+{
+    std::vector<Node*> leftPath;
+    for (Node* node = left; node; node = node->Parent())
+    {
+        leftPath.push_back(node);
+    }
+    std::vector<Node*> rightPath;
+    for (Node* node = right; node; node = node->Parent())
+    {
+        rightPath.push_back(node);
+    }
+    auto leftIt = leftPath.rbegin();
+    auto rightIt = rightPath.rbegin();
+    while (leftIt != leftPath.rend() && rightIt != rightPath.rend() && *leftIt == *rightIt)
+    {
+        ++leftIt;
+        ++rightIt;
+    }
+    if (leftIt == leftPath.rend())
+    {
+        return rightIt != rightPath.rend();
+    }
+    if (rightIt == rightPath.rend())
+    {
+        return false;
+    }
+    for (Node* node = (*leftIt)->Next(); node; node = node->Next())
+    {
+        if (node == *rightIt)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+Element* Document::GetElementById(const std::string& elementId) const
+{
+    const std::vector<Element*>* elements = idIndex->Find(elementId);
+    if (elements)
+    {
+        Element* last = elements->front();
+        for (std::size_t i = 1; i < elements->size(); ++i)
+        {
+            Element* element = (*elements)[i];
+            if (PrecedesInDocumentOrder(last, element))
+            {
+                last = element;
+            }
+        }
+        return last;
+    }
+    return nullptr;
+}
+
+void Document::AddAttributeIndex(const std::string& attributeName)
+{
+    const soul::xml::Name* name = nameTable->Intern(attributeName);
+    if (GetAttributeIndex(name))
+    {
+        return;
+    }
+    AttributeIndex* index = new AttributeIndex(name);
+    attributeIndexes.push_back(std::unique_ptr<AttributeIndex>(index));
+    Node* child = FirstChild();
+    while (child)
+    {
+        IndexSubtree(child, index, true);
+        child = child->Next();
+    }
+}
+
+AttributeIndex* Document::GetAttributeIndex(const soul::xml::Name* attributeName) const
+{
+    for (const auto& index : attributeIndexes)
     {
-        return nullptr;
+        if (index->AttributeName() == attributeName)
+        {
+            return index.get();
+        }
     }
+    return nullptr;
 }
 
 void Document::AppendChild(Node* child)
@@ -123,9 +217,81 @@ void Document::Write(util::CodeFormatter& formatter)
     ParentNode::Write(formatter);
 }
 
-void Document::InvalidateIndex()
+void Document::AddToIndexes(Node* subtreeRoot)
+{
+    IndexSubtree(subtreeRoot, nullptr, true);
+}
+
+void Document::RemoveFromIndexes(Node* subtreeRoot)
+{
+    IndexSubtree(subtreeRoot, nullptr, false);
+}
+
+void Document::AddToIndex(Element* element, const soul::xml::Name* attributeName, std::string_view value)
+{
+    AttributeIndex* index = GetAttributeIndex(attributeName);
+    if (index)
+    {
+        index->Add(value, element);
+    }
+}
+
+void Document::RemoveFromIndex(Element* element, const soul::xml::Name* attributeName, std::string_view value)
+{
+    AttributeIndex* index = GetAttributeIndex(attributeName);
+    if (index)
+    {
+        index->Remove(value, element);
+    }
+}
+
+void Document::IndexSubtree(Node* subtreeRoot, AttributeIndex* index, bool add)
 {
-    indexValid = false;
+    Node* node = subtreeRoot;
+    while (node)
+    {
+        if (node->IsElementNode())
+        {
+            Element* element = static_cast<Element*>(node);
+            for (const AttributeEntry& attribute : element->Attributes())
+            {
+                AttributeIndex* attributeIndex = index;
+                if (!attributeIndex)
+                {
+                    attributeIndex = GetAttributeIndex(attribute.GetName());
+                }
+                else if (attributeIndex->AttributeName() != attribute.GetName())
+                {
+                    continue;
+                }
+                if (attributeIndex)
+                {
+                    if (add)
+                    {
+                        attributeIndex->Add(attribute.Value(), element);
+                    }
+                    else
+                    {
+                        attributeIndex->Remove(attribute.Value(), element);
+                    }
+                }
+            }
+            if (element->FirstChild())
+            {
+                node = element->FirstChild();
+                continue;
+            }
+        }
+        while (node != subtreeRoot && !node->Next())
+        {
+            node = node->Parent();
+        }
+        if (node == subtreeRoot)
+        {
+            break;
+        }
+        node = node->Next();
+    }
 }
 
 void Document::CheckValidInsert(Node* node)
@@ -8,14 +8,40 @@ export module soul.xml.document;
 import std.core;
 import soul.xml.parent.node;
 import soul.xml.element;
+import soul.xml.arena;
+import soul.xml.index;
+import soul.xml.name.table;
 
 export namespace soul::xml {
 
+//  ===================================================================================================
+//  A document created with arena allocation owns an arena from which its nodes can be allocated:
+//  MakeNode<Element>(document->GetArena(), ...). Arena allocated nodes can be moved, removed and
+//  inserted to other documents like heap allocated nodes. A removed subtree shares the ownership of
+//  the arenas of its document, and a document that receives arena allocated nodes of another document
+//  keeps the arenas of those nodes alive.
+//
+//  A document maintains an attribute index for the 'id' attribute, which GetElementById uses, and for
+//  each attribute name registered with AddAttributeIndex. The indexes contain the elements connected
+//  to the document. If many elements have the same id, GetElementById returns the last of them in
+//  document order.
+//
+//  The names of the nodes of a document are interned in the name table of the document. A table can
+//  be shared by documents that have many names in common by giving the same table to their constructors.
+//  ===================================================================================================
+
 class Document : public ParentNode
 {
 public:
     Document();
     Document(const soul::ast::SourcePos& sourcePos_);
+    Document(const soul::ast::SourcePos& sourcePos_, bool arenaAllocation);
+    Document(const soul::ast::SourcePos& sourcePos_, bool arenaAllocation, const std::shared_ptr<NameTable>& nameTable_);
+    ~Document();
+    Arena* GetArena() const { return arena; }
+    const ArenaRefs& GetArenaRefs() const { return arenaRefs; }
+    void AdoptDetachedRefs(Node* subtreeRoot);
+    const std::shared_ptr<NameTable>& GetNameTable() const { return nameTable; }
     Element* DocumentElement() const { return documentElement; }
     bool XmlStandalone() const { return xmlStandalone; }
     void SetXmlStandalone(bool xmlStandalone_) { xmlStandalone = xmlStandalone_; }
@@ -23,8 +49,9 @@ public:
     void SetXmlVersion(const std::string& xmlVersion_) { xmlVersion = xmlVersion_; }
     const std::string& XmlEncoding() const { return xmlEncoding; }
     void SetXmlEncoding(const std::string& xmlEncoding_) { xmlEncoding = xmlEncoding_; }
-    std::map<std::string, Element*>& Index() { return index; }
-    Element* GetElementById(const std::string& elementId);
+    Element* GetElementById(const std::string& elementId) const;
+    void AddAttributeIndex(const std::string& attributeName);
+    AttributeIndex* GetAttributeIndex(const soul::xml::Name* attributeName) const;
     void AppendChild(Node* child) override;
     void InsertBefore(Node* newChild, Node* refChild) override;
     std::unique_ptr<Node> RemoveChild(Node* child) override;
@@ -33,14 +60,23 @@ public:
     void Write(util::CodeFormatter& formatter) override;
 private:
     friend class ParentNode;
-    void InvalidateIndex();
+    friend class Element;
+    friend class AttributeNode;
+    void AddToIndexes(Node* subtreeRoot);
+    void RemoveFromIndexes(Node* subtreeRoot);
+    void AddToIndex(Element* element, const soul::xml::Name* attributeName, std::string_view value);
+    void RemoveFromIndex(Element* element, const soul::xml::Name* attributeName, std::string_view value);
+    void IndexSubtree(Node* subtreeRoot, AttributeIndex* index, bool add);
     void CheckValidInsert(Node* node);
     Element* documentElement;
-    bool indexValid;
     bool xmlStandalone;
     std::string xmlVersion;
     std::string xmlEncoding;
-    std::map<std::string, Element*> index;
+    std::vector<std::unique_ptr<AttributeIndex>> attributeIndexes;
+    std::shared_ptr<NameTable> nameTable;
+    AttributeIndex* idIndex;
+    Arena* arena;
+    ArenaRefs arenaRefs;
 };
 
 std::unique_ptr<Document> MakeDocument();
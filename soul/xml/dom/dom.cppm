@@ -5,6 +5,8 @@
 
 export module soul.xml.dom;
 
+export import soul.xml.arena;
+export import soul.xml.name.table;
 export import soul.xml.node;
 export import soul.xml.attribute.node;
 export import soul.xml.cdata.section;
@@ -16,9 +18,11 @@ export import soul.xml.element;
 export import soul.xml.entity.reference;
 export import soul.xml.parent.node;
 export import soul.xml.processing.instruction;
+export import soul.xml.serializer;
 export import soul.xml.text;
 export import soul.xml.error;
 export import soul.xml.index;
 export import soul.xml.axis;
+export import soul.xml.axis.iterator;
 export import soul.xml.node.operation;
 export import soul.xml.visitor;
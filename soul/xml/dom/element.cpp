@@ -5,21 +5,135 @@
 
 module soul.xml.element;
 
+import soul.xml.name.table;
+import soul.xml.document;
 import soul.xml.visitor;
 import soul.xml.node.operation;
 
 namespace soul::xml {
 
+AttributeEntry::AttributeEntry(const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_, const std::string& value_, Arena* arena) : 
+    sourcePos(sourcePos_), name(name_), value(value_, arena)
+{
+}
+
+AttributeEntry::AttributeEntry(AttributeNode* node_) : sourcePos(node_->GetSourcePos()), name(node_->GetName()), node(node_)
+{
+}
+
+std::string_view AttributeEntry::Value() const
+{
+    if (node)
+    {
+        return node->Value();
+    }
+    else
+    {
+        return value.View();
+    }
+}
+
+void AttributeEntry::SetValue(const std::string& value_, Arena* arena)
+{
+    if (node)
+    {
+        node->SetValue(value_);
+    }
+    else
+    {
+        value.Assign(value_, arena);
+    }
+}
+
+AttributeNode* AttributeEntry::GetNode() const
+{
+    if (!node)
+    {
+        node.reset(new AttributeNode(sourcePos, name, std::string(value.View())));
+    }
+    return node.get();
+}
+
+void AttributeEntry::SetNode(AttributeNode* node_)
+{
+    node.reset(node_);
+}
+
+void AttributeEntry::InternName(NameTable& names)
+{
+    if (name->Table() != &names)
+    {
+        name = names.Intern(name->QualifiedName());
+    }
+    if (node)
+    {
+        node->InternNames(names);
+    }
+}
+
 Element::Element(const soul::ast::SourcePos& sourcePos_, const std::string& name_) : ParentNode(NodeKind::elementNode, sourcePos_, name_)
 {
 }
 
+Element::Element(const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_) : ParentNode(NodeKind::elementNode, sourcePos_, name_)
+{
+}
+
+Element::Element(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& name_) : 
+    ParentNode(NodeKind::elementNode, sourcePos_, name_), attributes(ArenaAllocator<AttributeEntry>(arena))
+{
+}
+
+Element::Element(Arena* arena, const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_) : 
+    ParentNode(NodeKind::elementNode, sourcePos_, name_), attributes(ArenaAllocator<AttributeEntry>(arena))
+{
+}
+
+AttributeEntry* Element::FindAttribute(const soul::xml::Name* attributeName) const
+{
+    for (const AttributeEntry& attribute : attributes)
+    {
+        if (attribute.GetName() == attributeName)
+        {
+            return const_cast<AttributeEntry*>(&attribute);
+        }
+    }
+    return nullptr;
+}
+
+AttributeNode* Element::GetAttributeNode(const AttributeEntry& attribute) const
+{
+    AttributeNode* attributeNode = attribute.GetNode();
+    attributeNode->SetParent(const_cast<Element*>(this));
+    return attributeNode;
+}
+
+void Element::InsertAttribute(AttributeEntry&& attribute)
+{
+    auto it = std::lower_bound(attributes.begin(), attributes.end(), attribute.Name(), 
+        [](const AttributeEntry& left, const std::string& right) { return left.Name() < right; });
+    attributes.insert(it, std::move(attribute));
+}
+
 AttributeNode* Element::GetAttributeNode(const std::string& attributeName) const
 {
-    auto it = attributeMap.find(attributeName);
-    if (it != attributeMap.cend())
+    const soul::xml::Name* name = Names().Find(attributeName);
+    if (name)
+    {
+        return GetAttributeNode(name);
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+AttributeNode* Element::GetAttributeNode(const soul::xml::Name* attributeName) const
+{
+    AttributeEntry* attribute = FindAttribute(attributeName);
+    if (attribute)
     {
-        return it->second.get();
+        return GetAttributeNode(*attribute);
     }
     else
     {
@@ -29,10 +143,23 @@ AttributeNode* Element::GetAttributeNode(const std::string& attributeName) const
 
 std::string Element::GetAttribute(const std::string& name) const
 {
-    AttributeNode* attributeNode = GetAttributeNode(name);
-    if (attributeNode)
+    const soul::xml::Name* attributeName = Names().Find(name);
+    if (attributeName)
     {
-        return attributeNode->Value();
+        return GetAttribute(attributeName);
+    }
+    else
+    {
+        return std::string();
+    }
+}
+
+std::string Element::GetAttribute(const soul::xml::Name* name) const
+{
+    AttributeEntry* attribute = FindAttribute(name);
+    if (attribute)
+    {
+        return std::string(attribute->Value());
     }
     else
     {
@@ -42,19 +169,68 @@ std::string Element::GetAttribute(const std::string& name) const
 
 void Element::AddAttribute(AttributeNode* attributeNode)
 {
-    attributeMap[attributeNode->Name()] = std::unique_ptr<AttributeNode>(attributeNode);
+    attributeNode->InternNames(Names());
+    Document* document = OwnerDocument();
+    AttributeEntry* attribute = FindAttribute(attributeNode->GetName());
+    if (attribute)
+    {
+        if (document)
+        {
+            document->RemoveFromIndex(this, attribute->GetName(), attribute->Value());
+        }
+        attribute->SetNode(attributeNode);
+    }
+    else
+    {
+        InsertAttribute(AttributeEntry(attributeNode));
+    }
+    attributeNode->SetParent(this);
+    if (document)
+    {
+        document->AddToIndex(this, attributeNode->GetName(), attributeNode->Value());
+    }
 }
 
 void Element::SetAttribute(const soul::ast::SourcePos& sourcePos, const std::string& name, const std::string& value)
 {
-    AttributeNode* attributeNode = GetAttributeNode(name);
-    if (attributeNode)
+    SetAttribute(sourcePos, Names().Intern(name), value);
+}
+
+void Element::SetAttribute(const soul::ast::SourcePos& sourcePos, const soul::xml::Name* name, const std::string& value)
+{
+    if (name->Table() != &Names())
     {
-        attributeNode->SetValue(value);
+        name = Names().Intern(name->QualifiedName());
+    }
+    AttributeEntry* attribute = FindAttribute(name);
+    if (attribute)
+    {
+        if (attribute->HasNode())
+        {
+            attribute->SetValue(value, AttributeArena()); // the attribute node updates the indexes
+        }
+        else
+        {
+            Document* document = OwnerDocument();
+            if (document)
+            {
+                document->RemoveFromIndex(this, name, attribute->Value());
+            }
+            attribute->SetValue(value, AttributeArena());
+            if (document)
+            {
+                document->AddToIndex(this, name, value);
+            }
+        }
     }
     else
     {
-        AddAttribute(new AttributeNode(sourcePos, name, value));
+        InsertAttribute(AttributeEntry(sourcePos, name, value, AttributeArena()));
+        Document* document = OwnerDocument();
+        if (document)
+        {
+            document->AddToIndex(this, name, value);
+        }
     }
 }
 
@@ -63,11 +239,21 @@ void Element::SetAttribute(const std::string& name, const std::string& value)
     SetAttribute(soul::ast::SourcePos(), name, value);
 }
 
+void Element::InternNames(NameTable& names)
+{
+    ParentNode::InternNames(names);
+    for (AttributeEntry& attribute : attributes)
+    {
+        attribute.InternName(names);
+    }
+}
+
 void Element::WriteAttributes(util::CodeFormatter& formatter)
 {
-    for (const auto& a : attributeMap)
+    for (const AttributeEntry& attribute : attributes)
     {
-        a.second->Write(formatter);
+        formatter.Write(" " + attribute.Name() + "=");
+        formatter.Write(MakeXmlAttrValue(std::string(attribute.Value())));
     }
 }
 
@@ -82,7 +268,7 @@ void Element::Write(util::CodeFormatter& formatter)
 {
     if (HasChildNodes())
     {
-        if (attributeMap.empty())
+        if (attributes.empty())
         {
             formatter.Write("<" + Name() + ">");
         }
@@ -122,7 +308,7 @@ void Element::Write(util::CodeFormatter& formatter)
     }
     else
     {
-        if (attributeMap.empty())
+        if (attributes.empty())
         {
             formatter.WriteLine("<" + Name() + "/>");
         }
@@ -158,9 +344,9 @@ bool Element::HasMultilineContent() const
 
 void Element::WalkAttribute(NodeOperation& operation)
 {
-    for (const auto& attribute : attributeMap)
+    for (const AttributeEntry& attribute : attributes)
     {
-        operation.Apply(attribute.second.get());
+        operation.Apply(GetAttributeNode(attribute));
     }
 }
 
@@ -8,27 +8,75 @@ export module soul.xml.element;
 import std.core;
 import soul.xml.parent.node;
 import soul.xml.attribute.node;
+import soul.xml.name.table;
+import soul.xml.arena;
 
 export namespace soul::xml {
 
+//  ===================================================================================================
+//  AttributeEntry holds the name and value of an attribute of an element. 
+//  The value of an attribute of an arena allocated element is allocated from the arena of the element.
+//  The attribute node is created only when it is requested by GetAttributeNode or the attribute axis. 
+//  After that the node holds the value of the attribute. Only the element creates and sets the node,
+//  so the node always has the element as its parent and changing its value updates the indexes.
+//  ===================================================================================================
+
+class Element;
+
+class AttributeEntry
+{
+public:
+    AttributeEntry(const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_, const std::string& value_, Arena* arena);
+    const soul::ast::SourcePos& GetSourcePos() const { return sourcePos; }
+    const soul::xml::Name* GetName() const { return name; }
+    const std::string& Name() const { return name->QualifiedName(); }
+    std::string_view Value() const;
+    void SetValue(const std::string& value_, Arena* arena);
+    bool HasNode() const { return node != nullptr; }
+    void InternName(NameTable& names);
+private:
+    friend class Element;
+    AttributeEntry(AttributeNode* node_);
+    AttributeNode* GetNode() const;
+    void SetNode(AttributeNode* node_);
+    soul::ast::SourcePos sourcePos;
+    const soul::xml::Name* name;
+    ArenaString value;
+    mutable std::unique_ptr<AttributeNode> node;
+};
+
+using AttributeVector = std::vector<AttributeEntry, ArenaAllocator<AttributeEntry>>;
+
 class Element : public ParentNode
 {
 public:
     Element(const soul::ast::SourcePos& sourcePos_, const std::string& name_);
-    const std::map<std::string, std::unique_ptr<AttributeNode>>& Attributes() const { return attributeMap; }
+    Element(const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_);
+    Element(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& name_);
+    Element(Arena* arena, const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_);
+    const AttributeVector& Attributes() const { return attributes; }
+    void ReserveAttributes(int count) { attributes.reserve(count); }
     AttributeNode* GetAttributeNode(const std::string& attributeName) const;
+    AttributeNode* GetAttributeNode(const soul::xml::Name* attributeName) const;
     std::string GetAttribute(const std::string& name) const;
+    std::string GetAttribute(const soul::xml::Name* name) const;
     void AddAttribute(AttributeNode* attributeNode);
     void SetAttribute(const soul::ast::SourcePos& sourcePos, const std::string& name, const std::string& value);
+    void SetAttribute(const soul::ast::SourcePos& sourcePos, const soul::xml::Name* name, const std::string& value);
     void SetAttribute(const std::string& name, const std::string& value);
-    bool HasAttributes() const final { return !attributeMap.empty(); }
+    bool HasAttributes() const final { return !attributes.empty(); }
+    void InternNames(NameTable& names) override;
     void Accept(Visitor& visitor) override;
     void Write(util::CodeFormatter& formatter) override;
     void WalkAttribute(NodeOperation& operation) override;
 private:
     void WriteAttributes(util::CodeFormatter& formatter);
     bool HasMultilineContent() const;
-    std::map<std::string, std::unique_ptr<AttributeNode>> attributeMap;
+    AttributeEntry* FindAttribute(const soul::xml::Name* attributeName) const;
+    AttributeNode* GetAttributeNode(const AttributeEntry& attribute) const;
+    void InsertAttribute(AttributeEntry&& attribute);
+    Arena* AttributeArena() const { return attributes.get_allocator().GetArena(); }
+    AttributeVector attributes;
 };
 
 Element* MakeElement(const std::string& name);
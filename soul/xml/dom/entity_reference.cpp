@@ -19,6 +19,11 @@ EntityReference::EntityReference(const soul::ast::SourcePos& sourcePos_, const s
 {
 }
 
+EntityReference::EntityReference(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& entityRef_) : 
+    CharacterData(arena, NodeKind::entityReferenceNode, sourcePos_, "entity_reference", entityRef_)
+{
+}
+
 void EntityReference::Accept(Visitor& visitor)
 {
     visitor.Visit(*this);
@@ -27,7 +32,7 @@ void EntityReference::Accept(Visitor& visitor)
 void EntityReference::Write(util::CodeFormatter& formatter)
 {
     formatter.Write("&");
-    formatter.Write(Data());
+    formatter.Write(std::string(Data()));
     formatter.Write(";");
 }
 
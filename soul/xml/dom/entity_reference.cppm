@@ -7,6 +7,7 @@ export module soul.xml.entity.reference;
 
 import std.core;
 import soul.xml.character.data;
+import soul.xml.arena;
 
 export namespace soul::xml {
 
@@ -15,6 +16,7 @@ class EntityReference : public CharacterData
 public:
     EntityReference(const soul::ast::SourcePos& sourcePos_);
     EntityReference(const soul::ast::SourcePos& sourcePos_, const std::string& entityRef_);
+    EntityReference(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& entityRef_);
     void Accept(Visitor& visitor) override;
     void Write(util::CodeFormatter& formatter) override;
 };
@@ -6,38 +6,53 @@
 module soul.xml.index;
 
 import std.core;
-import soul.xml.visitor;
-import soul.xml.document;
-import soul.xml.element;
 
 namespace soul::xml {
 
-class BuildIndexVisitor : public Visitor
+AttributeIndex::AttributeIndex(const soul::xml::Name* attributeName_) : attributeName(attributeName_)
 {
-public:
-    BuildIndexVisitor(std::map<std::string, Element*>& index_);
-    void BeginVisit(Element& element) override;
-private:
-    std::map<std::string, Element*>& index;
-};
-
-BuildIndexVisitor::BuildIndexVisitor(std::map<std::string, Element*>& index_) : index(index_)
+}
+
+void AttributeIndex::Add(std::string_view value, Element* element)
 {
+    map[std::string(value)].push_back(element);
 }
 
-void BuildIndexVisitor::BeginVisit(Element& element)
+void AttributeIndex::Remove(std::string_view value, Element* element)
 {
-    std::string id = element.GetAttribute("id");
-    if (!id.empty())
+    auto it = map.find(std::string(value));
+    if (it != map.end())
+    {
+        std::vector<Element*>& elements = it->second;
+        auto elementIt = std::find(elements.begin(), elements.end(), element);
+        if (elementIt != elements.end())
+        {
+            *elementIt = elements.back();
+            elements.pop_back();
+            if (elements.empty())
+            {
+                map.erase(it);
+            }
+        }
+    }
+}
+
+const std::vector<Element*>* AttributeIndex::Find(const std::string& value) const
+{
+    auto it = map.find(value);
+    if (it != map.cend())
+    {
+        return &it->second;
+    }
+    else
     {
-        index[id] = &element;
+        return nullptr;
     }
 }
 
-void BuildIndex(Document* document)
+void AttributeIndex::Clear()
 {
-    BuildIndexVisitor visitor(document->Index());
-    document->Accept(visitor);
+    map.clear();
 }
 
 } // namespace soul::xml
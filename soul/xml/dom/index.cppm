@@ -6,11 +6,31 @@
 export module soul.xml.index;
 
 import std.core;
+import soul.xml.name.table;
 
 export namespace soul::xml {
 
-class Document;
+class Element;
 
-void BuildIndex(Document* document);
+//  ===================================================================================================
+//  AttributeIndex maps the values of an attribute to the elements of a document that have the 
+//  attribute with that value. The document keeps its indexes up to date when nodes are inserted, 
+//  removed or replaced and when attribute values change. The elements of a value are not kept in 
+//  document order.
+//  ===================================================================================================
+
+class AttributeIndex
+{
+public:
+    AttributeIndex(const soul::xml::Name* attributeName_);
+    const soul::xml::Name* AttributeName() const { return attributeName; }
+    void Add(std::string_view value, Element* element);
+    void Remove(std::string_view value, Element* element);
+    const std::vector<Element*>* Find(const std::string& value) const;
+    void Clear();
+private:
+    const soul::xml::Name* attributeName;
+    std::unordered_map<std::string, std::vector<Element*>> map;
+};
 
 } // namespace soul::xml
@@ -0,0 +1,159 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.xml.name.table;
+
+namespace soul::xml {
+
+Name::Name(const std::string& qualifiedName_, NameTable* table_) : qualifiedName(qualifiedName_), colonCount(0), table(table_)
+{
+    std::string::size_type colonPos = std::string::npos;
+    for (std::string::size_type i = 0; i < qualifiedName.length(); ++i)
+    {
+        if (qualifiedName[i] == ':')
+        {
+            if (colonCount == 0)
+            {
+                colonPos = i;
+            }
+            ++colonCount;
+        }
+    }
+    if (colonPos != std::string::npos)
+    {
+        prefix = qualifiedName.substr(0, colonPos);
+        localName = qualifiedName.substr(colonPos + 1);
+    }
+    else
+    {
+        localName = qualifiedName;
+    }
+}
+
+NameTable::NameTable()
+{
+}
+
+NameTable& NameTable::Default()
+{
+    static NameTable defaultTable;
+    return defaultTable;
+}
+
+const Name* NameTable::Intern(const std::string& qualifiedName)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    std::unique_ptr<Name>& name = nameMap[qualifiedName];
+    if (!name)
+    {
+        name.reset(new Name(qualifiedName, this));
+    }
+    return name.get();
+}
+
+const Name* NameTable::Find(const std::string& qualifiedName) const
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = nameMap.find(qualifiedName);
+    if (it != nameMap.cend())
+    {
+        return it->second.get();
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+const std::string* NameTable::InternString(const std::string& str)
+{
+    if (str.empty())
+    {
+        return EmptyString();
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = strings.insert(str).first;
+    return &(*it);
+}
+
+const std::string* NameTable::EmptyString()
+{
+    static const std::string emptyString;
+    return &emptyString;
+}
+
+class NodeTypeNames
+{
+public:
+    NodeTypeNames();
+    const Name* Find(const std::string& name) const;
+private:
+    std::map<std::string, std::unique_ptr<Name>> names;
+};
+
+NodeTypeNames::NodeTypeNames()
+{
+    for (const char* name : { "document", "document_fragment", "text", "cdata_section", "comment", "entity_reference", "processing_instruction" })
+    {
+        names[name].reset(new Name(name, nullptr));
+    }
+}
+
+const Name* NodeTypeNames::Find(const std::string& name) const
+{
+    auto it = names.find(name);
+    if (it != names.cend())
+    {
+        return it->second.get();
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+const Name* NodeTypeName(const std::string& name)
+{
+    static const NodeTypeNames nodeTypeNames;
+    const Name* nodeTypeName = nodeTypeNames.Find(name);
+    if (nodeTypeName)
+    {
+        return nodeTypeName;
+    }
+    return NameTable::Default().Intern(name);
+}
+
+NameCache::NameCache() : nameTable(&NameTable::Default())
+{
+}
+
+void NameCache::SetNameTable(NameTable* nameTable_)
+{
+    nameTable = nameTable_;
+    nameMap.clear();
+    stringMap.clear();
+}
+
+const Name* NameCache::Intern(const std::string& qualifiedName)
+{
+    const Name*& name = nameMap[qualifiedName];
+    if (!name)
+    {
+        name = nameTable->Intern(qualifiedName);
+    }
+    return name;
+}
+
+const std::string* NameCache::InternString(const std::string& str)
+{
+    const std::string*& s = stringMap[str];
+    if (!s)
+    {
+        s = nameTable->InternString(str);
+    }
+    return s;
+}
+
+} // namespace soul::xml
@@ -0,0 +1,88 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.xml.name.table;
+
+import std.core;
+
+export namespace soul::xml {
+
+//  ===================================================================================================
+//  Name is an interned element or attribute name. The qualified name is split to prefix and local name 
+//  when the name is interned, so there is no need to parse it again. 
+//  Two names interned in the same table are equal if and only if their addresses are equal.
+//  ===================================================================================================
+
+class NameTable;
+
+class Name
+{
+public:
+    Name(const std::string& qualifiedName_, NameTable* table_);
+    const std::string& QualifiedName() const { return qualifiedName; }
+    const std::string& Prefix() const { return prefix; }
+    const std::string& LocalName() const { return localName; }
+    int ColonCount() const { return colonCount; }
+    NameTable* Table() const { return table; }
+private:
+    std::string qualifiedName;
+    std::string prefix;
+    std::string localName;
+    int colonCount;
+    NameTable* table;
+};
+
+//  ===================================================================================================
+//  NameTable interns element and attribute names and namespace URIs. 
+//  Each document owns a name table that it can share with other documents. The names of the elements 
+//  and attributes connected to a document are interned in the table of the document, and they are 
+//  interned again when a subtree is inserted to a document with another table. A subtree removed from
+//  a document keeps its names in the table of the document, and its root holds a reference to the table.
+//  Detached nodes created by name through the DOM use the default table. Names of the other node types 
+//  ("text", "comment", ...) are constants that do not belong to any table.
+//  NameTable is thread-safe. A parser should cache the names it interns in a NameCache that is not
+//  shared between threads so that the table needs to be locked only once per distinct name.
+//  ===================================================================================================
+
+class NameTable
+{
+public:
+    NameTable();
+    NameTable(const NameTable&) = delete;
+    NameTable& operator=(const NameTable&) = delete;
+
+    //  ===============================================================================================
+    //  The default table lives as long as the process and never shrinks: a name interned in it stays
+    //  there. A long-running process that creates detached nodes or streams documents with many
+    //  distinct names should use a table of its own, for example by giving one to StreamingMatcher.
+    //  ===============================================================================================
+
+    static NameTable& Default();
+    const Name* Intern(const std::string& qualifiedName);
+    const Name* Find(const std::string& qualifiedName) const;
+    const std::string* InternString(const std::string& str);
+    static const std::string* EmptyString();
+private:
+    mutable std::mutex mtx;
+    std::unordered_map<std::string, std::unique_ptr<Name>> nameMap;
+    std::unordered_set<std::string> strings;
+};
+
+const Name* NodeTypeName(const std::string& name);
+
+class NameCache
+{
+public:
+    NameCache();
+    void SetNameTable(NameTable* nameTable_);
+    const Name* Intern(const std::string& qualifiedName);
+    const std::string* InternString(const std::string& str);
+private:
+    NameTable* nameTable;
+    std::unordered_map<std::string, const Name*> nameMap;
+    std::unordered_map<std::string, const std::string*> stringMap;
+};
+
+} // namespace soul::xml
@@ -9,6 +9,8 @@ import soul.xml.error;
 import soul.xml.axis;
 import soul.xml.node.operation;
 import soul.xml.parent.node;
+import soul.xml.document;
+import soul.xml.name.table;
 
 namespace soul::xml {
 
@@ -32,7 +34,22 @@ std::string NodeKindStr(NodeKind nodeKind)
 }
 
 Node::Node(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_) : 
-    kind(kind_), sourcePos(sourcePos_), name(name_), parent(nullptr), prev(nullptr), next(nullptr), ownerDocument(nullptr)
+    kind(kind_), arenaAllocated(false), sourcePos(sourcePos_), name(nullptr), namespaceUri(NameTable::EmptyString()), 
+    parent(nullptr), prev(nullptr), next(nullptr), ownerDocument(nullptr)
+{
+    if (kind == NodeKind::elementNode || kind == NodeKind::attributeNode)
+    {
+        name = NameTable::Default().Intern(name_);
+    }
+    else
+    {
+        name = NodeTypeName(name_);
+    }
+}
+
+Node::Node(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_) :
+    kind(kind_), arenaAllocated(false), sourcePos(sourcePos_), name(name_), namespaceUri(NameTable::EmptyString()), 
+    parent(nullptr), prev(nullptr), next(nullptr), ownerDocument(nullptr)
 {
 }
 
@@ -40,20 +57,57 @@ Node::~Node()
 {
 }
 
+void Node::operator delete(Node* node, std::destroying_delete_t)
+{
+    bool arenaAllocated = node->arenaAllocated;
+    std::unique_ptr<DetachedRefs> detachedRefs = std::move(node->detachedRefs);
+    node->~Node();
+    if (!arenaAllocated)
+    {
+        ::operator delete(node);
+    }
+}
+
+NameTable& Node::Names() const
+{
+    if (name->Table())
+    {
+        return *name->Table();
+    }
+    if (IsDocumentNode())
+    {
+        return *static_cast<const Document*>(this)->GetNameTable();
+    }
+    if (ownerDocument)
+    {
+        return *ownerDocument->GetNameTable();
+    }
+    return NameTable::Default();
+}
+
+void Node::InternNames(NameTable& names)
+{
+    if (name->Table() == &names)
+    {
+        return;
+    }
+    if (name->Table())
+    {
+        name = names.Intern(name->QualifiedName());
+    }
+    namespaceUri = names.InternString(*namespaceUri);
+}
+
 void Node::SetNamespaceUri(const std::string& namespaceUri_)
 {
-    namespaceUri = namespaceUri_;
+    namespaceUri = Names().InternString(namespaceUri_);
 }
 
 std::string Node::Prefix() const
 {
     if (IsElementNode() || IsAttributeNode())
     {
-        auto colonPos = name.find(':');
-        if (colonPos != std::string::npos)
-        {
-            return name.substr(0, colonPos);
-        }
+        return name->Prefix();
     }
     return std::string();
 }
@@ -62,24 +116,13 @@ void Node::SetPrefix(const std::string& prefix)
 {
     if (IsElementNode() || IsAttributeNode())
     {
-        auto colonPos = name.find(':');
         if (prefix.empty())
         {
-            if (colonPos != std::string::npos)
-            {
-                name = name.substr(colonPos + 1);
-            }
+            name = Names().Intern(name->LocalName());
         }
         else
         {
-            if (colonPos != std::string::npos)
-            {
-                name = prefix + ":" + name.substr(colonPos + 1);
-            }
-            else
-            {
-                name = prefix + ":" + name;
-            }
+            name = Names().Intern(prefix + ":" + name->LocalName());
         }
     }
     else
@@ -92,15 +135,7 @@ std::string Node::LocalName() const
 {
     if (IsElementNode() || IsAttributeNode())
     {
-        auto colonPos = name.find(':');
-        if (colonPos != std::string::npos)
-        {
-            return name.substr(colonPos + 1);
-        }
-        else
-        {
-            return name;
-        }
+        return name->LocalName();
     }
     else
     {
@@ -202,19 +237,18 @@ void Node::WalkPrecedingOrSelf(NodeOperation& operation)
 
 void Node::WalkAncestor(NodeOperation& operation)
 {
-    if (parent)
+    Node* ancestor = parent;
+    while (ancestor)
     {
-        parent->WalkAncestorOrSelf(operation);
+        operation.Apply(ancestor);
+        ancestor = ancestor->parent;
     }
 }
 
 void Node::WalkAncestorOrSelf(NodeOperation& operation)
 {
     operation.Apply(this);
-    if (parent)
-    {
-        parent->WalkAncestorOrSelf(operation);
-    }
+    WalkAncestor(operation);
 }
 
 void Node::WalkFollowingSibling(NodeOperation& operation)
@@ -9,6 +9,8 @@ import std.core;
 import util.code.formatter;
 import soul.ast.source.pos;
 import soul.xml.axis;
+import soul.xml.name.table;
+import soul.xml.arena;
 
 export namespace soul::xml {
 
@@ -20,20 +22,42 @@ enum class NodeKind
 std::string NodeKindStr(NodeKind nodeKind);
 
 class ParentNode;
+class Element;
 class Document;
 class Visitor;
 class NodeOperation;
 
+//  ===================================================================================================
+//  DetachedRefs holds what the nodes of a subtree removed from a document need from the document: the
+//  arenas of arena allocated nodes and the name table in which the names of the nodes are interned.
+//  The root of the detached subtree holds them until the subtree is deleted or inserted to a document.
+//  ===================================================================================================
+
+struct DetachedRefs
+{
+    ArenaRefs arenaRefs;
+    std::shared_ptr<NameTable> nameTable;
+};
+
 class Node
 {
 public:
     Node(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_);
+    Node(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_);
     virtual ~Node();
+    static void operator delete(Node* node, std::destroying_delete_t);
+    bool IsArenaAllocated() const { return arenaAllocated; }
+    bool HoldsDetachedRefs() const { return detachedRefs != nullptr; }
     NodeKind Kind() const { return kind; }
     const soul::ast::SourcePos& GetSourcePos() const { return sourcePos; }
-    const std::string& Name() const { return name; }
-    const std::string& NamespaceUri() const { return namespaceUri; }
+    const std::string& Name() const { return name->QualifiedName(); }
+    const soul::xml::Name* GetName() const { return name; }
+    const std::string& NamespaceUri() const { return *namespaceUri; }
+    const std::string* GetNamespaceUri() const { return namespaceUri; }
     void SetNamespaceUri(const std::string& namespaceUri_);
+    void SetNamespaceUri(const std::string* namespaceUri_) { namespaceUri = namespaceUri_; }
+    NameTable& Names() const;
+    virtual void InternNames(NameTable& names);
     bool IsAttributeNode() const { return kind == NodeKind::attributeNode; }
     bool IsDocumentFragmentNode() const { return kind == NodeKind::documentFragmentNode; }
     bool IsDocumentNode() const { return kind == NodeKind::documentNode; }
@@ -73,6 +97,10 @@ public:
     virtual void Write(util::CodeFormatter& formatter) = 0;
 private:
     friend class ParentNode;
+    friend class Element;
+    friend class Document;
+    template<typename NodeType, typename... Args>
+    friend NodeType* MakeNode(Arena* arena, Args&&... args);
     void SetParent(ParentNode* parent_) { parent = parent_; }
     void SetPrev(Node* prev_) { prev = prev_; }
     void SetNext(Node* next_) { next = next_; }
@@ -80,13 +108,44 @@ private:
     void LinkAfter(Node* node);
     void Unlink();
     NodeKind kind;
+    bool arenaAllocated;
     soul::ast::SourcePos sourcePos;
-    std::string name;
-    std::string namespaceUri;
+    const soul::xml::Name* name;
+    const std::string* namespaceUri;
     ParentNode* parent;
     Node* prev;
     Node* next;
     Document* ownerDocument;
+    std::unique_ptr<DetachedRefs> detachedRefs;
 };
 
+//  ===================================================================================================
+//  MakeNode constructs a node in memory allocated from given arena, or from the heap if the arena 
+//  is null. A node type whose constructor takes an arena as its first argument gets the arena too,
+//  so that the text and attributes given to the constructor are allocated from it. Deleting an arena 
+//  allocated node runs its destructor, and its memory is released with the arena. Deleting the root 
+//  of a detached subtree releases the arena and name table references it holds.
+//  ===================================================================================================
+
+template<typename NodeType, typename... Args>
+NodeType* MakeNode(Arena* arena, Args&&... args)
+{
+    if (!arena)
+    {
+        return new NodeType(std::forward<Args>(args)...);
+    }
+    void* memory = arena->Allocate(sizeof(NodeType), alignof(NodeType));
+    NodeType* node = nullptr;
+    if constexpr (std::is_constructible_v<NodeType, Arena*, Args...>)
+    {
+        node = ::new (memory) NodeType(arena, std::forward<Args>(args)...);
+    }
+    else
+    {
+        node = ::new (memory) NodeType(std::forward<Args>(args)...);
+    }
+    node->arenaAllocated = true;
+    return node;
+}
+
 } // namespace soul::xml
@@ -12,6 +12,7 @@ import soul.lexer.error;
 import soul.lexer.file.map;
 import soul.xml.visitor;
 import soul.xml.node.operation;
+import soul.xml.axis.iterator;
 
 namespace soul::xml {
 
@@ -19,7 +20,41 @@ ParentNode::ParentNode(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, c
 {
 }
 
+ParentNode::ParentNode(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_) : Node(kind_, sourcePos_, name_), firstChild(nullptr), lastChild(nullptr)
+{
+}
+
 ParentNode::~ParentNode()
+{
+    DeleteChildren();
+}
+
+void SetSubtreeOwnerDocument(Node* subtreeRoot, Document* document)
+{
+    for (Node* node : DescendantsOrSelf(subtreeRoot))
+    {
+        node->SetOwnerDocument(document);
+        if (document)
+        {
+            node->InternNames(*document->GetNameTable());
+            if (node->HoldsDetachedRefs())
+            {
+                document->AdoptDetachedRefs(node);
+            }
+        }
+    }
+}
+
+Document* ParentNode::ContainingDocument()
+{
+    if (IsDocumentNode())
+    {
+        return static_cast<Document*>(this);
+    }
+    return OwnerDocument();
+}
+
+void ParentNode::DeleteChildren()
 {
     Node* child = firstChild;
     while (child)
@@ -28,6 +63,8 @@ ParentNode::~ParentNode()
         child = child->Next();
         delete toDel;
     }
+    firstChild = nullptr;
+    lastChild = nullptr;
 }
 
 void ParentNode::AppendChild(Node* child)
@@ -36,13 +73,16 @@ void ParentNode::AppendChild(Node* child)
     {
         throw XmlException("could not append child node: given child is null", GetSourcePos());
     }
-    if (OwnerDocument())
-    {
-        OwnerDocument()->InvalidateIndex();
-    }
     if (child->Parent())
     {
-        child = child->Parent()->RemoveChild(child).release();
+        if (IsMoveWithinDocument(child))
+        {
+            child->Parent()->UnlinkChild(child);
+        }
+        else
+        {
+            child = child->Parent()->RemoveChild(child).release();
+        }
     }
     if (child->IsDocumentFragmentNode())
     {
@@ -66,9 +106,9 @@ void ParentNode::AppendChild(Node* child)
         {
             firstChild = child;
         }
-        child->SetOwnerDocument(OwnerDocument());
         child->SetParent(this);
         lastChild = child;
+        Attach(child);
     }
 }
 
@@ -81,10 +121,7 @@ void ParentNode::InsertBefore(Node* newChild, Node* refChild)
     if (refChild == nullptr)
     {
         AppendChild(newChild);
-    }
-    if (OwnerDocument())
-    {
-        OwnerDocument()->InvalidateIndex();
+        return;
     }
     if (newChild->IsDocumentFragmentNode())
     {
@@ -102,15 +139,22 @@ void ParentNode::InsertBefore(Node* newChild, Node* refChild)
     {
         if (newChild->Parent())
         {
-            newChild = newChild->Parent()->RemoveChild(newChild).release();
+            if (IsMoveWithinDocument(newChild))
+            {
+                newChild->Parent()->UnlinkChild(newChild);
+            }
+            else
+            {
+                newChild = newChild->Parent()->RemoveChild(newChild).release();
+            }
         }
         if (firstChild == refChild)
         {
             firstChild = newChild;
         }
         newChild->SetParent(this);
-        newChild->SetOwnerDocument(OwnerDocument());
         refChild->LinkBefore(newChild);
+        Attach(newChild);
     }
 }
 
@@ -136,11 +180,79 @@ std::unique_ptr<Node> ParentNode::RemoveChild(Node* child)
         }
         throw XmlException(errorMessage, sourcePos);
     }
-    if (OwnerDocument())
+    KeepDetachedRefs(child);
+    Document* document = ContainingDocument();
+    if (document)
     {
-        OwnerDocument()->InvalidateIndex();
+        document->RemoveFromIndexes(child);
+        SetSubtreeOwnerDocument(child, nullptr);
     }
-    child->Unlink();
+    UnlinkChild(child);
+    return std::unique_ptr<Node>(child);
+}
+
+void ParentNode::KeepDetachedRefs(Node* child)
+{
+    ArenaRefs arenaRefs;
+    std::shared_ptr<NameTable> nameTable;
+    Document* document = ContainingDocument();
+    if (document)
+    {
+        arenaRefs = document->GetArenaRefs();
+        nameTable = document->GetNameTable();
+    }
+    else
+    {
+        for (Node* ancestor = this; ancestor; ancestor = ancestor->Parent())
+        {
+            if (ancestor->HoldsDetachedRefs())
+            {
+                AddArenaRefs(arenaRefs, ancestor->detachedRefs->arenaRefs);
+                if (!nameTable)
+                {
+                    nameTable = ancestor->detachedRefs->nameTable;
+                }
+            }
+        }
+    }
+    bool arenaAllocated = false;
+    if (!arenaRefs.empty())
+    {
+        for (Node* node : DescendantsOrSelf(child))
+        {
+            if (node->IsArenaAllocated())
+            {
+                arenaAllocated = true;
+                break;
+            }
+        }
+    }
+    if (!arenaAllocated && !nameTable)
+    {
+        return;
+    }
+    if (!child->detachedRefs)
+    {
+        child->detachedRefs.reset(new DetachedRefs());
+    }
+    if (arenaAllocated)
+    {
+        AddArenaRefs(child->detachedRefs->arenaRefs, arenaRefs);
+    }
+    if (!child->detachedRefs->nameTable)
+    {
+        child->detachedRefs->nameTable = nameTable;
+    }
+}
+
+bool ParentNode::IsMoveWithinDocument(Node* child)
+{
+    Document* document = ContainingDocument();
+    return document && child->OwnerDocument() == document && !child->Parent()->IsDocumentNode();
+}
+
+void ParentNode::UnlinkChild(Node* child)
+{
     if (child == firstChild)
     {
         firstChild = child->Next();
@@ -149,10 +261,27 @@ std::unique_ptr<Node> ParentNode::RemoveChild(Node* child)
     {
         lastChild = child->Prev();
     }
-    std::unique_ptr<Node> removedNode = std::unique_ptr<Node>(child);
-    removedNode->SetOwnerDocument(nullptr);
-    removedNode->SetParent(nullptr);
-    return removedNode;
+    child->Unlink();
+    child->SetPrev(nullptr);
+    child->SetNext(nullptr);
+    child->SetParent(nullptr);
+}
+
+void ParentNode::Attach(Node* child)
+{
+    Document* document = ContainingDocument();
+    if (child->OwnerDocument() != document)
+    {
+        SetSubtreeOwnerDocument(child, document);
+        if (document)
+        {
+            document->AddToIndexes(child);
+        }
+    }
+    else if (document && child->HoldsDetachedRefs())
+    {
+        document->AdoptDetachedRefs(child);
+    }
 }
 
 std::unique_ptr<Node> ParentNode::ReplaceChild(Node* newChild, Node* oldChild)
@@ -181,10 +310,6 @@ std::unique_ptr<Node> ParentNode::ReplaceChild(Node* newChild, Node* oldChild)
         }
         throw XmlException(errorMessage, sourcePos);
     }
-    if (OwnerDocument())
-    {
-        OwnerDocument()->InvalidateIndex();
-    }
     if (newChild->Parent())
     {
         newChild = newChild->Parent()->RemoveChild(newChild).release();
@@ -225,22 +350,17 @@ void ParentNode::WalkChildren(NodeOperation& operation)
 
 void ParentNode::WalkDescendant(NodeOperation& operation)
 {
-    Node* child = firstChild;
-    while (child)
+    for (Node* node : Descendants(this))
     {
-        child->WalkDescendantOrSelf(operation);
-        child = child->Next();
+        operation.Apply(node);
     }
 }
 
 void ParentNode::WalkDescendantOrSelf(NodeOperation& operation)
 {
-    Node::WalkDescendantOrSelf(operation);
-    Node* child = firstChild;
-    while (child)
+    for (Node* node : DescendantsOrSelf(this))
     {
-        child->WalkDescendantOrSelf(operation);
-        child = child->Next();
+        operation.Apply(node);
     }
 }
 
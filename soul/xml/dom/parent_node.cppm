@@ -7,6 +7,7 @@ export module soul.xml.parent.node;
 
 import std.core;
 import soul.xml.node;
+import soul.xml.name.table;
 
 export namespace soul::xml {
 
@@ -14,6 +15,7 @@ class ParentNode : public Node
 {
 public:
     ParentNode(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_);
+    ParentNode(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_);
     ~ParentNode();
     virtual void AppendChild(Node* child);
     virtual void InsertBefore(Node* newChild, Node* refChild);
@@ -22,6 +24,7 @@ public:
     bool HasChildNodes() const final { return firstChild != nullptr; }
     Node* FirstChild() const { return firstChild; }
     Node* LastChild() const { return lastChild; }
+    Document* ContainingDocument();
     void Accept(Visitor& visitor) override;
     void Write(util::CodeFormatter& formatter) override;
     void WalkChildren(NodeOperation& operation) override;
@@ -29,7 +32,13 @@ public:
     void WalkDescendantOrSelf(NodeOperation& operation) override;
     void WalkPreceding(NodeOperation& operation) override;
     void WalkPrecedingOrSelf(NodeOperation& operation) override;
+protected:
+    void DeleteChildren();
 private:
+    bool IsMoveWithinDocument(Node* child);
+    void UnlinkChild(Node* child);
+    void Attach(Node* child);
+    void KeepDetachedRefs(Node* child);
     Node* firstChild;
     Node* lastChild;
 };
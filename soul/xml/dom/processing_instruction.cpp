@@ -15,7 +15,12 @@ ProcessingInstruction::ProcessingInstruction(const soul::ast::SourcePos& sourceP
 }
 
 ProcessingInstruction::ProcessingInstruction(const soul::ast::SourcePos& sourcePos_, const std::string& target_, const std::string& data_) : 
-    Node(NodeKind::processingInstructionNode, sourcePos_, "processing_instruction"), target(target_), data(data_)
+    ProcessingInstruction(nullptr, sourcePos_, target_, data_)
+{
+}
+
+ProcessingInstruction::ProcessingInstruction(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& target_, const std::string& data_) :
+    Node(NodeKind::processingInstructionNode, sourcePos_, "processing_instruction"), target(target_, arena), data(data_, arena)
 {
 }
 
@@ -26,7 +31,7 @@ void ProcessingInstruction::Accept(Visitor& visitor)
 
 void ProcessingInstruction::Write(util::CodeFormatter& formatter)
 {
-    formatter.WriteLine("<?" + target + " " + data + "?>");
+    formatter.WriteLine("<?" + std::string(Target()) + " " + std::string(Data()) + "?>");
 }
 
 ProcessingInstruction* MakeProcessingInstruction(const std::string& target, const std::string& data)
@@ -7,6 +7,7 @@ export module soul.xml.processing.instruction;
 
 import std.core;
 import soul.xml.node;
+import soul.xml.arena;
 
 export namespace soul::xml {
 
@@ -15,13 +16,14 @@ class ProcessingInstruction : public Node
 public:
     ProcessingInstruction(const soul::ast::SourcePos& sourcePos_);
     ProcessingInstruction(const soul::ast::SourcePos& sourcePos_, const std::string& target_, const std::string& data_);
-    const std::string& Target() const { return target; }
-    const std::string& Data() const { return data; }
+    ProcessingInstruction(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& target_, const std::string& data_);
+    std::string_view Target() const { return target.View(); }
+    std::string_view Data() const { return data.View(); }
     void Accept(Visitor& visitor) override;
     void Write(util::CodeFormatter& formatter) override;
 private:
-    std::string target;
-    std::string data;
+    ArenaString target;
+    ArenaString data;
 };
 
 ProcessingInstruction* MakeProcessingInstruction(const std::string& target, const std::string& data);
@@ -0,0 +1,426 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.xml.serializer;
+
+import soul.xml.document;
+import soul.xml.character.data;
+import soul.xml.processing.instruction;
+import soul.xml.attribute.node;
+import soul.xml.parent.node;
+import soul.xml.axis.iterator;
+import soul.xml.name.table;
+import util;
+
+namespace soul::xml {
+
+XmlSerializer::XmlSerializer(std::string& buffer_) :
+    buffer(buffer_), stream(nullptr), indentSize(4), compact(false), indent(0), atBeginningOfLine(true), preserveSpace(false), 
+    xmlSpaceNames(nullptr), xmlSpace(nullptr)
+{
+}
+
+XmlSerializer::XmlSerializer(util::Stream& stream_) :
+    buffer(ownBuffer), stream(&stream_), indentSize(4), compact(false), indent(0), atBeginningOfLine(true), preserveSpace(false), 
+    xmlSpaceNames(nullptr), xmlSpace(nullptr)
+{
+}
+
+void XmlSerializer::Write(Node* node)
+{
+    indent = 0;
+    atBeginningOfLine = true;
+    preserveSpace = false;
+    xmlSpaceNames = nullptr;
+    xmlSpace = nullptr;
+    elementFrames.clear();
+    Node* root = node;
+    while (node)
+    {
+        if (BeginNode(node))
+        {
+            node = FirstChildOf(node);
+            continue;
+        }
+        while (node != root && !node->Next())
+        {
+            node = node->Parent();
+            if (node->IsElementNode())
+            {
+                EndElement(static_cast<Element*>(node));
+            }
+        }
+        if (stream && buffer.size() >= xmlSerializerFlushThreshold)
+        {
+            Flush();
+        }
+        if (node == root)
+        {
+            break;
+        }
+        node = node->Next();
+    }
+    if (stream)
+    {
+        Flush();
+    }
+}
+
+bool XmlSerializer::BeginNode(Node* node)
+{
+    switch (node->Kind())
+    {
+        case NodeKind::elementNode:
+        {
+            return BeginElement(static_cast<Element*>(node));
+        }
+        case NodeKind::documentNode:
+        {
+            Document* document = static_cast<Document*>(node);
+            if (!document->XmlVersion().empty() && !document->XmlEncoding().empty())
+            {
+                BeginLine();
+                buffer.append("<?xml version=\"").append(document->XmlVersion()).append("\" encoding=\"").append(document->XmlEncoding()).append("\"?>");
+                NewLine();
+            }
+            return document->HasChildNodes();
+        }
+        case NodeKind::documentFragmentNode:
+        {
+            return node->HasChildNodes();
+        }
+        case NodeKind::textNode:
+        {
+            BeginLine();
+            WriteCharData(static_cast<CharacterData*>(node)->Data());
+            break;
+        }
+        case NodeKind::cdataSectionNode:
+        {
+            BeginLine();
+            buffer.append("<![CDATA[").append(static_cast<CharacterData*>(node)->Data()).append("]]>");
+            break;
+        }
+        case NodeKind::commentNode:
+        {
+            BeginLine();
+            buffer.append("<!-- ").append(static_cast<CharacterData*>(node)->Data()).append(" -->");
+            break;
+        }
+        case NodeKind::entityReferenceNode:
+        {
+            BeginLine();
+            buffer.append(1, '&').append(static_cast<CharacterData*>(node)->Data()).append(1, ';');
+            break;
+        }
+        case NodeKind::processingInstructionNode:
+        {
+            ProcessingInstruction* pi = static_cast<ProcessingInstruction*>(node);
+            BeginLine();
+            buffer.append("<?").append(pi->Target()).append(1, ' ').append(pi->Data()).append("?>");
+            NewLine();
+            break;
+        }
+        case NodeKind::attributeNode:
+        {
+            AttributeNode* attribute = static_cast<AttributeNode*>(node);
+            BeginLine();
+            buffer.append(1, ' ').append(attribute->Name()).append(1, '=');
+            WriteAttributeValue(attribute->Value());
+            break;
+        }
+    }
+    return false;
+}
+
+bool XmlSerializer::BeginElement(Element* element)
+{
+    BeginLine();
+    buffer.append(1, '<').append(element->Name());
+    WriteAttributes(element);
+    if (!element->HasChildNodes())
+    {
+        buffer.append("/>");
+        NewLine();
+        return false;
+    }
+    buffer.append(1, '>');
+    NameTable* names = &element->Names();
+    if (names != xmlSpaceNames)
+    {
+        xmlSpaceNames = names;
+        xmlSpace = names->Find("xml:space");
+    }
+    bool prevPreserveSpace = preserveSpace;
+    for (const AttributeEntry& attribute : element->Attributes())
+    {
+        if (attribute.GetName() == xmlSpace)
+        {
+            if (attribute.Value() == "preserve")
+            {
+                preserveSpace = true;
+            }
+            break;
+        }
+    }
+    Node* firstChild = element->FirstChild();
+    bool multilineContent = firstChild != element->LastChild() || firstChild->IsElementNode() || firstChild->IsDocumentNode() ||
+        firstChild->ValueContainsNewLine();
+    bool elementPreserveSpace = preserveSpace || !multilineContent;
+    if (!elementPreserveSpace)
+    {
+        NewLine();
+        ++indent;
+    }
+    elementFrames.push_back(ElementFrame(elementPreserveSpace, prevPreserveSpace));
+    return true;
+}
+
+void XmlSerializer::EndElement(Element* element)
+{
+    ElementFrame frame = elementFrames.back();
+    elementFrames.pop_back();
+    if (!frame.preserveSpace)
+    {
+        --indent;
+    }
+    BeginLine();
+    buffer.append("</").append(element->Name()).append(1, '>');
+    if (!frame.preserveSpace || !frame.prevPreserveSpace)
+    {
+        NewLine();
+    }
+    preserveSpace = frame.prevPreserveSpace;
+}
+
+void XmlSerializer::WriteAttributes(Element* element)
+{
+    for (const AttributeEntry& attribute : element->Attributes())
+    {
+        buffer.append(1, ' ').append(attribute.Name()).append(1, '=');
+        WriteAttributeValue(attribute.Value());
+    }
+}
+
+void XmlSerializer::WriteCharData(std::string_view text)
+{
+    const char* start = text.data();
+    const char* end = start + text.size();
+    const char* p = start;
+    while (p != end)
+    {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c >= 32 && c < 127 && c != '<' && c != '&')
+        {
+            ++p;
+            continue;
+        }
+        buffer.append(start, p - start);
+        if (c == '<')
+        {
+            buffer.append("&lt;");
+            ++p;
+        }
+        else if (c == '&')
+        {
+            buffer.append("&amp;");
+            ++p;
+        }
+        else if (c == '\r' || c == '\n')
+        {
+            buffer.append(1, static_cast<char>(c));
+            ++p;
+        }
+        else if (c < 128)
+        {
+            WriteCharRef(c);
+            ++p;
+        }
+        else
+        {
+            const char* nonAsciiEnd = p;
+            while (nonAsciiEnd != end && static_cast<unsigned char>(*nonAsciiEnd) >= 128)
+            {
+                ++nonAsciiEnd;
+            }
+            WriteCharRefs(p, nonAsciiEnd);
+            p = nonAsciiEnd;
+        }
+        start = p;
+    }
+    buffer.append(start, p - start);
+}
+
+void XmlSerializer::WriteAttributeValue(std::string_view value)
+{
+    char delimiter = '"';
+    if (value.find('"') != std::string_view::npos && value.find('\'') == std::string_view::npos)
+    {
+        delimiter = '\'';
+    }
+    buffer.append(1, delimiter);
+    const char* start = value.data();
+    const char* end = start + value.size();
+    const char* p = start;
+    while (p != end)
+    {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c >= 32 && c < 127 && c != '<' && c != '&' && c != delimiter)
+        {
+            ++p;
+            continue;
+        }
+        buffer.append(start, p - start);
+        if (c == '<')
+        {
+            buffer.append("&lt;");
+            ++p;
+        }
+        else if (c == '&')
+        {
+            buffer.append("&amp;");
+            ++p;
+        }
+        else if (c == '"')
+        {
+            buffer.append("&quot;");
+            ++p;
+        }
+        else if (c == '\'')
+        {
+            buffer.append("&apos;");
+            ++p;
+        }
+        else if (c < 128)
+        {
+            WriteCharRef(c);
+            ++p;
+        }
+        else
+        {
+            const char* nonAsciiEnd = p;
+            while (nonAsciiEnd != end && static_cast<unsigned char>(*nonAsciiEnd) >= 128)
+            {
+                ++nonAsciiEnd;
+            }
+            WriteCharRefs(p, nonAsciiEnd);
+            p = nonAsciiEnd;
+        }
+        start = p;
+    }
+    buffer.append(start, p - start);
+    buffer.append(1, delimiter);
+}
+
+void XmlSerializer::WriteCharRefs(const char* begin, const char* end)
+{
+    //  decodes well-formed UTF-8 in place and leaves anything else to util::ToUtf32 so that errors are reported the same way as before
+    const char* p = begin;
+    while (p != end)
+    {
+        unsigned char c = static_cast<unsigned char>(*p);
+        int length = 0;
+        uint32_t codePoint = 0;
+        uint32_t minCodePoint = 0;
+        if ((c & 0xE0) == 0xC0)
+        {
+            length = 2;
+            codePoint = c & 0x1F;
+            minCodePoint = 0x80;
+        }
+        else if ((c & 0xF0) == 0xE0)
+        {
+            length = 3;
+            codePoint = c & 0x0F;
+            minCodePoint = 0x800;
+        }
+        else if ((c & 0xF8) == 0xF0)
+        {
+            length = 4;
+            codePoint = c & 0x07;
+            minCodePoint = 0x10000;
+        }
+        bool valid = length != 0 && end - p >= length;
+        for (int i = 1; valid && i < length; ++i)
+        {
+            unsigned char b = static_cast<unsigned char>(p[i]);
+            if ((b & 0xC0) != 0x80)
+            {
+                valid = false;
+            }
+            codePoint = (codePoint << 6) | (b & 0x3F);
+        }
+        if (!valid || codePoint < minCodePoint || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+        {
+            std::u32string rest = util::ToUtf32(std::string(p, end));
+            for (char32_t r : rest)
+            {
+                WriteCharRef(static_cast<uint32_t>(r));
+            }
+            return;
+        }
+        WriteCharRef(codePoint);
+        p += length;
+    }
+}
+
+void XmlSerializer::WriteCharRef(uint32_t codePoint)
+{
+    char digits[16];
+    char* p = digits + sizeof(digits);
+    *--p = ';';
+    do
+    {
+        *--p = static_cast<char>('0' + codePoint % 10);
+        codePoint /= 10;
+    } 
+    while (codePoint != 0);
+    *--p = '#';
+    *--p = '&';
+    buffer.append(p, digits + sizeof(digits) - p);
+}
+
+void XmlSerializer::BeginLine()
+{
+    if (atBeginningOfLine && indent > 0 && !compact)
+    {
+        int indentLength = indent * indentSize;
+        if (static_cast<int>(indentation.size()) < indentLength)
+        {
+            indentation.assign(2 * indentLength, ' ');
+        }
+        buffer.append(indentation.data(), indentLength);
+        atBeginningOfLine = false;
+    }
+}
+
+void XmlSerializer::NewLine()
+{
+    if (!compact)
+    {
+        buffer.append(1, '\n');
+        atBeginningOfLine = true;
+    }
+}
+
+void XmlSerializer::Flush()
+{
+    if (!buffer.empty())
+    {
+        stream->Write(reinterpret_cast<uint8_t*>(buffer.data()), static_cast<int64_t>(buffer.size()));
+        buffer.clear();
+    }
+}
+
+std::string ToXmlString(Node* node, bool compact)
+{
+    std::string xml;
+    XmlSerializer serializer(xml);
+    serializer.SetCompact(compact);
+    serializer.Write(node);
+    return xml;
+}
+
+} // namespace soul::xml
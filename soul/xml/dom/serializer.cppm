@@ -0,0 +1,71 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.xml.serializer;
+
+import std.core;
+import soul.xml.node;
+import soul.xml.element;
+import soul.xml.name.table;
+import util.stream;
+
+export namespace soul::xml {
+
+//  ===================================================================================================
+//  XmlSerializer writes a node and its subtree as XML to a growable byte buffer or to a util::Stream.
+//  In indented mode the output is identical to the output of Node::Write to a CodeFormatter with the
+//  same indent size. In compact mode no line breaks or indentation are written between the nodes.
+//  The text is escaped directly into the buffer, and a stream is written to whenever the buffer
+//  grows beyond the flush threshold and when Write returns. The subtree is traversed without
+//  recursion.
+//  ===================================================================================================
+
+const int64_t xmlSerializerFlushThreshold = 64 * 1024;
+
+class XmlSerializer
+{
+public:
+    XmlSerializer(std::string& buffer_);
+    XmlSerializer(util::Stream& stream_);
+    int IndentSize() const { return indentSize; }
+    void SetIndentSize(int indentSize_) { indentSize = indentSize_; }
+    bool Compact() const { return compact; }
+    void SetCompact(bool compact_) { compact = compact_; }
+    void Write(Node* node);
+private:
+    struct ElementFrame
+    {
+        ElementFrame(bool preserveSpace_, bool prevPreserveSpace_) : preserveSpace(preserveSpace_), prevPreserveSpace(prevPreserveSpace_) {}
+        bool preserveSpace;
+        bool prevPreserveSpace;
+    };
+    bool BeginNode(Node* node);
+    bool BeginElement(Element* element);
+    void EndElement(Element* element);
+    void WriteAttributes(Element* element);
+    void WriteCharData(std::string_view text);
+    void WriteAttributeValue(std::string_view value);
+    void WriteCharRefs(const char* begin, const char* end);
+    void WriteCharRef(uint32_t codePoint);
+    void BeginLine();
+    void NewLine();
+    void Flush();
+    std::string ownBuffer;
+    std::string& buffer;
+    util::Stream* stream;
+    int indentSize;
+    bool compact;
+    int indent;
+    bool atBeginningOfLine;
+    bool preserveSpace;
+    NameTable* xmlSpaceNames;
+    const soul::xml::Name* xmlSpace;
+    std::string indentation;
+    std::vector<ElementFrame> elementFrames;
+};
+
+std::string ToXmlString(Node* node, bool compact);
+
+} // namespace soul::xml
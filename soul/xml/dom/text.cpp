@@ -17,6 +17,10 @@ Text::Text(const soul::ast::SourcePos& sourcePos_, const std::string& text_) : C
 {
 }
 
+Text::Text(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& text_) : CharacterData(arena, NodeKind::textNode, sourcePos_, "text", text_)
+{
+}
+
 Text::Text(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_) : CharacterData(kind_, sourcePos_, name_)
 {
 }
@@ -25,6 +29,11 @@ Text::Text(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::st
 {
 }
 
+Text::Text(Arena* arena, NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_, const std::string& text_) : 
+    CharacterData(arena, kind_, sourcePos_, name_, text_)
+{
+}
+
 void Text::Accept(Visitor& visitor)
 {
     visitor.Visit(*this);
@@ -8,6 +8,7 @@ export module soul.xml.text;
 import std.core;
 import soul.xml.character.data;
 import soul.xml.node;
+import soul.xml.arena;
 
 export namespace soul::xml {
 
@@ -16,8 +17,10 @@ class Text : public CharacterData
 public:
     Text(const soul::ast::SourcePos& sourcePos_);
     Text(const soul::ast::SourcePos& sourcePos_, const std::string& text_);
+    Text(Arena* arena, const soul::ast::SourcePos& sourcePos_, const std::string& text_);
     Text(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_);
     Text(NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_, const std::string& text_);
+    Text(Arena* arena, NodeKind kind_, const soul::ast::SourcePos& sourcePos_, const std::string& name_, const std::string& text_);
     void Accept(Visitor& visitor) override;
 };
 
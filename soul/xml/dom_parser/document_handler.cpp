@@ -10,13 +10,62 @@ import util;
 
 namespace soul::xml {
 
-DocumentHandler::DocumentHandler(soul::xml::ParsingFlags flags_) : currentParentNode(nullptr), flags(flags_)
+TextContent::TextContent() : sourcePos(), content()
 {
 }
 
+void TextContent::Add(const soul::ast::SourcePos& sourcePos_, const std::string& text)
+{
+    if (!sourcePos.IsValid())
+    {
+        sourcePos = sourcePos_;
+    }
+    content.append(text);
+}
+
+void TextContent::AppendTo(soul::xml::Element* element, soul::xml::Arena* arena, bool addSpace)
+{
+    if (element)
+    {
+        content = util::TrimAll(content);
+        if (!content.empty())
+        {
+            if (addSpace)
+            {
+                content.append(1, ' ');
+            }
+            element->AppendChild(soul::xml::MakeNode<soul::xml::Text>(arena, sourcePos, content));
+            sourcePos = soul::ast::SourcePos();
+        }
+    }
+    content.clear();
+}
+
+void TextContent::Clear()
+{
+    sourcePos = soul::ast::SourcePos();
+    content.clear();
+}
+
+DocumentHandler::DocumentHandler(soul::xml::ParsingFlags flags_) : currentParentNode(nullptr), flags(flags_), arena(nullptr), nameTable(new soul::xml::NameTable())
+{
+    SetNameTable(nameTable.get());
+}
+
+DocumentHandler::DocumentHandler(soul::xml::ParsingFlags flags_, const std::shared_ptr<soul::xml::NameTable>& nameTable_) : 
+    currentParentNode(nullptr), flags(flags_), arena(nullptr), nameTable(nameTable_)
+{
+    if (!nameTable)
+    {
+        nameTable.reset(new soul::xml::NameTable());
+    }
+    SetNameTable(nameTable.get());
+}
+
 void DocumentHandler::StartDocument(const soul::ast::SourcePos& sourcePos)
 {
-    document.reset(new soul::xml::Document(sourcePos));
+    document.reset(new soul::xml::Document(sourcePos, (flags & ParsingFlags::arenaAllocation) != ParsingFlags::none, nameTable));
+    arena = document->GetArena();
     currentParentNode = document.get();
 }
 
@@ -38,28 +87,24 @@ void DocumentHandler::Standalone(bool standalone)
 void DocumentHandler::Comment(const soul::ast::SourcePos& sourcePos, const std::string& comment)
 {
     AddTextContent();
-    currentParentNode->AppendChild(new soul::xml::Comment(sourcePos, comment));
+    currentParentNode->AppendChild(soul::xml::MakeNode<soul::xml::Comment>(arena, sourcePos, comment));
 }
 
 void DocumentHandler::PI(const soul::ast::SourcePos& sourcePos, const std::string& target, const std::string& data)
 {
     AddTextContent();
-    currentParentNode->AppendChild(new soul::xml::ProcessingInstruction(sourcePos, target, data));
+    currentParentNode->AppendChild(soul::xml::MakeNode<soul::xml::ProcessingInstruction>(arena, sourcePos, target, data));
 }
 
 void DocumentHandler::Text(const soul::ast::SourcePos& sourcePos, const std::string& text)
 {
-    if (!textSourcePos.IsValid())
-    {
-        textSourcePos = sourcePos;
-    }
-    textContent.append(text);
+    textContent.Add(sourcePos, text);
 }
 
 void DocumentHandler::CDataSection(const soul::ast::SourcePos& sourcePos, const std::string& cdata)
 {
     AddTextContent();
-    currentParentNode->AppendChild(new soul::xml::CDataSection(sourcePos, cdata));
+    currentParentNode->AppendChild(soul::xml::MakeNode<soul::xml::CDataSection>(arena, sourcePos, cdata));
 }
 
 void DocumentHandler::StartElement(const soul::ast::SourcePos& sourcePos, const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName,
@@ -68,19 +113,34 @@ void DocumentHandler::StartElement(const soul::ast::SourcePos& sourcePos, const
     AddTextContent(true);
     parentNodeStack.push(currentParentNode);
     elementStack.push(std::move(currentElement));
-    currentElement.reset(new soul::xml::Element(sourcePos, qualifiedName));
+    currentElement.reset(soul::xml::MakeNode<soul::xml::Element>(arena, sourcePos, qualifiedName));
     currentParentNode = currentElement.get();
     for (const auto& attribute : attributes.GetAttributes())
     {
         currentElement->SetAttribute(sourcePos, attribute->QualifiedName(), attribute->Value());
     }
-    currentElement->SetOwnerDocument(document.get());
     if (!namespaceUri.empty())
     {
         currentElement->SetNamespaceUri(namespaceUri);
     }
 }
 
+void DocumentHandler::StartElement(const soul::ast::SourcePos& sourcePos, const std::string* namespaceUri, const soul::xml::Name* name,
+    const soul::xml::processor::Attributes& attributes)
+{
+    AddTextContent(true);
+    parentNodeStack.push(currentParentNode);
+    elementStack.push(std::move(currentElement));
+    currentElement.reset(soul::xml::MakeNode<soul::xml::Element>(arena, sourcePos, name));
+    currentParentNode = currentElement.get();
+    currentElement->ReserveAttributes(attributes.GetAttributes().size());
+    for (const auto& attribute : attributes.GetAttributes())
+    {
+        currentElement->SetAttribute(sourcePos, attribute->GetName(), attribute->Value());
+    }
+    currentElement->SetNamespaceUri(namespaceUri);
+}
+
 void DocumentHandler::EndElement(const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName) 
 {
     AddTextContent();
@@ -98,10 +158,10 @@ void DocumentHandler::SkippedEntity(const soul::ast::SourcePos& sourcePos, const
         auto lexer = GetLexer();
         std::cout << "warning: skipped entity '" << entityName << "' in file " <<
         
-            lexer->FileName() << " line " << std::to_string(sourcePos.line) << ":\n" << lexer->ErrorLines(sourcePos.pos) << std::endl;
+            lexer->FileName() << " line " << std::to_string(sourcePos.line) << ":\n" << lexer->ErrorLines(sourcePos) << std::endl;
     }
     AddTextContent();
-    currentParentNode->AppendChild(MakeEntityReference(entityName));
+    currentParentNode->AppendChild(soul::xml::MakeNode<soul::xml::EntityReference>(arena, sourcePos, entityName));
 }
 
 void DocumentHandler::AddTextContent()
@@ -111,20 +171,7 @@ void DocumentHandler::AddTextContent()
 
 void DocumentHandler::AddTextContent(bool addSpace)
 {
-    if (currentElement)
-    {
-        textContent = util::TrimAll(textContent);
-        if (!textContent.empty())
-        {
-            if (addSpace)
-            {
-                textContent.append(1, ' ');
-            }
-            currentElement->AppendChild(new soul::xml::Text(textSourcePos, textContent));
-            textSourcePos = soul::ast::SourcePos();
-        }
-    }
-    textContent.clear();
+    textContent.AppendTo(currentElement.get(), arena, addSpace);
 }
 
 } // namespace soul::xml
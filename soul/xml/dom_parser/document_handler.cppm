@@ -9,16 +9,36 @@ import std.core;
 import soul.xml.document;
 import soul.xml.element;
 import soul.xml.content.handler;
+import soul.xml.name.table;
+import soul.xml.arena;
 import soul.xml.dom.parser;
 
 export namespace soul::xml {
 
 class DocumentHandlerData;
 
+//  ===================================================================================================
+//  TextContent collects the character data reported between two markup events. AppendTo appends it 
+//  to an element as a single text node with surrounding white space trimmed, and clears it.
+//  ===================================================================================================
+
+class TextContent
+{
+public:
+    TextContent();
+    void Add(const soul::ast::SourcePos& sourcePos_, const std::string& text);
+    void AppendTo(soul::xml::Element* element, soul::xml::Arena* arena, bool addSpace);
+    void Clear();
+private:
+    soul::ast::SourcePos sourcePos;
+    std::string content;
+};
+
 class DocumentHandler : public soul::xml::XmlContentHandler
 {
 public:
     DocumentHandler(soul::xml::ParsingFlags flags_);
+    DocumentHandler(soul::xml::ParsingFlags flags_, const std::shared_ptr<soul::xml::NameTable>& nameTable_);
     std::unique_ptr<soul::xml::Document> GetDocument() { return std::move(document); };
     void StartDocument(const soul::ast::SourcePos& sourcePos) override;
     void XmlVersion(const std::string& xmlVersion) override;
@@ -30,19 +50,22 @@ public:
     void CDataSection(const soul::ast::SourcePos& sourcePos, const std::string& cdata) override;
     void StartElement(const soul::ast::SourcePos& sourcePos, const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName,
         const soul::xml::processor::Attributes& attributes) override;
+    void StartElement(const soul::ast::SourcePos& sourcePos, const std::string* namespaceUri, const soul::xml::Name* name,
+        const soul::xml::processor::Attributes& attributes) override;
     void EndElement(const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName) override;
     void SkippedEntity(const soul::ast::SourcePos& sourcePos, const std::string& entityName) override;
 private:
     void AddTextContent();
     void AddTextContent(bool addSpace);
     soul::xml::ParsingFlags flags;
+    soul::xml::Arena* arena;
+    std::shared_ptr<soul::xml::NameTable> nameTable;
     std::unique_ptr<soul::xml::Document> document;
     soul::xml::ParentNode* currentParentNode;
     std::stack<soul::xml::ParentNode*> parentNodeStack;
     std::unique_ptr<soul::xml::Element> currentElement;
     std::stack<std::unique_ptr<soul::xml::Element>> elementStack;
-    soul::ast::SourcePos textSourcePos;
-    std::string textContent;
+    TextContent textContent;
 };
 
 } // namespace soul::xml
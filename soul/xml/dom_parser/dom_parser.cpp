@@ -82,6 +82,70 @@ std::unique_ptr<soul::xml::Document> ParseXmlContent(std::u32string&& xmlContent
     return documentHandler.GetDocument();
 }
 
+class WorkerThreads
+{
+public:
+    WorkerThreads(int count)
+    {
+        threads.reserve(count);
+    }
+    ~WorkerThreads()
+    {
+        Join();
+    }
+    void Start(const std::function<void()>& work)
+    {
+        threads.push_back(std::thread(work));
+    }
+    void Join()
+    {
+        for (std::thread& thread : threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+    }
+private:
+    std::vector<std::thread> threads;
+};
+
+std::vector<XmlFileParseResult> ParseXmlFiles(const std::vector<std::string>& xmlFileNames, soul::lexer::FileMap& fileMap, ParsingFlags parsingFlags, int threadCount)
+{
+    std::vector<XmlFileParseResult> results(xmlFileNames.size());
+    if (threadCount <= 0)
+    {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    threadCount = std::max(1, std::min(threadCount, static_cast<int>(xmlFileNames.size())));
+    std::atomic<std::size_t> nextFileIndex(0);
+    auto parseFiles = [&]()
+    {
+        for (std::size_t i = nextFileIndex++; i < xmlFileNames.size(); i = nextFileIndex++)
+        {
+            XmlFileParseResult& result = results[i];
+            result.fileName = xmlFileNames[i];
+            try
+            {
+                result.document = ParseXmlFile(result.fileName, fileMap, parsingFlags);
+            }
+            catch (const std::exception& ex)
+            {
+                result.error = ex.what();
+            }
+        }
+    };
+    WorkerThreads workers(threadCount - 1);
+    for (int i = 1; i < threadCount; ++i)
+    {
+        workers.Start(parseFiles);
+    }
+    parseFiles();
+    workers.Join();
+    return results;
+}
+
 void SendDocument(util::TcpSocket& socket, soul::xml::Document& document)
 {
     std::stringstream sstream;
@@ -14,7 +14,7 @@ export namespace soul::xml {
 
 enum class ParsingFlags : int
 {
-    none = 0, generateWarnings = 1 << 0
+    none = 0, generateWarnings = 1 << 0, arenaAllocation = 1 << 1
 };
 
 constexpr ParsingFlags operator|(ParsingFlags left, ParsingFlags right)
@@ -60,6 +60,23 @@ std::unique_ptr<soul::xml::Document> ParseXmlContent(const std::u32string& xmlCo
 std::unique_ptr<soul::xml::Document> ParseXmlContent(std::u32string&& xmlContent, const std::string& systemId, soul::lexer::FileMap& fileMap);
 std::unique_ptr<soul::xml::Document> ParseXmlContent(std::u32string&& xmlContent, const std::string& systemId, soul::lexer::FileMap& fileMap, ParsingFlags parsingFlags);
 
+//  =======================================================================================================
+//  ParseXmlFiles parses given UTF-8 encoded XML files to DOM documents on a pool of worker threads.
+//  Each worker takes the next file not yet taken, so files of different size are balanced over the workers.
+//  The files are mapped to the thread-safe FileMap. If threadCount is 0, the number of hardware threads is used.
+//  The result contains an entry for each file in the order of the file names.
+//  If parsing a file fails, the document of its entry is null and the error contains the exception message.
+//  =======================================================================================================
+
+struct XmlFileParseResult
+{
+    std::string fileName;
+    std::unique_ptr<soul::xml::Document> document;
+    std::string error;
+};
+
+std::vector<XmlFileParseResult> ParseXmlFiles(const std::vector<std::string>& xmlFileNames, soul::lexer::FileMap& fileMap, ParsingFlags parsingFlags, int threadCount);
+
 void SendDocument(util::TcpSocket& socket, soul::xml::Document& document);
 std::unique_ptr<soul::xml::Document> ReceiveDocument(util::TcpSocket& socket);
 
@@ -7,15 +7,23 @@ module soul.xml.processor.attribute;
 
 namespace soul::xml::processor {
 
-Attribute::Attribute(const soul::ast::SourcePos& sourcePos_, const std::string& namespaceUri_, const std::string& localName_, const std::string& qualifiedName_, 
-    const std::string& value_) : sourcePos(sourcePos_), namespaceUri(namespaceUri_), localName(localName_), qualifiedName(qualifiedName_), value(value_)
+Attribute::Attribute(const soul::ast::SourcePos& sourcePos_, const std::string* namespaceUri_, const soul::xml::Name* name_, const std::string& value_) : 
+    sourcePos(sourcePos_), namespaceUri(namespaceUri_), name(name_), value(value_)
 {
 }
 
+void Attribute::Reset(const soul::ast::SourcePos& sourcePos_, const std::string* namespaceUri_, const soul::xml::Name* name_, const std::string& value_)
+{
+    sourcePos = sourcePos_;
+    namespaceUri = namespaceUri_;
+    name = name_;
+    value.assign(value_);
+}
+
 std::string Attribute::ToString() const
 {
     std::string str;
-    str.append("ATTRIBUTE:").append("attName='").append(qualifiedName).append("', attValue='").append(value).append("', line=").append(std::to_string(sourcePos.line));
+    str.append("ATTRIBUTE:").append("attName='").append(name->QualifiedName()).append("', attValue='").append(value).append("', line=").append(std::to_string(sourcePos.line));
     return str;
 }
 
@@ -28,12 +36,21 @@ void Attributes::Clear()
     attributes.clear();
 }
 
-void Attributes::AddAttribute(Attribute* attribute)
+void Attributes::AddAttribute(const soul::ast::SourcePos& sourcePos, const std::string* namespaceUri, const soul::xml::Name* name, const std::string& value)
 {
-    attributes.push_back(std::unique_ptr<Attribute>(attribute));
+    if (attributes.size() < pool.size())
+    {
+        Attribute* attribute = pool[attributes.size()].get();
+        attribute->Reset(sourcePos, namespaceUri, name, value);
+        attributes.push_back(attribute);
+    }
+    else
+    {
+        pool.push_back(std::unique_ptr<Attribute>(new Attribute(sourcePos, namespaceUri, name, value)));
+        attributes.push_back(pool.back().get());
+    }
 }
 
-
 const std::string* Attributes::GetAttributeValue(const std::string& qualifiedName) const
 {
     for (const auto& attribute : attributes)
@@ -47,6 +64,19 @@ const std::string* Attributes::GetAttributeValue(const std::string& qualifiedNam
     return nullptr;
 }
 
+const std::string* Attributes::GetAttributeValue(const soul::xml::Name* name) const
+{
+    for (const auto& attribute : attributes)
+    {
+        if (attribute->GetName() == name)
+        {
+            const std::string& value = attribute->Value();
+            return &value;
+        }
+    }
+    return nullptr;
+}
+
 std::string Attributes::ToString() const
 {
     std::string str;
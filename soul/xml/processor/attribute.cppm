@@ -7,38 +7,45 @@ export module soul.xml.processor.attribute;
 
 import std.core;
 import soul.ast.source.pos;
+import soul.xml.name.table;
 
 export namespace soul::xml::processor {
 
 class Attribute
 {
 public:
-    Attribute(const soul::ast::SourcePos& sourcePos_, const std::string& namespaceUri_, const std::string& localName_, const std::string& qualifiedName_, const std::string& value_);
+    Attribute(const soul::ast::SourcePos& sourcePos_, const std::string* namespaceUri_, const soul::xml::Name* name_, const std::string& value_);
     const soul::ast::SourcePos& GetSourcePos() const { return sourcePos; }
-    const std::string& NamespaceUri() const { return namespaceUri; }
-    const std::string& LocalName() const { return localName; }
-    const std::string& QualifiedName() const { return qualifiedName; }
+    const std::string& NamespaceUri() const { return *namespaceUri; }
+    const std::string& LocalName() const { return name->LocalName(); }
+    const std::string& QualifiedName() const { return name->QualifiedName(); }
+    const soul::xml::Name* GetName() const { return name; }
     const std::string& Value() const { return value; }
+    void Reset(const soul::ast::SourcePos& sourcePos_, const std::string* namespaceUri_, const soul::xml::Name* name_, const std::string& value_);
     std::string ToString() const;
 private:
     soul::ast::SourcePos sourcePos;
-    std::string namespaceUri;
-    std::string localName;
-    std::string qualifiedName;
+    const std::string* namespaceUri;
+    const soul::xml::Name* name;
     std::string value;
 };
 
+//  Attributes holds the attributes of the current start tag. The attribute objects are reused from 
+//  one start tag to the next, so that parsing a document does not allocate an object per attribute.
+
 class Attributes
 {
 public:
     Attributes();
     void Clear();
-    void AddAttribute(Attribute* attribute);
-    const std::vector<std::unique_ptr<Attribute>>& GetAttributes() const { return attributes; }
+    void AddAttribute(const soul::ast::SourcePos& sourcePos, const std::string* namespaceUri, const soul::xml::Name* name, const std::string& value);
+    const std::vector<Attribute*>& GetAttributes() const { return attributes; }
     const std::string* GetAttributeValue(const std::string& qualifiedName) const;
+    const std::string* GetAttributeValue(const soul::xml::Name* name) const;
     std::string ToString() const;
 private:
-    std::vector<std::unique_ptr<Attribute>> attributes;
+    std::vector<Attribute*> attributes;
+    std::vector<std::unique_ptr<Attribute>> pool;
 };
 
 } // namespace soul::xml::processor
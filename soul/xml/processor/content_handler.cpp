@@ -7,7 +7,7 @@ module soul.xml.content.handler;
 
 namespace soul::xml {
 
-XmlContentHandler::XmlContentHandler() : lexer(nullptr)
+XmlContentHandler::XmlContentHandler() : lexer(nullptr), nameTable(nullptr)
 {
 }
 
@@ -15,4 +15,10 @@ XmlContentHandler::~XmlContentHandler()
 {
 }
 
+void XmlContentHandler::StartElement(const soul::ast::SourcePos& sourcePos, const std::string* namespaceUri, const soul::xml::Name* name,
+    const soul::xml::processor::Attributes& attributes)
+{
+    StartElement(sourcePos, *namespaceUri, name->LocalName(), name->QualifiedName(), attributes);
+}
+
 } // namespace soul::xml {
@@ -8,16 +8,37 @@ export module soul.xml.content.handler;
 import std.core;
 import soul.ast.source.pos;
 import soul.xml.processor.attribute;
-import soul.lexer.base;
+import soul.xml.name.table;
 
 export namespace soul::xml {
 
+//  ===================================================================================================
+//  XmlLexer is the view of the XML scanner that the processor and content handlers use for error
+//  messages: the name of the file being parsed and the source line(s) of a source position.
+//  ===================================================================================================
+
+class XmlLexer
+{
+public:
+    virtual ~XmlLexer() {}
+    virtual const std::string& FileName() const = 0;
+    virtual std::string ErrorLines(const soul::ast::SourcePos& sourcePos) const = 0;
+};
+
+//  ===================================================================================================
+//  The processor interns the element and attribute names it reports in the name table of the content 
+//  handler. If the handler has no table, the names are interned in a table owned by the processor, 
+//  and they are valid only during the parse.
+//  ===================================================================================================
+
 class XmlContentHandler
 {
 public:
     XmlContentHandler();
-    soul::lexer::LexerBase<char32_t>* GetLexer() { return lexer; }
-    void SetLexer(soul::lexer::LexerBase<char32_t>* lexer_) { lexer = lexer_; }
+    XmlLexer* GetLexer() { return lexer; }
+    void SetLexer(XmlLexer* lexer_) { lexer = lexer_; }
+    soul::xml::NameTable* GetNameTable() const { return nameTable; }
+    void SetNameTable(soul::xml::NameTable* nameTable_) { nameTable = nameTable_; }
     virtual ~XmlContentHandler();
     virtual void StartDocument(const soul::ast::SourcePos& sourcePos) {}
     virtual void EndDocument() {}
@@ -30,10 +51,13 @@ public:
     virtual void CDataSection(const soul::ast::SourcePos& sourcePos, const std::string& cdata) {}
     virtual void StartElement(const soul::ast::SourcePos& sourcePos, const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName, 
         const soul::xml::processor::Attributes& attributes) {} 
+    virtual void StartElement(const soul::ast::SourcePos& sourcePos, const std::string* namespaceUri, const soul::xml::Name* name, 
+        const soul::xml::processor::Attributes& attributes);
     virtual void EndElement(const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName) {}
     virtual void SkippedEntity(const soul::ast::SourcePos& sourcePos, const std::string& entityName) {}
 private:
-    soul::lexer::LexerBase<char32_t>* lexer;
+    XmlLexer* lexer;
+    soul::xml::NameTable* nameTable;
 };
 
 } // namespace soul::xml
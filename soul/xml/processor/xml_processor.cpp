@@ -11,19 +11,27 @@ import util;
 
 namespace soul::xml::processor {
 
-XmlProcessor::XmlProcessor(soul::xml::XmlContentHandler* contentHandler_) : lexer(nullptr), contentHandler(contentHandler_)
+XmlProcessor::XmlProcessor(soul::xml::XmlContentHandler* contentHandler_) : 
+    lexer(nullptr), contentHandler(contentHandler_), currentNamespaceUri(soul::xml::NameTable::EmptyString())
 {
     if (!contentHandler)
     {
         throw std::runtime_error("error: XmlProcessor: content handler is null");
     }
+    soul::xml::NameTable* nameTable = contentHandler->GetNameTable();
+    if (!nameTable)
+    {
+        ownNameTable.reset(new soul::xml::NameTable());
+        nameTable = ownNameTable.get();
+    }
+    nameCache.SetNameTable(nameTable);
 }
 
 XmlProcessor::~XmlProcessor()
 {
 }
 
-void XmlProcessor::StartDocument(soul::lexer::LexerBase<char32_t>* lexer_, const soul::ast::SourcePos& sourcePos)
+void XmlProcessor::StartDocument(soul::xml::XmlLexer* lexer_, const soul::ast::SourcePos& sourcePos)
 {
     lexer = lexer_;
     contentHandler->SetLexer(lexer);
@@ -63,7 +71,7 @@ void XmlProcessor::PI(const soul::ast::SourcePos& sourcePos, const std::string&
 void XmlProcessor::BeginStartTag(const soul::ast::SourcePos& sourcePos, const std::string& tagName)
 {
     tagStack.push(currentTag);
-    currentTag = Tag(sourcePos, tagName);
+    currentTag = Tag(sourcePos, ParseQualifiedName(sourcePos, tagName));
     attributes.Clear();
     namespaceUriStack.push(currentNamespaceUri);
     namespacePrefixStack.push(currentNamespacePrefix);
@@ -71,16 +79,14 @@ void XmlProcessor::BeginStartTag(const soul::ast::SourcePos& sourcePos, const st
 
 void XmlProcessor::EndStartTag()
 {
-    std::string localName;
-    std::string prefix;
-    ParseQualifiedName(currentTag.sourcePos, currentTag.name, localName, prefix);
+    const std::string& prefix = currentTag.name->Prefix();
     if (prefix == "xmlns")
     {
         throw XmlException("error: 'xmlns' prefix cannot be declared for an element in file " + 
-            lexer->FileName() + " line " + std::to_string(currentTag.sourcePos.line) + ":\n" + lexer->ErrorLines(currentTag.sourcePos.pos), currentTag.sourcePos);
+            lexer->FileName() + " line " + std::to_string(currentTag.sourcePos.line) + ":\n" + lexer->ErrorLines(currentTag.sourcePos), currentTag.sourcePos);
     }
-    std::string namespaceUri = GetNamespaceUri(prefix, currentTag.sourcePos);
-    contentHandler->StartElement(currentTag.sourcePos, namespaceUri, localName, currentTag.name, attributes);
+    const std::string* namespaceUri = GetNamespaceUri(prefix, currentTag.sourcePos);
+    contentHandler->StartElement(currentTag.sourcePos, namespaceUri, currentTag.name, attributes);
 }
 
 void XmlProcessor::EndTag(const soul::ast::SourcePos& sourcePos, const std::string& tagName)
@@ -88,37 +94,38 @@ void XmlProcessor::EndTag(const soul::ast::SourcePos& sourcePos, const std::stri
     if (tagStack.empty())
     {
         throw soul::xml::XmlException("error: end tag '" + tagName + "' has no corresponding start tag in file " + 
-            lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos.pos), sourcePos);
+            lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos), sourcePos);
     }
-    if (tagName != currentTag.name)
+    if (tagName != currentTag.name->QualifiedName())
     {
-        throw soul::xml::XmlException("error: end tag '" + tagName + "' does not match start tag '" + currentTag.name + "' in file " +
-            lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos.pos) + 
-            "\nsee reference line " + std::to_string(currentTag.sourcePos.line) + ":\n" + lexer->ErrorLines(currentTag.sourcePos.pos),
+        throw soul::xml::XmlException("error: end tag '" + tagName + "' does not match start tag '" + currentTag.name->QualifiedName() + "' in file " +
+            lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos) + 
+            "\nsee reference line " + std::to_string(currentTag.sourcePos.line) + ":\n" + lexer->ErrorLines(currentTag.sourcePos),
             sourcePos);
     }
-    std::string localName;
-    std::string prefix;
-    ParseQualifiedName(sourcePos, currentTag.name, localName, prefix);
-    if (prefix == "xmlns")
+    const soul::xml::Name* name = currentTag.name;
+    if (name->Prefix() == "xmlns")
     {
         throw XmlException("error: 'xmlns' prefix cannot be declared for an element in file " +
-            lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos.pos), sourcePos);
+            lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos), sourcePos);
     }
-    std::string namespaceUri = GetNamespaceUri(prefix, sourcePos);
-    contentHandler->EndElement(namespaceUri, localName, currentTag.name);
+    const std::string* namespaceUri = GetNamespaceUri(name->Prefix(), sourcePos);
+    contentHandler->EndElement(*namespaceUri, name->LocalName(), name->QualifiedName());
     if (namespaceUriStack.empty())
     {
         throw std::runtime_error("namespace URI stack is empty");
     }
     currentNamespaceUri = namespaceUriStack.top();
     namespaceUriStack.pop();
-    namespacePrefixMap.erase(currentNamespacePrefix);
     if (namespacePrefixStack.empty())
     {
         throw std::runtime_error("namespace prefix stack is empty");
     }
-    currentNamespacePrefix = namespacePrefixStack.top();
+    if (namespacePrefixStack.top() != currentNamespacePrefix)
+    {
+        namespacePrefixMap.erase(currentNamespacePrefix);
+        currentNamespacePrefix = namespacePrefixStack.top();
+    }
     namespacePrefixStack.pop();
     namespacePrefixMap[currentNamespacePrefix] = currentNamespaceUri;
     currentTag = tagStack.top();
@@ -127,22 +134,22 @@ void XmlProcessor::EndTag(const soul::ast::SourcePos& sourcePos, const std::stri
 
 void XmlProcessor::AddAttribute(const soul::ast::SourcePos& sourcePos, const std::string& attName, const std::string& attValue)
 {
-    std::string localName;
-    std::string prefix;
-    ParseQualifiedName(sourcePos, attName, localName, prefix);
+    const soul::xml::Name* name = ParseQualifiedName(sourcePos, attName);
+    const std::string& prefix = name->Prefix();
+    const std::string& localName = name->LocalName();
     if (prefix == "xmlns")
     {
         currentNamespacePrefix = localName;
-        currentNamespaceUri = attValue;
+        currentNamespaceUri = nameCache.InternString(attValue);
         namespacePrefixMap[currentNamespacePrefix] = currentNamespaceUri;
     }
     else if (localName == "xmlns")
     {
         currentNamespacePrefix.clear();
-        currentNamespaceUri = attValue;
+        currentNamespaceUri = nameCache.InternString(attValue);
     }
-    std::string namespaceUri = GetNamespaceUri(prefix, sourcePos);
-    attributes.AddAttribute(new Attribute(sourcePos, namespaceUri, localName, attName, attValue));
+    const std::string* namespaceUri = GetNamespaceUri(prefix, sourcePos);
+    attributes.AddAttribute(sourcePos, namespaceUri, name, attValue);
 }
 
 void XmlProcessor::BeginAttributeValue()
@@ -163,19 +170,26 @@ void XmlProcessor::EndAttributeValue()
 
 void XmlProcessor::AddAttValueChar(char32_t chr)
 {
-    attValue.append(1, chr);
+    util::AppendUtf8(attValue, chr);
+}
+
+void XmlProcessor::AddAttValueText(const char* begin, const char* end)
+{
+    attValue.append(begin, end);
 }
 
 std::string XmlProcessor::AttValue() const
 {
-    return util::ToUtf8(attValue);
+    return attValue;
 }
 
 void XmlProcessor::CharRef(const soul::ast::SourcePos& sourcePos, char32_t chr)
 {
     if (attValueStack.empty())
     {
-        Text(sourcePos, util::ToUtf8(std::u32string(1, chr)));
+        std::string text;
+        util::AppendUtf8(text, chr);
+        Text(sourcePos, text);
     }
     else
     {
@@ -197,7 +211,7 @@ void XmlProcessor::EntityRef(const soul::ast::SourcePos& sourcePos, const std::s
             }
             else
             {
-                attValue.append(entity->Value());
+                attValue.append(util::ToUtf8(entity->Value()));
             }
         }
         else
@@ -221,27 +235,18 @@ void XmlProcessor::CDataSection(const soul::ast::SourcePos& sourcePos, const std
     contentHandler->CDataSection(sourcePos, cdata);
 }
 
-void XmlProcessor::ParseQualifiedName(const soul::ast::SourcePos& sourcePos, const std::string& qualifiedName, std::string& localName, std::string& prefix) const
+const soul::xml::Name* XmlProcessor::ParseQualifiedName(const soul::ast::SourcePos& sourcePos, const std::string& qualifiedName)
 {
-    std::vector<std::string> components = util::Split(qualifiedName, ':');
-    if (components.size() > 2)
+    const soul::xml::Name* name = nameCache.Intern(qualifiedName);
+    if (name->ColonCount() > 1)
     {
         throw XmlException("error: qualified name '" + qualifiedName + "' has more than one ':' character in file " +
-            lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos.pos), sourcePos);
-    }
-    else if (components.size() == 2)
-    {
-        prefix = components[0];
-        localName = components[1];
-    }
-    else
-    {
-        prefix.clear();
-        localName = qualifiedName;
+            lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos), sourcePos);
     }
+    return name;
 }
 
-std::string XmlProcessor::GetNamespaceUri(const std::string& namespacePrefix, const soul::ast::SourcePos& sourcePos) const
+const std::string* XmlProcessor::GetNamespaceUri(const std::string& namespacePrefix, const soul::ast::SourcePos& sourcePos) const
 {
     if (namespacePrefix.empty())
     {
@@ -257,10 +262,10 @@ std::string XmlProcessor::GetNamespaceUri(const std::string& namespacePrefix, co
         if (namespacePrefix != "xml")
         {
             throw XmlException("error: namespace prefix '" + namespacePrefix + "' not bound to any namespace URI in file " +
-                lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos.pos), sourcePos);
+                lexer->FileName() + " line " + std::to_string(sourcePos.line) + ":\n" + lexer->ErrorLines(sourcePos), sourcePos);
         }
     }
-    return std::string();
+    return soul::xml::NameTable::EmptyString();
 }
 
 } // namespace soul::xml::processor
@@ -8,17 +8,17 @@ export module soul.xml.xml_processor;
 import std.core;
 import soul.xml.content.handler;
 import soul.xml.processor.attribute;
+import soul.xml.name.table;
 import soul.ast.source.pos;
-import soul.lexer.base;
 
 export namespace soul::xml::processor {
 
 struct Tag
 {
-    Tag() : sourcePos(), name() {}
-    Tag(const soul::ast::SourcePos& sourcePos_, const std::string& name_) : sourcePos(sourcePos_), name(name_) {}
+    Tag() : sourcePos(), name(nullptr) {}
+    Tag(const soul::ast::SourcePos& sourcePos_, const soul::xml::Name* name_) : sourcePos(sourcePos_), name(name_) {}
     soul::ast::SourcePos sourcePos;
-    std::string name;
+    const soul::xml::Name* name;
 };
 
 class XmlProcessor
@@ -26,7 +26,7 @@ class XmlProcessor
 public:
     XmlProcessor(soul::xml::XmlContentHandler* contentHandler_);
     virtual ~XmlProcessor();
-    virtual void StartDocument(soul::lexer::LexerBase<char32_t>* lexer_, const soul::ast::SourcePos& sourcePos);
+    virtual void StartDocument(soul::xml::XmlLexer* lexer_, const soul::ast::SourcePos& sourcePos);
     virtual void EndDocument();
     virtual void XmlVersion(const std::string& xmlVersion);
     virtual void XmlEncoding(const std::string& xmlEncoding);
@@ -40,26 +40,29 @@ public:
     virtual void BeginAttributeValue();
     virtual void EndAttributeValue();
     virtual void AddAttValueChar(char32_t chr);
+    virtual void AddAttValueText(const char* begin, const char* end);
     virtual std::string AttValue() const;
     virtual void CharRef(const soul::ast::SourcePos& sourcePos, char32_t chr);
     virtual void EntityRef(const soul::ast::SourcePos& sourcePos, const std::string& entityName);
     virtual void Text(const soul::ast::SourcePos& sourcePos, const std::string& text);
     virtual void CDataSection(const soul::ast::SourcePos& sourcePos, const std::string& cdata);
 private:
-    void ParseQualifiedName(const soul::ast::SourcePos& sourcePos, const std::string& qualifiedName, std::string& localName, std::string& prefix) const;
-    std::string GetNamespaceUri(const std::string& namespacePrefix, const soul::ast::SourcePos& sourcePos) const;
-    soul::lexer::LexerBase<char32_t>* lexer;
+    const soul::xml::Name* ParseQualifiedName(const soul::ast::SourcePos& sourcePos, const std::string& qualifiedName);
+    const std::string* GetNamespaceUri(const std::string& namespacePrefix, const soul::ast::SourcePos& sourcePos) const;
+    soul::xml::XmlLexer* lexer;
     soul::xml::XmlContentHandler* contentHandler;
     std::stack<Tag> tagStack;
     Tag currentTag;
     soul::xml::processor::Attributes attributes;
-    std::u32string attValue;
-    std::stack<std::u32string> attValueStack;
-    std::string currentNamespaceUri;
-    std::stack<std::string> namespaceUriStack;
+    std::string attValue;
+    std::stack<std::string> attValueStack;
+    const std::string* currentNamespaceUri;
+    std::stack<const std::string*> namespaceUriStack;
     std::string currentNamespacePrefix;
     std::stack<std::string> namespacePrefixStack;
-    std::map<std::string, std::string> namespacePrefixMap;
+    std::map<std::string, const std::string*> namespacePrefixMap;
+    std::unique_ptr<soul::xml::NameTable> ownNameTable;
+    soul::xml::NameCache nameCache;
 };
 
 } // namespace soul::xml::processor
@@ -1,10116 +0,0 @@
-
-// this file has been automatically generated from 'C:/work/soul-mod/soul/xml/xml_parser/xml_document.parser' using soul parser generator spg version 5.0.0
-
-module soul.xml.document.parser;
-
-import util;
-import soul.ast.spg;
-
-namespace soul::xml::document::parser {
-
-static constexpr int32_t s0[] = {60, 63, 120, 109, 108};
-
-static constexpr int32_t s1[] = {63, 62};
-
-static constexpr int32_t s2[] = {118, 101, 114, 115, 105, 111, 110};
-
-static constexpr soul::ast::spg::Range s3[] = {{ 32, 32 }, { 9, 9 }, { 13, 13 }, { 10, 10 }};
-
-static constexpr soul::ast::spg::Range s4[] = {{ 48, 57 }};
-
-static constexpr int32_t s5[] = {101, 110, 99, 111, 100, 105, 110, 103};
-
-static constexpr soul::ast::spg::Range s6[] = {{ 65, 90 }, { 97, 122 }};
-
-static constexpr soul::ast::spg::Range s7[] = {{ 65, 90 }, { 97, 122 }, { 48, 57 }, { 46, 46 }, { 95, 95 }, { 45, 45 }};
-
-static constexpr int32_t s8[] = {115, 116, 97, 110, 100, 97, 108, 111, 110, 101};
-
-static constexpr int32_t s9[] = {34, 121, 101, 115, 34};
-
-static constexpr int32_t s10[] = {39, 121, 101, 115, 39};
-
-static constexpr int32_t s11[] = {34, 110, 111, 34};
-
-static constexpr int32_t s12[] = {39, 110, 111, 39};
-
-static constexpr int32_t s13[] = {60, 33, 45, 45};
-
-static constexpr int32_t s14[] = {45, 45, 62};
-
-static constexpr int32_t s15[] = {45, 45, 62};
-
-static constexpr soul::ast::spg::Range s16[] = {{ 9, 9 }, { 10, 10 }, { 13, 13 }, { 32, 55295 }, { 57344, 65533 }, { 65536, 1114111 }};
-
-static constexpr int32_t s17[] = {60, 63};
-
-static constexpr int32_t s18[] = {63, 62};
-
-static constexpr int32_t s19[] = {63, 62};
-
-static constexpr soul::ast::spg::Range s20[] = {{ 58, 58 }, { 65, 90 }, { 95, 95 }, { 97, 122 }, { 192, 214 }, { 216, 246 }, { 248, 767 }, { 880, 893 }, { 895, 8191 }, { 8204, 8205 }, { 8304, 8591 }, { 11264, 12271 }, { 12289, 55295 }, { 63744, 64975 }, { 65008, 65533 }, { 65536, 983039 }};
-
-static constexpr soul::ast::spg::Range s21[] = {{ 45, 45 }, { 46, 46 }, { 48, 57 }, { 183, 183 }, { 768, 879 }, { 8255, 8256 }};
-
-static constexpr soul::ast::spg::Range s22[] = {{ 120, 120 }, { 88, 88 }};
-
-static constexpr soul::ast::spg::Range s23[] = {{ 109, 109 }, { 77, 77 }};
-
-static constexpr soul::ast::spg::Range s24[] = {{ 108, 108 }, { 76, 76 }};
-
-static constexpr int32_t s25[] = {47, 62};
-
-static constexpr soul::ast::spg::Range s26[] = {{ 60, 60 }, { 38, 38 }, { 34, 34 }};
-
-static constexpr soul::ast::spg::Range s27[] = {{ 60, 60 }, { 38, 38 }, { 39, 39 }};
-
-static constexpr int32_t s28[] = {38, 35};
-
-static constexpr int32_t s29[] = {38, 35, 120};
-
-static constexpr soul::ast::spg::Range s30[] = {{ 48, 57 }};
-
-static constexpr soul::ast::spg::Range s31[] = {{ 48, 57 }, { 97, 102 }, { 65, 70 }};
-
-static constexpr int32_t s32[] = {93, 93, 62};
-
-static constexpr soul::ast::spg::Range s33[] = {{ 60, 60 }, { 38, 38 }};
-
-static constexpr int32_t s34[] = {60, 33, 91, 67, 68, 65, 84, 65, 91};
-
-static constexpr int32_t s35[] = {93, 93, 62};
-
-static constexpr int32_t s36[] = {93, 93, 62};
-
-static constexpr int32_t s37[] = {60, 47};
-
-static constexpr int32_t s38[] = {60, 33, 68, 79, 67, 84, 89, 80, 69};
-
-static constexpr int32_t s39[] = {83, 89, 83, 84, 69, 77};
-
-static constexpr int32_t s40[] = {80, 85, 66, 76, 73, 67};
-
-static constexpr soul::ast::spg::Range s41[] = {{ 34, 34 }};
-
-static constexpr soul::ast::spg::Range s42[] = {{ 39, 39 }};
-
-static constexpr soul::ast::spg::Range s43[] = {{ 32, 32 }, { 13, 13 }, { 10, 10 }};
-
-static constexpr soul::ast::spg::Range s44[] = {{ 97, 122 }, { 65, 90 }, { 48, 57 }};
-
-static constexpr soul::ast::spg::Range s45[] = {{ 45, 45 }, { 39, 39 }, { 40, 40 }, { 41, 41 }, { 43, 43 }, { 44, 44 }, { 46, 46 }, { 47, 47 }, { 58, 58 }, { 61, 61 }, { 63, 63 }, { 59, 59 }, { 33, 33 }, { 42, 42 }, { 35, 35 }, { 64, 64 }, { 36, 36 }, { 95, 95 }, { 37, 37 }};
-
-static constexpr int32_t s46[] = {60, 33, 69, 76, 69, 77, 69, 78, 84};
-
-static constexpr int32_t s47[] = {69, 77, 80, 84, 89};
-
-static constexpr int32_t s48[] = {65, 78, 89};
-
-static constexpr int32_t s49[] = {35, 80, 67, 68, 65, 84, 65};
-
-static constexpr int32_t s50[] = {41, 42};
-
-static constexpr int32_t s51[] = {35, 80, 67, 68, 65, 84, 65};
-
-static constexpr int32_t s52[] = {60, 33, 65, 84, 84, 76, 73, 83, 84};
-
-static constexpr int32_t s53[] = {67, 68, 65, 84, 65};
-
-static constexpr int32_t s54[] = {73, 68};
-
-static constexpr int32_t s55[] = {73, 68, 82, 69, 70};
-
-static constexpr int32_t s56[] = {73, 68, 82, 69, 70, 83};
-
-static constexpr int32_t s57[] = {69, 78, 84, 73, 84, 89};
-
-static constexpr int32_t s58[] = {69, 78, 84, 73, 84, 73, 69, 83};
-
-static constexpr int32_t s59[] = {78, 77, 84, 79, 75, 69, 78};
-
-static constexpr int32_t s60[] = {78, 77, 84, 79, 75, 69, 78, 83};
-
-static constexpr int32_t s61[] = {78, 79, 84, 65, 84, 73, 79, 78};
-
-static constexpr int32_t s62[] = {35, 82, 69, 81, 85, 73, 82, 69, 68};
-
-static constexpr int32_t s63[] = {35, 73, 77, 80, 76, 73, 69, 68};
-
-static constexpr int32_t s64[] = {35, 70, 73, 88, 69, 68};
-
-static constexpr int32_t s65[] = {60, 33, 69, 78, 84, 73, 84, 89};
-
-static constexpr soul::ast::spg::Range s66[] = {{ 37, 37 }, { 38, 38 }, { 34, 34 }};
-
-static constexpr soul::ast::spg::Range s67[] = {{ 37, 37 }, { 38, 38 }, { 39, 39 }};
-
-static constexpr int32_t s68[] = {60, 33, 69, 78, 84, 73, 84, 89};
-
-static constexpr int32_t s69[] = {78, 68, 65, 84, 65};
-
-static constexpr int32_t s70[] = {60, 33, 78, 79, 84, 65, 84, 73, 79, 78};
-
-static constexpr int32_t s71[] = {80, 85, 66, 76, 73, 67};
-
-template<typename LexerT>
-void XmlParser<LexerT>::Parse(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (lexer.Log())
-    {
-        lexer.Log()->WriteBeginRule("parse");
-        lexer.Log()->IncIndent();
-    }
-    #endif
-    ++lexer;
-    soul::parser::Match match = XmlParser<LexerT>::Document(lexer, processor);
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (lexer.Log())
-    {
-        lexer.Log()->DecIndent();
-        lexer.Log()->WriteEndRule("parse");
-    }
-    #endif
-    if (match.hit)
-    {
-        if (*lexer == soul::lexer::END_TOKEN)
-        {
-            return;
-        }
-        else
-        {
-            lexer.ThrowFarthestError();
-        }
-    }
-    else
-    {
-        lexer.ThrowFarthestError();
-    }
-    return;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Document(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Document");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953153);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            int64_t pos = lexer.GetPos();
-                            soul::parser::Match match(true);
-                            if (match.hit)
-                            {
-                                processor->StartDocument(&lexer, lexer.GetSourcePos(pos));
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::Prolog(lexer, processor);
-                            *parentMatch6 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::Element(lexer, processor);
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch8 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch9 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::Misc(lexer, processor);
-                                if (match.hit)
-                                {
-                                    *parentMatch9 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch8 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->EndDocument();
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Document");
-        else soul::lexer::WriteFailureToLog(lexer, "Document");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Prolog(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Prolog");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953154);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::XmlDecl(lexer, processor);
-                    if (match.hit)
-                    {
-                        *parentMatch3 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch4 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::Misc(lexer, processor);
-                                if (match.hit)
-                                {
-                                    *parentMatch5 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch4 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch6 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch7 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch9 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::DocTypeDecl(lexer, processor);
-                            *parentMatch9 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                soul::parser::Match match(true);
-                                soul::parser::Match* parentMatch11 = &match;
-                                {
-                                    while (true)
-                                    {
-                                        int64_t save = lexer.GetPos();
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::Misc(lexer, processor);
-                                            if (match.hit)
-                                            {
-                                                *parentMatch11 = match;
-                                            }
-                                            else
-                                            {
-                                                lexer.SetPos(save);
-                                                break;
-                                            }
-                                        }
-                                    }
-                                }
-                                *parentMatch10 = match;
-                            }
-                            *parentMatch9 = match;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    if (match.hit)
-                    {
-                        *parentMatch7 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch6 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Prolog");
-        else soul::lexer::WriteFailureToLog(lexer, "Prolog");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::XmlDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "XmlDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953155);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            for (int32_t i : s0)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            *parentMatch5 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::VersionInfo(lexer, processor);
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch7 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match* parentMatch8 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::EncodingDecl(lexer, processor);
-                                if (match.hit)
-                                {
-                                    *parentMatch8 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                }
-                            }
-                            *parentMatch7 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch9 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match* parentMatch10 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::StandaloneDecl(lexer, processor);
-                            if (match.hit)
-                            {
-                                *parentMatch10 = match;
-                            }
-                            else
-                            {
-                                lexer.SetPos(save);
-                            }
-                        }
-                        *parentMatch9 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch11 = &match;
-                {
-                    soul::parser::Match match(true);
-                    int64_t save = lexer.GetPos();
-                    soul::parser::Match* parentMatch12 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        if (match.hit)
-                        {
-                            *parentMatch12 = match;
-                        }
-                        else
-                        {
-                            lexer.SetPos(save);
-                        }
-                    }
-                    *parentMatch11 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch13 = &match;
-            {
-                soul::parser::Match match(true);
-                for (int32_t i : s1)
-                {
-                    if (*lexer == i)
-                    {
-                        ++lexer;
-                    }
-                    else
-                    {
-                        match.hit = false;
-                        break;
-                    }
-                }
-                *parentMatch13 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "XmlDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "XmlDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::VersionInfo(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "VersionInfo");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953156);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        for (int32_t i : s2)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch5 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::Eq(lexer);
-                    *parentMatch5 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch6 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::VersionNumber(lexer, processor);
-                *parentMatch6 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "VersionInfo");
-        else soul::lexer::WriteFailureToLog(lexer, "VersionInfo");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::S(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "S");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953157);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        for (const soul::ast::spg::Range& range : s3)
-        {
-            if (*lexer >= range.first && *lexer <= range.last)
-            {
-                match.hit = true;
-                ++lexer;
-                break;
-            }
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(true);
-        soul::parser::Match* parentMatch1 = &match;
-        while (true)
-        {
-            int64_t save = lexer.GetPos();
-            {
-                soul::parser::Match match(false);
-                for (const soul::ast::spg::Range& range : s3)
-                {
-                    if (*lexer >= range.first && *lexer <= range.last)
-                    {
-                        match.hit = true;
-                        ++lexer;
-                        break;
-                    }
-                }
-                if (match.hit)
-                {
-                    *parentMatch1 = match;
-                }
-                else
-                {
-                    lexer.SetPos(save);
-                    break;
-                }
-            }
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "S");
-        else soul::lexer::WriteFailureToLog(lexer, "S");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Eq(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Eq");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953158);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(true);
-            int64_t save = lexer.GetPos();
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                if (match.hit)
-                {
-                    *parentMatch2 = match;
-                }
-                else
-                {
-                    lexer.SetPos(save);
-                }
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch3 = &match;
-            {
-                soul::parser::Match match(false);
-                if (*lexer == 61)
-                {
-                    ++lexer;
-                    match.hit = true;
-                }
-                *parentMatch3 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch4 = &match;
-        {
-            soul::parser::Match match(true);
-            int64_t save = lexer.GetPos();
-            soul::parser::Match* parentMatch5 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                if (match.hit)
-                {
-                    *parentMatch5 = match;
-                }
-                else
-                {
-                    lexer.SetPos(save);
-                }
-            }
-            *parentMatch4 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Eq");
-        else soul::lexer::WriteFailureToLog(lexer, "Eq");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::VersionNumber(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "VersionNumber");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953159);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match = XmlParser<LexerT>::VersionNumDQ(lexer, processor);
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch1 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::VersionNumSQ(lexer, processor);
-                *parentMatch1 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "VersionNumber");
-        else soul::lexer::WriteFailureToLog(lexer, "VersionNumber");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::VersionNumDQ(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "VersionNumDQ");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953160);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 34)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::VersionNum(lexer, processor);
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch3 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 34)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch3 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "VersionNumDQ");
-        else soul::lexer::WriteFailureToLog(lexer, "VersionNumDQ");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::VersionNumSQ(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "VersionNumSQ");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953161);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 39)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::VersionNum(lexer, processor);
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch3 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 39)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch3 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "VersionNumSQ");
-        else soul::lexer::WriteFailureToLog(lexer, "VersionNumSQ");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::VersionNum(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "VersionNum");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953162);
-    std::u32string xmlVersion = std::u32string();
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        if (*lexer == 49)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        if (match.hit)
-                        {
-                            xmlVersion.append(1, '1');
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            int64_t pos = lexer.GetPos();
-                            soul::parser::Match match(false);
-                            if (*lexer == 46)
-                            {
-                                ++lexer;
-                                match.hit = true;
-                            }
-                            if (match.hit)
-                            {
-                                xmlVersion.append(1, '.');
-                            }
-                            *parentMatch6 = match;
-                        }
-                        *parentMatch5 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch7 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch9 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                int64_t pos = lexer.GetPos();
-                                soul::parser::Match match(false);
-                                for (const soul::ast::spg::Range& range : s4)
-                                {
-                                    if (*lexer >= range.first && *lexer <= range.last)
-                                    {
-                                        match.hit = true;
-                                        ++lexer;
-                                        break;
-                                    }
-                                }
-                                if (match.hit)
-                                {
-                                    xmlVersion.append(1, lexer.GetToken(pos).Chr());
-                                }
-                                *parentMatch10 = match;
-                            }
-                            *parentMatch9 = match;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch11 = &match;
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch12 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch13 = &match;
-                                    {
-                                        int64_t pos = lexer.GetPos();
-                                        soul::parser::Match match(false);
-                                        for (const soul::ast::spg::Range& range : s4)
-                                        {
-                                            if (*lexer >= range.first && *lexer <= range.last)
-                                            {
-                                                match.hit = true;
-                                                ++lexer;
-                                                break;
-                                            }
-                                        }
-                                        if (match.hit)
-                                        {
-                                            xmlVersion.append(1, lexer.GetToken(pos).Chr());
-                                        }
-                                        *parentMatch13 = match;
-                                    }
-                                    *parentMatch12 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch11 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch7 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->XmlVersion(util::ToUtf8(xmlVersion));
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "VersionNum");
-        else soul::lexer::WriteFailureToLog(lexer, "VersionNum");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EncodingDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EncodingDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953163);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        for (int32_t i : s5)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch5 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::Eq(lexer);
-                    *parentMatch5 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch6 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::EncodingName(lexer, processor);
-                *parentMatch6 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EncodingDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "EncodingDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EncodingName(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EncodingName");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953164);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match = XmlParser<LexerT>::EncNameDQ(lexer, processor);
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch1 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::EncNameSQ(lexer, processor);
-                *parentMatch1 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EncodingName");
-        else soul::lexer::WriteFailureToLog(lexer, "EncodingName");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EncNameDQ(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EncNameDQ");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953165);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 34)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::EncName(lexer, processor);
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch3 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 34)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch3 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EncNameDQ");
-        else soul::lexer::WriteFailureToLog(lexer, "EncNameDQ");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EncNameSQ(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EncNameSQ");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953166);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 39)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::EncName(lexer, processor);
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch3 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 39)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch3 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EncNameSQ");
-        else soul::lexer::WriteFailureToLog(lexer, "EncNameSQ");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EncName(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EncName");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953167);
-    std::u32string xmlEncoding = std::u32string();
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t pos = lexer.GetPos();
-                    soul::parser::Match match(false);
-                    for (const soul::ast::spg::Range& range : s6)
-                    {
-                        if (*lexer >= range.first && *lexer <= range.last)
-                        {
-                            match.hit = true;
-                            ++lexer;
-                            break;
-                        }
-                    }
-                    if (match.hit)
-                    {
-                        xmlEncoding.append(1, lexer.GetToken(pos).Chr());
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch4 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch6 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch7 = &match;
-                                    {
-                                        int64_t pos = lexer.GetPos();
-                                        soul::parser::Match match(false);
-                                        for (const soul::ast::spg::Range& range : s7)
-                                        {
-                                            if (*lexer >= range.first && *lexer <= range.last)
-                                            {
-                                                match.hit = true;
-                                                ++lexer;
-                                                break;
-                                            }
-                                        }
-                                        if (match.hit)
-                                        {
-                                            xmlEncoding.append(1, lexer.GetToken(pos).Chr());
-                                        }
-                                        *parentMatch7 = match;
-                                    }
-                                    *parentMatch6 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch5 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch4 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->XmlEncoding(util::ToUtf8(xmlEncoding));
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EncName");
-        else soul::lexer::WriteFailureToLog(lexer, "EncName");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::StandaloneDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "StandaloneDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953168);
-    std::unique_ptr<soul::parser::Value<bool>> yn;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        for (int32_t i : s8)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch5 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::Eq(lexer);
-                    *parentMatch5 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch6 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch7 = &match;
-                {
-                    int64_t pos = lexer.GetPos();
-                    soul::parser::Match match = XmlParser<LexerT>::YesNo(lexer);
-                    yn.reset(static_cast<soul::parser::Value<bool>*>(match.value));
-                    if (match.hit)
-                    {
-                        processor->Standalone(yn->value);
-                    }
-                    *parentMatch7 = match;
-                }
-                *parentMatch6 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "StandaloneDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "StandaloneDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::YesNo(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "YesNo");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953169);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                int64_t save = lexer.GetPos();
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t pos = lexer.GetPos();
-                    soul::parser::Match match(true);
-                    for (int32_t i : s9)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    if (match.hit)
-                    {
-                        {
-                            #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                            if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "YesNo");
-                            #endif
-                            return soul::parser::Match(true, new soul::parser::Value<bool>(true));
-                        }
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-                if (!match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    lexer.SetPos(save);
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            int64_t pos = lexer.GetPos();
-                            soul::parser::Match match(true);
-                            for (int32_t i : s10)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            if (match.hit)
-                            {
-                                {
-                                    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                                    if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "YesNo");
-                                    #endif
-                                    return soul::parser::Match(true, new soul::parser::Value<bool>(true));
-                                }
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch2 = match;
-                }
-            }
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch6 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(true);
-                        for (int32_t i : s11)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        if (match.hit)
-                        {
-                            {
-                                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "YesNo");
-                                #endif
-                                return soul::parser::Match(true, new soul::parser::Value<bool>(false));
-                            }
-                        }
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch6 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch8 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch9 = &match;
-                {
-                    int64_t pos = lexer.GetPos();
-                    soul::parser::Match match(true);
-                    for (int32_t i : s12)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    if (match.hit)
-                    {
-                        {
-                            #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                            if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "YesNo");
-                            #endif
-                            return soul::parser::Match(true, new soul::parser::Value<bool>(false));
-                        }
-                    }
-                    *parentMatch9 = match;
-                }
-                *parentMatch8 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "YesNo");
-        else soul::lexer::WriteFailureToLog(lexer, "YesNo");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Misc(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Misc");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953170);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match = XmlParser<LexerT>::Comment(lexer, processor);
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch2 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::PI(lexer, processor);
-                    *parentMatch2 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch3 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                *parentMatch3 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Misc");
-        else soul::lexer::WriteFailureToLog(lexer, "Misc");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Comment(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Comment");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953171);
-    soul::ast::SourcePos sourcePos = soul::ast::SourcePos();
-    std::u32string comment = std::u32string();
-    std::unique_ptr<soul::parser::Value<char32_t>> chr;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(true);
-                        for (int32_t i : s13)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        if (match.hit)
-                        {
-                            sourcePos = lexer.GetSourcePos(pos);
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            while (true)
-                            {
-                                int64_t save = lexer.GetPos();
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch7 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch8 = &match;
-                                        {
-                                            int64_t pos = lexer.GetPos();
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch9 = &match;
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch10 = &match;
-                                                int64_t save = lexer.GetPos();
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::Char(lexer);
-                                                    chr.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                                                    *parentMatch10 = match;
-                                                }
-                                                if (match.hit)
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    soul::parser::Match* parentMatch11 = &match;
-                                                    {
-                                                        int64_t tmp = lexer.GetPos();
-                                                        lexer.SetPos(save);
-                                                        save = tmp;
-                                                        soul::parser::Match match(true);
-                                                        for (int32_t i : s14)
-                                                        {
-                                                            if (*lexer == i)
-                                                            {
-                                                                ++lexer;
-                                                            }
-                                                            else
-                                                            {
-                                                                match.hit = false;
-                                                                break;
-                                                            }
-                                                        }
-                                                        *parentMatch11 = match;
-                                                    }
-                                                    if (!match.hit)
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                    *parentMatch10 = soul::parser::Match(!match.hit, match.value);
-                                                }
-                                                *parentMatch9 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                comment.append(1, chr->value);
-                                            }
-                                            *parentMatch8 = match;
-                                        }
-                                        *parentMatch7 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        *parentMatch6 = match;
-                                    }
-                                    else
-                                    {
-                                        lexer.SetPos(save);
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        *parentMatch5 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch12 = &match;
-                {
-                    soul::parser::Match match(true);
-                    for (int32_t i : s15)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    *parentMatch12 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->Comment(sourcePos, util::ToUtf8(comment));
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Comment");
-        else soul::lexer::WriteFailureToLog(lexer, "Comment");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Char(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Char");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953172);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        for (const soul::ast::spg::Range& range : s16)
-        {
-            if (*lexer >= range.first && *lexer <= range.last)
-            {
-                match.hit = true;
-                ++lexer;
-                break;
-            }
-        }
-        if (match.hit)
-        {
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Char");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<char32_t>(lexer.GetToken(pos).Chr()));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Char");
-        else soul::lexer::WriteFailureToLog(lexer, "Char");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::PI(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "PI");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953173);
-    soul::ast::SourcePos sourcePos = soul::ast::SourcePos();
-    std::u32string data = std::u32string();
-    std::unique_ptr<soul::parser::Value<std::string>> target;
-    std::unique_ptr<soul::parser::Value<char32_t>> chr;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            int64_t pos = lexer.GetPos();
-                            soul::parser::Match match(true);
-                            for (int32_t i : s17)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            if (match.hit)
-                            {
-                                sourcePos = lexer.GetSourcePos(pos);
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::PITarget(lexer);
-                            target.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                            *parentMatch6 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match* parentMatch8 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch9 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch10 = &match;
-                                {
-                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                    *parentMatch10 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch11 = &match;
-                                    {
-                                        soul::parser::Match match(true);
-                                        soul::parser::Match* parentMatch12 = &match;
-                                        {
-                                            while (true)
-                                            {
-                                                int64_t save = lexer.GetPos();
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    soul::parser::Match* parentMatch13 = &match;
-                                                    {
-                                                        soul::parser::Match match(false);
-                                                        soul::parser::Match* parentMatch14 = &match;
-                                                        {
-                                                            int64_t pos = lexer.GetPos();
-                                                            soul::parser::Match match(false);
-                                                            soul::parser::Match* parentMatch15 = &match;
-                                                            {
-                                                                soul::parser::Match match(false);
-                                                                soul::parser::Match* parentMatch16 = &match;
-                                                                int64_t save = lexer.GetPos();
-                                                                {
-                                                                    soul::parser::Match match = XmlParser<LexerT>::Char(lexer);
-                                                                    chr.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                                                                    *parentMatch16 = match;
-                                                                }
-                                                                if (match.hit)
-                                                                {
-                                                                    soul::parser::Match match(false);
-                                                                    soul::parser::Match* parentMatch17 = &match;
-                                                                    {
-                                                                        int64_t tmp = lexer.GetPos();
-                                                                        lexer.SetPos(save);
-                                                                        save = tmp;
-                                                                        soul::parser::Match match(true);
-                                                                        for (int32_t i : s18)
-                                                                        {
-                                                                            if (*lexer == i)
-                                                                            {
-                                                                                ++lexer;
-                                                                            }
-                                                                            else
-                                                                            {
-                                                                                match.hit = false;
-                                                                                break;
-                                                                            }
-                                                                        }
-                                                                        *parentMatch17 = match;
-                                                                    }
-                                                                    if (!match.hit)
-                                                                    {
-                                                                        lexer.SetPos(save);
-                                                                    }
-                                                                    *parentMatch16 = soul::parser::Match(!match.hit, match.value);
-                                                                }
-                                                                *parentMatch15 = match;
-                                                            }
-                                                            if (match.hit)
-                                                            {
-                                                                data.append(1, chr->value);
-                                                            }
-                                                            *parentMatch14 = match;
-                                                        }
-                                                        *parentMatch13 = match;
-                                                    }
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch12 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                        break;
-                                                    }
-                                                }
-                                            }
-                                        }
-                                        *parentMatch11 = match;
-                                    }
-                                    *parentMatch10 = match;
-                                }
-                                *parentMatch9 = match;
-                            }
-                            if (match.hit)
-                            {
-                                *parentMatch8 = match;
-                            }
-                            else
-                            {
-                                lexer.SetPos(save);
-                            }
-                        }
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch18 = &match;
-                {
-                    soul::parser::Match match(true);
-                    for (int32_t i : s19)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    *parentMatch18 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->PI(sourcePos, target->value, util::ToUtf8(data));
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PI");
-        else soul::lexer::WriteFailureToLog(lexer, "PI");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::PITarget(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "PITarget");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953174);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            int64_t save = lexer.GetPos();
-            {
-                soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t tmp = lexer.GetPos();
-                    lexer.SetPos(save);
-                    save = tmp;
-                    soul::parser::Match match = XmlParser<LexerT>::Xml(lexer);
-                    *parentMatch3 = match;
-                }
-                if (!match.hit)
-                {
-                    lexer.SetPos(save);
-                }
-                *parentMatch2 = soul::parser::Match(!match.hit, match.value);
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PITarget");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<std::string>(name->value));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PITarget");
-        else soul::lexer::WriteFailureToLog(lexer, "PITarget");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Name(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Name");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953175);
-    std::u32string name = std::u32string();
-    std::unique_ptr<soul::parser::Value<char32_t>> nameStartChar;
-    std::unique_ptr<soul::parser::Value<char32_t>> nameChar;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t pos = lexer.GetPos();
-                    soul::parser::Match match = XmlParser<LexerT>::NameStartChar(lexer);
-                    nameStartChar.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                    if (match.hit)
-                    {
-                        name.append(1, nameStartChar->value);
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch4 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch6 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch7 = &match;
-                                    {
-                                        int64_t pos = lexer.GetPos();
-                                        soul::parser::Match match = XmlParser<LexerT>::NameChar(lexer);
-                                        nameChar.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                                        if (match.hit)
-                                        {
-                                            name.append(1, nameChar->value);
-                                        }
-                                        *parentMatch7 = match;
-                                    }
-                                    *parentMatch6 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch5 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch4 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Name");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<std::string>(util::ToUtf8(name)));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Name");
-        else soul::lexer::WriteFailureToLog(lexer, "Name");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::NameStartChar(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "NameStartChar");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953176);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            for (const soul::ast::spg::Range& range : s20)
-            {
-                if (*lexer >= range.first && *lexer <= range.last)
-                {
-                    match.hit = true;
-                    ++lexer;
-                    break;
-                }
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NameStartChar");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<char32_t>(lexer.GetToken(pos).Chr()));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NameStartChar");
-        else soul::lexer::WriteFailureToLog(lexer, "NameStartChar");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::NameChar(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "NameChar");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953177);
-    std::unique_ptr<soul::parser::Value<char32_t>> nameStartChar;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                int64_t pos = lexer.GetPos();
-                soul::parser::Match match = XmlParser<LexerT>::NameStartChar(lexer);
-                nameStartChar.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                if (match.hit)
-                {
-                    {
-                        #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                        if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NameChar");
-                        #endif
-                        return soul::parser::Match(true, new soul::parser::Value<char32_t>(nameStartChar->value));
-                    }
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        for (const soul::ast::spg::Range& range : s21)
-                        {
-                            if (*lexer >= range.first && *lexer <= range.last)
-                            {
-                                match.hit = true;
-                                ++lexer;
-                                break;
-                            }
-                        }
-                        if (match.hit)
-                        {
-                            {
-                                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NameChar");
-                                #endif
-                                return soul::parser::Match(true, new soul::parser::Value<char32_t>(lexer.GetToken(pos).Chr()));
-                            }
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NameChar");
-        else soul::lexer::WriteFailureToLog(lexer, "NameChar");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Xml(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Xml");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953178);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            for (const soul::ast::spg::Range& range : s22)
-            {
-                if (*lexer >= range.first && *lexer <= range.last)
-                {
-                    match.hit = true;
-                    ++lexer;
-                    break;
-                }
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                for (const soul::ast::spg::Range& range : s23)
-                {
-                    if (*lexer >= range.first && *lexer <= range.last)
-                    {
-                        match.hit = true;
-                        ++lexer;
-                        break;
-                    }
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch3 = &match;
-        {
-            soul::parser::Match match(false);
-            for (const soul::ast::spg::Range& range : s24)
-            {
-                if (*lexer >= range.first && *lexer <= range.last)
-                {
-                    match.hit = true;
-                    ++lexer;
-                    break;
-                }
-            }
-            *parentMatch3 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Xml");
-        else soul::lexer::WriteFailureToLog(lexer, "Xml");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Element(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Element");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953179);
-    soul::ast::SourcePos sourcePos = soul::ast::SourcePos();
-    std::string tagName = std::string();
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 60)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                int64_t pos = lexer.GetPos();
-                                soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                                name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                                if (match.hit)
-                                {
-                                    sourcePos = lexer.GetSourcePos(pos);
-                                    tagName = name->value;
-                                    processor->BeginStartTag(sourcePos, tagName);
-                                }
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch8 = &match;
-                        {
-                            while (true)
-                            {
-                                int64_t save = lexer.GetPos();
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch9 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch10 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                            *parentMatch10 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch11 = &match;
-                                            {
-                                                soul::parser::Match match = XmlParser<LexerT>::Attribute(lexer, processor);
-                                                *parentMatch11 = match;
-                                            }
-                                            *parentMatch10 = match;
-                                        }
-                                        *parentMatch9 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        *parentMatch8 = match;
-                                    }
-                                    else
-                                    {
-                                        lexer.SetPos(save);
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch12 = &match;
-                {
-                    soul::parser::Match match(true);
-                    int64_t save = lexer.GetPos();
-                    soul::parser::Match* parentMatch13 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        if (match.hit)
-                        {
-                            *parentMatch13 = match;
-                        }
-                        else
-                        {
-                            lexer.SetPos(save);
-                        }
-                    }
-                    *parentMatch12 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch14 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch15 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch16 = &match;
-                    {
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch17 = &match;
-                        {
-                            int64_t pos = lexer.GetPos();
-                            soul::parser::Match match(true);
-                            for (int32_t i : s25)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            if (match.hit)
-                            {
-                                processor->EndStartTag();
-                                processor->EndTag(sourcePos, tagName);
-                            }
-                            *parentMatch17 = match;
-                        }
-                        *parentMatch16 = match;
-                        if (!match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch18 = &match;
-                            lexer.SetPos(save);
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch19 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch20 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch21 = &match;
-                                        {
-                                            int64_t pos = lexer.GetPos();
-                                            soul::parser::Match match(false);
-                                            if (*lexer == 62)
-                                            {
-                                                ++lexer;
-                                                match.hit = true;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                processor->EndStartTag();
-                                            }
-                                            *parentMatch21 = match;
-                                        }
-                                        *parentMatch20 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch22 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::Content(lexer, processor);
-                                            *parentMatch22 = match;
-                                        }
-                                        *parentMatch20 = match;
-                                    }
-                                    *parentMatch19 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch23 = &match;
-                                    {
-                                        soul::parser::Match match = XmlParser<LexerT>::ETag(lexer, processor);
-                                        *parentMatch23 = match;
-                                    }
-                                    *parentMatch19 = match;
-                                }
-                                *parentMatch18 = match;
-                            }
-                            *parentMatch16 = match;
-                        }
-                    }
-                    *parentMatch15 = match;
-                }
-                *parentMatch14 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Element");
-        else soul::lexer::WriteFailureToLog(lexer, "Element");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Attribute(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Attribute");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953180);
-    soul::ast::SourcePos sourcePos = soul::ast::SourcePos();
-    std::unique_ptr<soul::parser::Value<std::string>> attName;
-    std::unique_ptr<soul::parser::Value<std::string>> attValue;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                        attName.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                        if (match.hit)
-                        {
-                            sourcePos = lexer.GetSourcePos(pos);
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::Eq(lexer);
-                        *parentMatch5 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch6 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::AttValue(lexer, processor);
-                    attValue.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                    *parentMatch6 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->AddAttribute(sourcePos, attName->value, attValue->value);
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Attribute");
-        else soul::lexer::WriteFailureToLog(lexer, "Attribute");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::AttValue(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "AttValue");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953181);
-    std::unique_ptr<soul::parser::Value<std::string>> attValueDQ;
-    std::unique_ptr<soul::parser::Value<std::string>> attValueSQ;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t pos = lexer.GetPos();
-            soul::parser::Match match = XmlParser<LexerT>::AttValueDQ(lexer, processor);
-            attValueDQ.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-            if (match.hit)
-            {
-                {
-                    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                    if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttValue");
-                    #endif
-                    return soul::parser::Match(true, new soul::parser::Value<std::string>(attValueDQ->value));
-                }
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t pos = lexer.GetPos();
-                    soul::parser::Match match = XmlParser<LexerT>::AttValueSQ(lexer, processor);
-                    attValueSQ.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                    if (match.hit)
-                    {
-                        {
-                            #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                            if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttValue");
-                            #endif
-                            return soul::parser::Match(true, new soul::parser::Value<std::string>(attValueSQ->value));
-                        }
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttValue");
-        else soul::lexer::WriteFailureToLog(lexer, "AttValue");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::AttValueDQ(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "AttValueDQ");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953182);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        if (*lexer == 34)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        if (match.hit)
-                        {
-                            processor->BeginAttributeValue();
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            while (true)
-                            {
-                                int64_t save = lexer.GetPos();
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch7 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch8 = &match;
-                                        {
-                                            int64_t save = lexer.GetPos();
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch9 = &match;
-                                            {
-                                                int64_t pos = lexer.GetPos();
-                                                soul::parser::Match match(lexer.Pos() != lexer.End());
-                                                for (const soul::ast::spg::Range& range : s26)
-                                                {
-                                                    if (*lexer >= range.first && *lexer <= range.last)
-                                                    {
-                                                        match.hit = false;
-                                                        break;
-                                                    }
-                                                }
-                                                if (match.hit)
-                                                {
-                                                    ++lexer;
-                                                }
-                                                if (match.hit)
-                                                {
-                                                    processor->AddAttValueChar(lexer.GetToken(pos).Chr());
-                                                }
-                                                *parentMatch9 = match;
-                                            }
-                                            *parentMatch8 = match;
-                                            if (!match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch10 = &match;
-                                                lexer.SetPos(save);
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::Reference(lexer, processor);
-                                                    *parentMatch10 = match;
-                                                }
-                                                *parentMatch8 = match;
-                                            }
-                                        }
-                                        *parentMatch7 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        *parentMatch6 = match;
-                                    }
-                                    else
-                                    {
-                                        lexer.SetPos(save);
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        *parentMatch5 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch11 = &match;
-                {
-                    soul::parser::Match match(false);
-                    if (*lexer == 34)
-                    {
-                        ++lexer;
-                        match.hit = true;
-                    }
-                    *parentMatch11 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            std::string attValue = processor->AttValue();
-            processor->EndAttributeValue();
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttValueDQ");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<std::string>(attValue));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttValueDQ");
-        else soul::lexer::WriteFailureToLog(lexer, "AttValueDQ");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::AttValueSQ(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "AttValueSQ");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953183);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        if (*lexer == 39)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        if (match.hit)
-                        {
-                            processor->BeginAttributeValue();
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            while (true)
-                            {
-                                int64_t save = lexer.GetPos();
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch7 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch8 = &match;
-                                        {
-                                            int64_t save = lexer.GetPos();
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch9 = &match;
-                                            {
-                                                int64_t pos = lexer.GetPos();
-                                                soul::parser::Match match(lexer.Pos() != lexer.End());
-                                                for (const soul::ast::spg::Range& range : s27)
-                                                {
-                                                    if (*lexer >= range.first && *lexer <= range.last)
-                                                    {
-                                                        match.hit = false;
-                                                        break;
-                                                    }
-                                                }
-                                                if (match.hit)
-                                                {
-                                                    ++lexer;
-                                                }
-                                                if (match.hit)
-                                                {
-                                                    processor->AddAttValueChar(lexer.GetToken(pos).Chr());
-                                                }
-                                                *parentMatch9 = match;
-                                            }
-                                            *parentMatch8 = match;
-                                            if (!match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch10 = &match;
-                                                lexer.SetPos(save);
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::Reference(lexer, processor);
-                                                    *parentMatch10 = match;
-                                                }
-                                                *parentMatch8 = match;
-                                            }
-                                        }
-                                        *parentMatch7 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        *parentMatch6 = match;
-                                    }
-                                    else
-                                    {
-                                        lexer.SetPos(save);
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        *parentMatch5 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch11 = &match;
-                {
-                    soul::parser::Match match(false);
-                    if (*lexer == 39)
-                    {
-                        ++lexer;
-                        match.hit = true;
-                    }
-                    *parentMatch11 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            std::string attValue = processor->AttValue();
-            processor->EndAttributeValue();
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttValueSQ");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<std::string>(attValue));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttValueSQ");
-        else soul::lexer::WriteFailureToLog(lexer, "AttValueSQ");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Reference(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Reference");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953184);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match = XmlParser<LexerT>::CharRef(lexer, processor);
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch1 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::EntityRef(lexer, processor);
-                *parentMatch1 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Reference");
-        else soul::lexer::WriteFailureToLog(lexer, "Reference");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::CharRef(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "CharRef");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953185);
-    int32_t codePoint = int32_t();
-    std::unique_ptr<soul::parser::Value<int32_t>> decCodePoint;
-    std::unique_ptr<soul::parser::Value<int32_t>> hexCodePoint;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                int64_t save = lexer.GetPos();
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        for (int32_t i : s28)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::DecCodePoint(lexer);
-                            decCodePoint.reset(static_cast<soul::parser::Value<int32_t>*>(match.value));
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch6 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch7 = &match;
-                        {
-                            int64_t pos = lexer.GetPos();
-                            soul::parser::Match match(false);
-                            if (*lexer == 59)
-                            {
-                                ++lexer;
-                                match.hit = true;
-                            }
-                            if (match.hit)
-                            {
-                                codePoint = decCodePoint->value;
-                            }
-                            *parentMatch7 = match;
-                        }
-                        *parentMatch6 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-                if (!match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    lexer.SetPos(save);
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch9 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                soul::parser::Match match(true);
-                                for (int32_t i : s29)
-                                {
-                                    if (*lexer == i)
-                                    {
-                                        ++lexer;
-                                    }
-                                    else
-                                    {
-                                        match.hit = false;
-                                        break;
-                                    }
-                                }
-                                *parentMatch10 = match;
-                            }
-                            if (match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch11 = &match;
-                                {
-                                    soul::parser::Match match = XmlParser<LexerT>::HexCodePoint(lexer);
-                                    hexCodePoint.reset(static_cast<soul::parser::Value<int32_t>*>(match.value));
-                                    *parentMatch11 = match;
-                                }
-                                *parentMatch10 = match;
-                            }
-                            *parentMatch9 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch12 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch13 = &match;
-                                {
-                                    int64_t pos = lexer.GetPos();
-                                    soul::parser::Match match(false);
-                                    if (*lexer == 59)
-                                    {
-                                        ++lexer;
-                                        match.hit = true;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        codePoint = hexCodePoint->value;
-                                    }
-                                    *parentMatch13 = match;
-                                }
-                                *parentMatch12 = match;
-                            }
-                            *parentMatch9 = match;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    *parentMatch2 = match;
-                }
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->CharRef(lexer.GetSourcePos(pos), static_cast<char32_t>(codePoint));
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "CharRef");
-        else soul::lexer::WriteFailureToLog(lexer, "CharRef");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::DecCodePoint(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "DecCodePoint");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953186);
-    int32_t val = int32_t();
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        for (const soul::ast::spg::Range& range : s30)
-                        {
-                            if (*lexer >= range.first && *lexer <= range.last)
-                            {
-                                match.hit = true;
-                                ++lexer;
-                                break;
-                            }
-                        }
-                        if (match.hit)
-                        {
-                            val = 10 * val + (lexer.GetToken(pos).Chr() - '0');
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(true);
-                soul::parser::Match* parentMatch5 = &match;
-                while (true)
-                {
-                    int64_t save = lexer.GetPos();
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch7 = &match;
-                            {
-                                int64_t pos = lexer.GetPos();
-                                soul::parser::Match match(false);
-                                for (const soul::ast::spg::Range& range : s30)
-                                {
-                                    if (*lexer >= range.first && *lexer <= range.last)
-                                    {
-                                        match.hit = true;
-                                        ++lexer;
-                                        break;
-                                    }
-                                }
-                                if (match.hit)
-                                {
-                                    val = 10 * val + (lexer.GetToken(pos).Chr() - '0');
-                                }
-                                *parentMatch7 = match;
-                            }
-                            *parentMatch6 = match;
-                        }
-                        if (match.hit)
-                        {
-                            *parentMatch5 = match;
-                        }
-                        else
-                        {
-                            lexer.SetPos(save);
-                            break;
-                        }
-                    }
-                }
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "DecCodePoint");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<int32_t>(val));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "DecCodePoint");
-        else soul::lexer::WriteFailureToLog(lexer, "DecCodePoint");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::HexCodePoint(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "HexCodePoint");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953187);
-    int32_t val = int32_t();
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        for (const soul::ast::spg::Range& range : s31)
-                        {
-                            if (*lexer >= range.first && *lexer <= range.last)
-                            {
-                                match.hit = true;
-                                ++lexer;
-                                break;
-                            }
-                        }
-                        if (match.hit)
-                        {
-                            char32_t chr = lexer.GetToken(pos).Chr();
-                            if (chr >= '0' && chr <= '9')
-                            {
-                                val = 16 * val + (chr - '0');
-                            }
-                            else if (chr >= 'a' && chr <= 'f')
-                            {
-                                val = 16 * val + 10 + (chr - 'a');
-                            }
-                            else if (chr >= 'A' && chr <= 'F')
-                            {
-                                val = 16 * val + 10 + (chr - 'A');
-                            }
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(true);
-                soul::parser::Match* parentMatch5 = &match;
-                while (true)
-                {
-                    int64_t save = lexer.GetPos();
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch7 = &match;
-                            {
-                                int64_t pos = lexer.GetPos();
-                                soul::parser::Match match(false);
-                                for (const soul::ast::spg::Range& range : s31)
-                                {
-                                    if (*lexer >= range.first && *lexer <= range.last)
-                                    {
-                                        match.hit = true;
-                                        ++lexer;
-                                        break;
-                                    }
-                                }
-                                if (match.hit)
-                                {
-                                    char32_t chr = lexer.GetToken(pos).Chr();
-                                    if (chr >= '0' && chr <= '9')
-                                    {
-                                        val = 16 * val + (chr - '0');
-                                    }
-                                    else if (chr >= 'a' && chr <= 'f')
-                                    {
-                                        val = 16 * val + 10 + (chr - 'a');
-                                    }
-                                    else if (chr >= 'A' && chr <= 'F')
-                                    {
-                                        val = 16 * val + 10 + (chr - 'A');
-                                    }
-                                }
-                                *parentMatch7 = match;
-                            }
-                            *parentMatch6 = match;
-                        }
-                        if (match.hit)
-                        {
-                            *parentMatch5 = match;
-                        }
-                        else
-                        {
-                            lexer.SetPos(save);
-                            break;
-                        }
-                    }
-                }
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "HexCodePoint");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<int32_t>(val));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "HexCodePoint");
-        else soul::lexer::WriteFailureToLog(lexer, "HexCodePoint");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EntityRef(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EntityRef");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953188);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    if (*lexer == 38)
-                    {
-                        ++lexer;
-                        match.hit = true;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                        name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch5 = &match;
-                {
-                    soul::parser::Match match(false);
-                    if (*lexer == 59)
-                    {
-                        ++lexer;
-                        match.hit = true;
-                    }
-                    *parentMatch5 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->EntityRef(lexer.GetSourcePos(pos), name->value);
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EntityRef");
-        else soul::lexer::WriteFailureToLog(lexer, "EntityRef");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Content(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Content");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953189);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(true);
-            int64_t save = lexer.GetPos();
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::CharData(lexer, processor);
-                if (match.hit)
-                {
-                    *parentMatch2 = match;
-                }
-                else
-                {
-                    lexer.SetPos(save);
-                }
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch3 = &match;
-            {
-                soul::parser::Match match(true);
-                soul::parser::Match* parentMatch4 = &match;
-                {
-                    while (true)
-                    {
-                        int64_t save = lexer.GetPos();
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch5 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch6 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch7 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch8 = &match;
-                                        {
-                                            int64_t save = lexer.GetPos();
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch9 = &match;
-                                            {
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch10 = &match;
-                                                {
-                                                    int64_t save = lexer.GetPos();
-                                                    soul::parser::Match match(false);
-                                                    soul::parser::Match* parentMatch11 = &match;
-                                                    {
-                                                        int64_t save = lexer.GetPos();
-                                                        soul::parser::Match match = XmlParser<LexerT>::Element(lexer, processor);
-                                                        *parentMatch11 = match;
-                                                        if (!match.hit)
-                                                        {
-                                                            soul::parser::Match match(false);
-                                                            soul::parser::Match* parentMatch12 = &match;
-                                                            lexer.SetPos(save);
-                                                            {
-                                                                soul::parser::Match match = XmlParser<LexerT>::Reference(lexer, processor);
-                                                                *parentMatch12 = match;
-                                                            }
-                                                            *parentMatch11 = match;
-                                                        }
-                                                    }
-                                                    *parentMatch10 = match;
-                                                    if (!match.hit)
-                                                    {
-                                                        soul::parser::Match match(false);
-                                                        soul::parser::Match* parentMatch13 = &match;
-                                                        lexer.SetPos(save);
-                                                        {
-                                                            soul::parser::Match match = XmlParser<LexerT>::CDSect(lexer, processor);
-                                                            *parentMatch13 = match;
-                                                        }
-                                                        *parentMatch10 = match;
-                                                    }
-                                                }
-                                                *parentMatch9 = match;
-                                                if (!match.hit)
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    soul::parser::Match* parentMatch14 = &match;
-                                                    lexer.SetPos(save);
-                                                    {
-                                                        soul::parser::Match match = XmlParser<LexerT>::PI(lexer, processor);
-                                                        *parentMatch14 = match;
-                                                    }
-                                                    *parentMatch9 = match;
-                                                }
-                                            }
-                                            *parentMatch8 = match;
-                                            if (!match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch15 = &match;
-                                                lexer.SetPos(save);
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::Comment(lexer, processor);
-                                                    *parentMatch15 = match;
-                                                }
-                                                *parentMatch8 = match;
-                                            }
-                                        }
-                                        *parentMatch7 = match;
-                                    }
-                                    *parentMatch6 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch16 = &match;
-                                    {
-                                        soul::parser::Match match(true);
-                                        int64_t save = lexer.GetPos();
-                                        soul::parser::Match* parentMatch17 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::CharData(lexer, processor);
-                                            if (match.hit)
-                                            {
-                                                *parentMatch17 = match;
-                                            }
-                                            else
-                                            {
-                                                lexer.SetPos(save);
-                                            }
-                                        }
-                                        *parentMatch16 = match;
-                                    }
-                                    *parentMatch6 = match;
-                                }
-                                *parentMatch5 = match;
-                            }
-                            if (match.hit)
-                            {
-                                *parentMatch4 = match;
-                            }
-                            else
-                            {
-                                lexer.SetPos(save);
-                                break;
-                            }
-                        }
-                    }
-                }
-                *parentMatch3 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Content");
-        else soul::lexer::WriteFailureToLog(lexer, "Content");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::CharData(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "CharData");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953190);
-    soul::ast::SourcePos sourcePos = soul::ast::SourcePos();
-    std::u32string text = std::u32string();
-    std::unique_ptr<soul::parser::Value<char32_t>> charDataChar;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t pos = lexer.GetPos();
-                    soul::parser::Match match(true);
-                    if (match.hit)
-                    {
-                        sourcePos = lexer.GetSourcePos(pos);
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch4 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch7 = &match;
-                            {
-                                int64_t pos = lexer.GetPos();
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch8 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch9 = &match;
-                                    int64_t save = lexer.GetPos();
-                                    {
-                                        soul::parser::Match match = XmlParser<LexerT>::CharDataChar(lexer);
-                                        charDataChar.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                                        *parentMatch9 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch10 = &match;
-                                        {
-                                            int64_t tmp = lexer.GetPos();
-                                            lexer.SetPos(save);
-                                            save = tmp;
-                                            soul::parser::Match match(true);
-                                            for (int32_t i : s32)
-                                            {
-                                                if (*lexer == i)
-                                                {
-                                                    ++lexer;
-                                                }
-                                                else
-                                                {
-                                                    match.hit = false;
-                                                    break;
-                                                }
-                                            }
-                                            *parentMatch10 = match;
-                                        }
-                                        if (!match.hit)
-                                        {
-                                            lexer.SetPos(save);
-                                        }
-                                        *parentMatch9 = soul::parser::Match(!match.hit, match.value);
-                                    }
-                                    *parentMatch8 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    text.append(1, charDataChar->value);
-                                }
-                                *parentMatch7 = match;
-                            }
-                            *parentMatch6 = match;
-                        }
-                        *parentMatch5 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch11 = &match;
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch12 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch13 = &match;
-                                    {
-                                        int64_t pos = lexer.GetPos();
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch14 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch15 = &match;
-                                            int64_t save = lexer.GetPos();
-                                            {
-                                                soul::parser::Match match = XmlParser<LexerT>::CharDataChar(lexer);
-                                                charDataChar.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                                                *parentMatch15 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch16 = &match;
-                                                {
-                                                    int64_t tmp = lexer.GetPos();
-                                                    lexer.SetPos(save);
-                                                    save = tmp;
-                                                    soul::parser::Match match(true);
-                                                    for (int32_t i : s32)
-                                                    {
-                                                        if (*lexer == i)
-                                                        {
-                                                            ++lexer;
-                                                        }
-                                                        else
-                                                        {
-                                                            match.hit = false;
-                                                            break;
-                                                        }
-                                                    }
-                                                    *parentMatch16 = match;
-                                                }
-                                                if (!match.hit)
-                                                {
-                                                    lexer.SetPos(save);
-                                                }
-                                                *parentMatch15 = soul::parser::Match(!match.hit, match.value);
-                                            }
-                                            *parentMatch14 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            text.append(1, charDataChar->value);
-                                        }
-                                        *parentMatch13 = match;
-                                    }
-                                    *parentMatch12 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch11 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch4 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->Text(sourcePos, util::ToUtf8(text));
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "CharData");
-        else soul::lexer::WriteFailureToLog(lexer, "CharData");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::CharDataChar(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "CharDataChar");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953191);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(lexer.Pos() != lexer.End());
-        for (const soul::ast::spg::Range& range : s33)
-        {
-            if (*lexer >= range.first && *lexer <= range.last)
-            {
-                match.hit = false;
-                break;
-            }
-        }
-        if (match.hit)
-        {
-            ++lexer;
-        }
-        if (match.hit)
-        {
-            {
-                #ifdef SOUL_PARSER_DEBUG_SUPPORT
-                if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "CharDataChar");
-                #endif
-                return soul::parser::Match(true, new soul::parser::Value<char32_t>(lexer.GetToken(pos).Chr()));
-            }
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "CharDataChar");
-        else soul::lexer::WriteFailureToLog(lexer, "CharDataChar");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::CDSect(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "CDSect");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953192);
-    soul::ast::SourcePos sourcePos = soul::ast::SourcePos();
-    std::u32string cdata = std::u32string();
-    std::unique_ptr<soul::parser::Value<char32_t>> chr;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t pos = lexer.GetPos();
-                        soul::parser::Match match(true);
-                        for (int32_t i : s34)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        if (match.hit)
-                        {
-                            sourcePos = lexer.GetSourcePos(pos);
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            while (true)
-                            {
-                                int64_t save = lexer.GetPos();
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch7 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch8 = &match;
-                                        {
-                                            int64_t pos = lexer.GetPos();
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch9 = &match;
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch10 = &match;
-                                                int64_t save = lexer.GetPos();
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::Char(lexer);
-                                                    chr.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                                                    *parentMatch10 = match;
-                                                }
-                                                if (match.hit)
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    soul::parser::Match* parentMatch11 = &match;
-                                                    {
-                                                        int64_t tmp = lexer.GetPos();
-                                                        lexer.SetPos(save);
-                                                        save = tmp;
-                                                        soul::parser::Match match(true);
-                                                        for (int32_t i : s35)
-                                                        {
-                                                            if (*lexer == i)
-                                                            {
-                                                                ++lexer;
-                                                            }
-                                                            else
-                                                            {
-                                                                match.hit = false;
-                                                                break;
-                                                            }
-                                                        }
-                                                        *parentMatch11 = match;
-                                                    }
-                                                    if (!match.hit)
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                    *parentMatch10 = soul::parser::Match(!match.hit, match.value);
-                                                }
-                                                *parentMatch9 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                cdata.append(1, chr->value);
-                                            }
-                                            *parentMatch8 = match;
-                                        }
-                                        *parentMatch7 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        *parentMatch6 = match;
-                                    }
-                                    else
-                                    {
-                                        lexer.SetPos(save);
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        *parentMatch5 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch12 = &match;
-                {
-                    soul::parser::Match match(true);
-                    for (int32_t i : s36)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    *parentMatch12 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->CDataSection(sourcePos, util::ToUtf8(cdata));
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "CDSect");
-        else soul::lexer::WriteFailureToLog(lexer, "CDSect");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::ETag(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "ETag");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953193);
-    soul::ast::SourcePos sourcePos = soul::ast::SourcePos();
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t pos = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        for (int32_t i : s37)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                int64_t pos = lexer.GetPos();
-                                soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                                name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                                if (match.hit)
-                                {
-                                    sourcePos = lexer.GetSourcePos(pos);
-                                }
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match* parentMatch8 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                            if (match.hit)
-                            {
-                                *parentMatch8 = match;
-                            }
-                            else
-                            {
-                                lexer.SetPos(save);
-                            }
-                        }
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch9 = &match;
-                {
-                    soul::parser::Match match(false);
-                    if (*lexer == 62)
-                    {
-                        ++lexer;
-                        match.hit = true;
-                    }
-                    *parentMatch9 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            processor->EndTag(sourcePos, name->value);
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "ETag");
-        else soul::lexer::WriteFailureToLog(lexer, "ETag");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::DocTypeDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "DocTypeDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953194);
-    std::unique_ptr<soul::parser::Value<std::string>> rootElementName;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match(true);
-                                for (int32_t i : s38)
-                                {
-                                    if (*lexer == i)
-                                    {
-                                        ++lexer;
-                                    }
-                                    else
-                                    {
-                                        match.hit = false;
-                                        break;
-                                    }
-                                }
-                                *parentMatch6 = match;
-                            }
-                            if (match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch7 = &match;
-                                {
-                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                    *parentMatch7 = match;
-                                }
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch8 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                                rootElementName.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                                *parentMatch8 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch9 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch11 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch12 = &match;
-                                    {
-                                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                        *parentMatch12 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch13 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::ExternalID(lexer);
-                                            *parentMatch13 = match;
-                                        }
-                                        *parentMatch12 = match;
-                                    }
-                                    *parentMatch11 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch10 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                }
-                            }
-                            *parentMatch9 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch14 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match* parentMatch15 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                            if (match.hit)
-                            {
-                                *parentMatch15 = match;
-                            }
-                            else
-                            {
-                                lexer.SetPos(save);
-                            }
-                        }
-                        *parentMatch14 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch16 = &match;
-                {
-                    soul::parser::Match match(true);
-                    int64_t save = lexer.GetPos();
-                    soul::parser::Match* parentMatch17 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch18 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch19 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch20 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch21 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        if (*lexer == 91)
-                                        {
-                                            ++lexer;
-                                            match.hit = true;
-                                        }
-                                        *parentMatch21 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch22 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::IntSubset(lexer, processor);
-                                            *parentMatch22 = match;
-                                        }
-                                        *parentMatch21 = match;
-                                    }
-                                    *parentMatch20 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch23 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        if (*lexer == 93)
-                                        {
-                                            ++lexer;
-                                            match.hit = true;
-                                        }
-                                        *parentMatch23 = match;
-                                    }
-                                    *parentMatch20 = match;
-                                }
-                                *parentMatch19 = match;
-                            }
-                            if (match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch24 = &match;
-                                {
-                                    soul::parser::Match match(true);
-                                    int64_t save = lexer.GetPos();
-                                    soul::parser::Match* parentMatch25 = &match;
-                                    {
-                                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                        if (match.hit)
-                                        {
-                                            *parentMatch25 = match;
-                                        }
-                                        else
-                                        {
-                                            lexer.SetPos(save);
-                                        }
-                                    }
-                                    *parentMatch24 = match;
-                                }
-                                *parentMatch19 = match;
-                            }
-                            *parentMatch18 = match;
-                        }
-                        if (match.hit)
-                        {
-                            *parentMatch17 = match;
-                        }
-                        else
-                        {
-                            lexer.SetPos(save);
-                        }
-                    }
-                    *parentMatch16 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch26 = &match;
-            {
-                soul::parser::Match match(false);
-                if (*lexer == 62)
-                {
-                    ++lexer;
-                    match.hit = true;
-                }
-                *parentMatch26 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "DocTypeDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "DocTypeDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::ExternalID(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "ExternalID");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953195);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(true);
-                    for (int32_t i : s39)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch5 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::SystemLiteral(lexer);
-                    *parentMatch5 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch6 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch7 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch9 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch11 = &match;
-                                {
-                                    soul::parser::Match match(true);
-                                    for (int32_t i : s40)
-                                    {
-                                        if (*lexer == i)
-                                        {
-                                            ++lexer;
-                                        }
-                                        else
-                                        {
-                                            match.hit = false;
-                                            break;
-                                        }
-                                    }
-                                    *parentMatch11 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch12 = &match;
-                                    {
-                                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                        *parentMatch12 = match;
-                                    }
-                                    *parentMatch11 = match;
-                                }
-                                *parentMatch10 = match;
-                            }
-                            if (match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch13 = &match;
-                                {
-                                    soul::parser::Match match = XmlParser<LexerT>::PubidLiteral(lexer);
-                                    *parentMatch13 = match;
-                                }
-                                *parentMatch10 = match;
-                            }
-                            *parentMatch9 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch14 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                *parentMatch14 = match;
-                            }
-                            *parentMatch9 = match;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch15 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::SystemLiteral(lexer);
-                            *parentMatch15 = match;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    *parentMatch7 = match;
-                }
-                *parentMatch6 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "ExternalID");
-        else soul::lexer::WriteFailureToLog(lexer, "ExternalID");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::SystemLiteral(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "SystemLiteral");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953196);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                if (*lexer == 34)
-                {
-                    ++lexer;
-                    match.hit = true;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(lexer.Pos() != lexer.End());
-                                for (const soul::ast::spg::Range& range : s41)
-                                {
-                                    if (*lexer >= range.first && *lexer <= range.last)
-                                    {
-                                        match.hit = false;
-                                        break;
-                                    }
-                                }
-                                if (match.hit)
-                                {
-                                    ++lexer;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch4 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch5 = &match;
-            {
-                soul::parser::Match match(false);
-                if (*lexer == 34)
-                {
-                    ++lexer;
-                    match.hit = true;
-                }
-                *parentMatch5 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch6 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch7 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 39)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch9 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                while (true)
-                                {
-                                    int64_t save = lexer.GetPos();
-                                    {
-                                        soul::parser::Match match(lexer.Pos() != lexer.End());
-                                        for (const soul::ast::spg::Range& range : s42)
-                                        {
-                                            if (*lexer >= range.first && *lexer <= range.last)
-                                            {
-                                                match.hit = false;
-                                                break;
-                                            }
-                                        }
-                                        if (match.hit)
-                                        {
-                                            ++lexer;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            *parentMatch10 = match;
-                                        }
-                                        else
-                                        {
-                                            lexer.SetPos(save);
-                                            break;
-                                        }
-                                    }
-                                }
-                            }
-                            *parentMatch9 = match;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    *parentMatch7 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch11 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 39)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch11 = match;
-                    }
-                    *parentMatch7 = match;
-                }
-                *parentMatch6 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "SystemLiteral");
-        else soul::lexer::WriteFailureToLog(lexer, "SystemLiteral");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::PubidLiteral(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "PubidLiteral");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953197);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                if (*lexer == 34)
-                {
-                    ++lexer;
-                    match.hit = true;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::PubidChar(lexer);
-                                if (match.hit)
-                                {
-                                    *parentMatch4 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch5 = &match;
-            {
-                soul::parser::Match match(false);
-                if (*lexer == 34)
-                {
-                    ++lexer;
-                    match.hit = true;
-                }
-                *parentMatch5 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch6 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch7 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 39)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch9 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                while (true)
-                                {
-                                    int64_t save = lexer.GetPos();
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch11 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch12 = &match;
-                                            int64_t save = lexer.GetPos();
-                                            {
-                                                soul::parser::Match match = XmlParser<LexerT>::PubidChar(lexer);
-                                                *parentMatch12 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch13 = &match;
-                                                {
-                                                    int64_t tmp = lexer.GetPos();
-                                                    lexer.SetPos(save);
-                                                    save = tmp;
-                                                    soul::parser::Match match(false);
-                                                    if (*lexer == 39)
-                                                    {
-                                                        ++lexer;
-                                                        match.hit = true;
-                                                    }
-                                                    *parentMatch13 = match;
-                                                }
-                                                if (!match.hit)
-                                                {
-                                                    lexer.SetPos(save);
-                                                }
-                                                *parentMatch12 = soul::parser::Match(!match.hit, match.value);
-                                            }
-                                            *parentMatch11 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            *parentMatch10 = match;
-                                        }
-                                        else
-                                        {
-                                            lexer.SetPos(save);
-                                            break;
-                                        }
-                                    }
-                                }
-                            }
-                            *parentMatch9 = match;
-                        }
-                        *parentMatch8 = match;
-                    }
-                    *parentMatch7 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch14 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 39)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch14 = match;
-                    }
-                    *parentMatch7 = match;
-                }
-                *parentMatch6 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PubidLiteral");
-        else soul::lexer::WriteFailureToLog(lexer, "PubidLiteral");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::PubidChar(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "PubidChar");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953198);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match(false);
-            for (const soul::ast::spg::Range& range : s43)
-            {
-                if (*lexer >= range.first && *lexer <= range.last)
-                {
-                    match.hit = true;
-                    ++lexer;
-                    break;
-                }
-            }
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch2 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match(false);
-                    for (const soul::ast::spg::Range& range : s44)
-                    {
-                        if (*lexer >= range.first && *lexer <= range.last)
-                        {
-                            match.hit = true;
-                            ++lexer;
-                            break;
-                        }
-                    }
-                    *parentMatch2 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch3 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                for (const soul::ast::spg::Range& range : s45)
-                {
-                    if (*lexer >= range.first && *lexer <= range.last)
-                    {
-                        match.hit = true;
-                        ++lexer;
-                        break;
-                    }
-                }
-                *parentMatch3 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PubidChar");
-        else soul::lexer::WriteFailureToLog(lexer, "PubidChar");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::IntSubset(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "IntSubset");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953199);
-    soul::parser::Match match(true);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        while (true)
-        {
-            int64_t save = lexer.GetPos();
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch1 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch2 = &match;
-                    {
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match match = XmlParser<LexerT>::MarkupDecl(lexer, processor);
-                        *parentMatch2 = match;
-                        if (!match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch3 = &match;
-                            lexer.SetPos(save);
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::DeclSep(lexer, processor);
-                                *parentMatch3 = match;
-                            }
-                            *parentMatch2 = match;
-                        }
-                    }
-                    *parentMatch1 = match;
-                }
-                if (match.hit)
-                {
-                    *parentMatch0 = match;
-                }
-                else
-                {
-                    lexer.SetPos(save);
-                    break;
-                }
-            }
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "IntSubset");
-        else soul::lexer::WriteFailureToLog(lexer, "IntSubset");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::MarkupDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "MarkupDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953200);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                int64_t save = lexer.GetPos();
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t save = lexer.GetPos();
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match match = XmlParser<LexerT>::ElementDecl(lexer, processor);
-                        *parentMatch4 = match;
-                        if (!match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch5 = &match;
-                            lexer.SetPos(save);
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::AttlistDecl(lexer, processor);
-                                *parentMatch5 = match;
-                            }
-                            *parentMatch4 = match;
-                        }
-                    }
-                    *parentMatch3 = match;
-                    if (!match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch6 = &match;
-                        lexer.SetPos(save);
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::EntityDecl(lexer, processor);
-                            *parentMatch6 = match;
-                        }
-                        *parentMatch3 = match;
-                    }
-                }
-                *parentMatch2 = match;
-                if (!match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    lexer.SetPos(save);
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::NotationDecl(lexer, processor);
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch2 = match;
-                }
-            }
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch8 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::PI(lexer, processor);
-                    *parentMatch8 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch9 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::Comment(lexer, processor);
-                *parentMatch9 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "MarkupDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "MarkupDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::ElementDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "ElementDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953201);
-    std::unique_ptr<soul::parser::Value<std::string>> elementName;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            for (int32_t i : s46)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            *parentMatch5 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch7 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                            elementName.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                            *parentMatch7 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        *parentMatch8 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch9 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::ContentSpec(lexer);
-                    *parentMatch9 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch10 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch11 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch11 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch10 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch12 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 62)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch12 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "ElementDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "ElementDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::ContentSpec(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "ContentSpec");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953202);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                int64_t save = lexer.GetPos();
-                soul::parser::Match match(true);
-                for (int32_t i : s47)
-                {
-                    if (*lexer == i)
-                    {
-                        ++lexer;
-                    }
-                    else
-                    {
-                        match.hit = false;
-                        break;
-                    }
-                }
-                *parentMatch2 = match;
-                if (!match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch3 = &match;
-                    lexer.SetPos(save);
-                    {
-                        soul::parser::Match match(true);
-                        for (int32_t i : s48)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        *parentMatch3 = match;
-                    }
-                    *parentMatch2 = match;
-                }
-            }
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch4 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::Mixed(lexer);
-                    *parentMatch4 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch5 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::Children(lexer);
-                *parentMatch5 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "ContentSpec");
-        else soul::lexer::WriteFailureToLog(lexer, "ContentSpec");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Mixed(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Mixed");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953203);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            if (*lexer == 40)
-                            {
-                                ++lexer;
-                                match.hit = true;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match(true);
-                                int64_t save = lexer.GetPos();
-                                soul::parser::Match* parentMatch7 = &match;
-                                {
-                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                    if (match.hit)
-                                    {
-                                        *parentMatch7 = match;
-                                    }
-                                    else
-                                    {
-                                        lexer.SetPos(save);
-                                    }
-                                }
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch8 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            for (int32_t i : s49)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            *parentMatch8 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch9 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch10 = &match;
-                        {
-                            while (true)
-                            {
-                                int64_t save = lexer.GetPos();
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch11 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch12 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch13 = &match;
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch14 = &match;
-                                                {
-                                                    soul::parser::Match match(true);
-                                                    int64_t save = lexer.GetPos();
-                                                    soul::parser::Match* parentMatch15 = &match;
-                                                    {
-                                                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                        if (match.hit)
-                                                        {
-                                                            *parentMatch15 = match;
-                                                        }
-                                                        else
-                                                        {
-                                                            lexer.SetPos(save);
-                                                        }
-                                                    }
-                                                    *parentMatch14 = match;
-                                                }
-                                                if (match.hit)
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    soul::parser::Match* parentMatch16 = &match;
-                                                    {
-                                                        soul::parser::Match match(false);
-                                                        if (*lexer == 124)
-                                                        {
-                                                            ++lexer;
-                                                            match.hit = true;
-                                                        }
-                                                        *parentMatch16 = match;
-                                                    }
-                                                    *parentMatch14 = match;
-                                                }
-                                                *parentMatch13 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch17 = &match;
-                                                {
-                                                    soul::parser::Match match(true);
-                                                    int64_t save = lexer.GetPos();
-                                                    soul::parser::Match* parentMatch18 = &match;
-                                                    {
-                                                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                        if (match.hit)
-                                                        {
-                                                            *parentMatch18 = match;
-                                                        }
-                                                        else
-                                                        {
-                                                            lexer.SetPos(save);
-                                                        }
-                                                    }
-                                                    *parentMatch17 = match;
-                                                }
-                                                *parentMatch13 = match;
-                                            }
-                                            *parentMatch12 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch19 = &match;
-                                            {
-                                                soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                                                name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                                                *parentMatch19 = match;
-                                            }
-                                            *parentMatch12 = match;
-                                        }
-                                        *parentMatch11 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        *parentMatch10 = match;
-                                    }
-                                    else
-                                    {
-                                        lexer.SetPos(save);
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        *parentMatch9 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch20 = &match;
-                {
-                    soul::parser::Match match(true);
-                    int64_t save = lexer.GetPos();
-                    soul::parser::Match* parentMatch21 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        if (match.hit)
-                        {
-                            *parentMatch21 = match;
-                        }
-                        else
-                        {
-                            lexer.SetPos(save);
-                        }
-                    }
-                    *parentMatch20 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch22 = &match;
-            {
-                soul::parser::Match match(true);
-                for (int32_t i : s50)
-                {
-                    if (*lexer == i)
-                    {
-                        ++lexer;
-                    }
-                    else
-                    {
-                        match.hit = false;
-                        break;
-                    }
-                }
-                *parentMatch22 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch23 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch24 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch25 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch26 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch27 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                if (*lexer == 40)
-                                {
-                                    ++lexer;
-                                    match.hit = true;
-                                }
-                                *parentMatch27 = match;
-                            }
-                            if (match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch28 = &match;
-                                {
-                                    soul::parser::Match match(true);
-                                    int64_t save = lexer.GetPos();
-                                    soul::parser::Match* parentMatch29 = &match;
-                                    {
-                                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                        if (match.hit)
-                                        {
-                                            *parentMatch29 = match;
-                                        }
-                                        else
-                                        {
-                                            lexer.SetPos(save);
-                                        }
-                                    }
-                                    *parentMatch28 = match;
-                                }
-                                *parentMatch27 = match;
-                            }
-                            *parentMatch26 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch30 = &match;
-                            {
-                                soul::parser::Match match(true);
-                                for (int32_t i : s51)
-                                {
-                                    if (*lexer == i)
-                                    {
-                                        ++lexer;
-                                    }
-                                    else
-                                    {
-                                        match.hit = false;
-                                        break;
-                                    }
-                                }
-                                *parentMatch30 = match;
-                            }
-                            *parentMatch26 = match;
-                        }
-                        *parentMatch25 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch31 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match* parentMatch32 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                if (match.hit)
-                                {
-                                    *parentMatch32 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                }
-                            }
-                            *parentMatch31 = match;
-                        }
-                        *parentMatch25 = match;
-                    }
-                    *parentMatch24 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch33 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 41)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch33 = match;
-                    }
-                    *parentMatch24 = match;
-                }
-                *parentMatch23 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Mixed");
-        else soul::lexer::WriteFailureToLog(lexer, "Mixed");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Choice(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Choice");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953204);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 40)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                if (match.hit)
-                                {
-                                    *parentMatch6 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                }
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::CP(lexer);
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch8 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch9 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch10 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch11 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch12 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch13 = &match;
-                                    {
-                                        soul::parser::Match match(true);
-                                        int64_t save = lexer.GetPos();
-                                        soul::parser::Match* parentMatch14 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                            if (match.hit)
-                                            {
-                                                *parentMatch14 = match;
-                                            }
-                                            else
-                                            {
-                                                lexer.SetPos(save);
-                                            }
-                                        }
-                                        *parentMatch13 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch15 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            if (*lexer == 124)
-                                            {
-                                                ++lexer;
-                                                match.hit = true;
-                                            }
-                                            *parentMatch15 = match;
-                                        }
-                                        *parentMatch13 = match;
-                                    }
-                                    *parentMatch12 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch16 = &match;
-                                    {
-                                        soul::parser::Match match(true);
-                                        int64_t save = lexer.GetPos();
-                                        soul::parser::Match* parentMatch17 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                            if (match.hit)
-                                            {
-                                                *parentMatch17 = match;
-                                            }
-                                            else
-                                            {
-                                                lexer.SetPos(save);
-                                            }
-                                        }
-                                        *parentMatch16 = match;
-                                    }
-                                    *parentMatch12 = match;
-                                }
-                                *parentMatch11 = match;
-                            }
-                            if (match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch18 = &match;
-                                {
-                                    soul::parser::Match match = XmlParser<LexerT>::CP(lexer);
-                                    *parentMatch18 = match;
-                                }
-                                *parentMatch11 = match;
-                            }
-                            *parentMatch10 = match;
-                        }
-                        *parentMatch9 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(true);
-                        soul::parser::Match* parentMatch19 = &match;
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch20 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch21 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch22 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch23 = &match;
-                                            {
-                                                soul::parser::Match match(true);
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match* parentMatch24 = &match;
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch24 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                }
-                                                *parentMatch23 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch25 = &match;
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    if (*lexer == 124)
-                                                    {
-                                                        ++lexer;
-                                                        match.hit = true;
-                                                    }
-                                                    *parentMatch25 = match;
-                                                }
-                                                *parentMatch23 = match;
-                                            }
-                                            *parentMatch22 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch26 = &match;
-                                            {
-                                                soul::parser::Match match(true);
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match* parentMatch27 = &match;
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch27 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                }
-                                                *parentMatch26 = match;
-                                            }
-                                            *parentMatch22 = match;
-                                        }
-                                        *parentMatch21 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch28 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::CP(lexer);
-                                            *parentMatch28 = match;
-                                        }
-                                        *parentMatch21 = match;
-                                    }
-                                    *parentMatch20 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch19 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch8 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch29 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch30 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch30 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch29 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch31 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 41)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch31 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Choice");
-        else soul::lexer::WriteFailureToLog(lexer, "Choice");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::CP(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "CP");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953205);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                int64_t save = lexer.GetPos();
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t save = lexer.GetPos();
-                    soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                    name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                    *parentMatch3 = match;
-                    if (!match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch4 = &match;
-                        lexer.SetPos(save);
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::Choice(lexer);
-                            *parentMatch4 = match;
-                        }
-                        *parentMatch3 = match;
-                    }
-                }
-                *parentMatch2 = match;
-                if (!match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    lexer.SetPos(save);
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::Seq(lexer);
-                        *parentMatch5 = match;
-                    }
-                    *parentMatch2 = match;
-                }
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch6 = &match;
-        {
-            soul::parser::Match match(true);
-            int64_t save = lexer.GetPos();
-            soul::parser::Match* parentMatch7 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch8 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch9 = &match;
-                    {
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch10 = &match;
-                        {
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match match(false);
-                            if (*lexer == 63)
-                            {
-                                ++lexer;
-                                match.hit = true;
-                            }
-                            *parentMatch10 = match;
-                            if (!match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch11 = &match;
-                                lexer.SetPos(save);
-                                {
-                                    soul::parser::Match match(false);
-                                    if (*lexer == 42)
-                                    {
-                                        ++lexer;
-                                        match.hit = true;
-                                    }
-                                    *parentMatch11 = match;
-                                }
-                                *parentMatch10 = match;
-                            }
-                        }
-                        *parentMatch9 = match;
-                        if (!match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch12 = &match;
-                            lexer.SetPos(save);
-                            {
-                                soul::parser::Match match(false);
-                                if (*lexer == 43)
-                                {
-                                    ++lexer;
-                                    match.hit = true;
-                                }
-                                *parentMatch12 = match;
-                            }
-                            *parentMatch9 = match;
-                        }
-                    }
-                    *parentMatch8 = match;
-                }
-                if (match.hit)
-                {
-                    *parentMatch7 = match;
-                }
-                else
-                {
-                    lexer.SetPos(save);
-                }
-            }
-            *parentMatch6 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "CP");
-        else soul::lexer::WriteFailureToLog(lexer, "CP");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Seq(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Seq");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953206);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 40)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                if (match.hit)
-                                {
-                                    *parentMatch6 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                }
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::CP(lexer);
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch8 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch9 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch10 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch11 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch12 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch13 = &match;
-                                            {
-                                                soul::parser::Match match(true);
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match* parentMatch14 = &match;
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch14 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                }
-                                                *parentMatch13 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch15 = &match;
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    if (*lexer == 44)
-                                                    {
-                                                        ++lexer;
-                                                        match.hit = true;
-                                                    }
-                                                    *parentMatch15 = match;
-                                                }
-                                                *parentMatch13 = match;
-                                            }
-                                            *parentMatch12 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch16 = &match;
-                                            {
-                                                soul::parser::Match match(true);
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match* parentMatch17 = &match;
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch17 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                }
-                                                *parentMatch16 = match;
-                                            }
-                                            *parentMatch12 = match;
-                                        }
-                                        *parentMatch11 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch18 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::CP(lexer);
-                                            *parentMatch18 = match;
-                                        }
-                                        *parentMatch11 = match;
-                                    }
-                                    *parentMatch10 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch9 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch8 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch19 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch20 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch20 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch19 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch21 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 41)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch21 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Seq");
-        else soul::lexer::WriteFailureToLog(lexer, "Seq");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Children(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Children");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953207);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                int64_t save = lexer.GetPos();
-                soul::parser::Match match = XmlParser<LexerT>::Choice(lexer);
-                *parentMatch2 = match;
-                if (!match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch3 = &match;
-                    lexer.SetPos(save);
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::Seq(lexer);
-                        *parentMatch3 = match;
-                    }
-                    *parentMatch2 = match;
-                }
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch4 = &match;
-        {
-            soul::parser::Match match(true);
-            int64_t save = lexer.GetPos();
-            soul::parser::Match* parentMatch5 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch6 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch8 = &match;
-                        {
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match match(false);
-                            if (*lexer == 63)
-                            {
-                                ++lexer;
-                                match.hit = true;
-                            }
-                            *parentMatch8 = match;
-                            if (!match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch9 = &match;
-                                lexer.SetPos(save);
-                                {
-                                    soul::parser::Match match(false);
-                                    if (*lexer == 42)
-                                    {
-                                        ++lexer;
-                                        match.hit = true;
-                                    }
-                                    *parentMatch9 = match;
-                                }
-                                *parentMatch8 = match;
-                            }
-                        }
-                        *parentMatch7 = match;
-                        if (!match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch10 = &match;
-                            lexer.SetPos(save);
-                            {
-                                soul::parser::Match match(false);
-                                if (*lexer == 43)
-                                {
-                                    ++lexer;
-                                    match.hit = true;
-                                }
-                                *parentMatch10 = match;
-                            }
-                            *parentMatch7 = match;
-                        }
-                    }
-                    *parentMatch6 = match;
-                }
-                if (match.hit)
-                {
-                    *parentMatch5 = match;
-                }
-                else
-                {
-                    lexer.SetPos(save);
-                }
-            }
-            *parentMatch4 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Children");
-        else soul::lexer::WriteFailureToLog(lexer, "Children");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::AttlistDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "AttlistDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953208);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        for (int32_t i : s52)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch6 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                        name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                        *parentMatch6 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch7 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::AttDef(lexer, processor);
-                                if (match.hit)
-                                {
-                                    *parentMatch8 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch7 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch9 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch10 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch10 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch9 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch11 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 62)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch11 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttlistDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "AttlistDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::AttDef(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "AttDef");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953209);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                            name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch6 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        *parentMatch6 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch7 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::AttType(lexer);
-                    *parentMatch7 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch8 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                *parentMatch8 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch9 = &match;
-        {
-            soul::parser::Match match = XmlParser<LexerT>::DefaultDecl(lexer, processor);
-            *parentMatch9 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttDef");
-        else soul::lexer::WriteFailureToLog(lexer, "AttDef");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::AttType(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "AttType");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953210);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match = XmlParser<LexerT>::StringType(lexer);
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch2 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::TokenizedType(lexer);
-                    *parentMatch2 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch3 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::EnumeratedType(lexer);
-                *parentMatch3 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AttType");
-        else soul::lexer::WriteFailureToLog(lexer, "AttType");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::StringType(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "StringType");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953211);
-    soul::parser::Match match(true);
-    for (int32_t i : s53)
-    {
-        if (*lexer == i)
-        {
-            ++lexer;
-        }
-        else
-        {
-            match.hit = false;
-            break;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "StringType");
-        else soul::lexer::WriteFailureToLog(lexer, "StringType");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::TokenizedType(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "TokenizedType");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953212);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                int64_t save = lexer.GetPos();
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    int64_t save = lexer.GetPos();
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match match(true);
-                            for (int32_t i : s54)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            *parentMatch5 = match;
-                            if (!match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch6 = &match;
-                                lexer.SetPos(save);
-                                {
-                                    soul::parser::Match match(true);
-                                    for (int32_t i : s55)
-                                    {
-                                        if (*lexer == i)
-                                        {
-                                            ++lexer;
-                                        }
-                                        else
-                                        {
-                                            match.hit = false;
-                                            break;
-                                        }
-                                    }
-                                    *parentMatch6 = match;
-                                }
-                                *parentMatch5 = match;
-                            }
-                        }
-                        *parentMatch4 = match;
-                        if (!match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch7 = &match;
-                            lexer.SetPos(save);
-                            {
-                                soul::parser::Match match(true);
-                                for (int32_t i : s56)
-                                {
-                                    if (*lexer == i)
-                                    {
-                                        ++lexer;
-                                    }
-                                    else
-                                    {
-                                        match.hit = false;
-                                        break;
-                                    }
-                                }
-                                *parentMatch7 = match;
-                            }
-                            *parentMatch4 = match;
-                        }
-                    }
-                    *parentMatch3 = match;
-                    if (!match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch8 = &match;
-                        lexer.SetPos(save);
-                        {
-                            soul::parser::Match match(true);
-                            for (int32_t i : s57)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            *parentMatch8 = match;
-                        }
-                        *parentMatch3 = match;
-                    }
-                }
-                *parentMatch2 = match;
-                if (!match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch9 = &match;
-                    lexer.SetPos(save);
-                    {
-                        soul::parser::Match match(true);
-                        for (int32_t i : s58)
-                        {
-                            if (*lexer == i)
-                            {
-                                ++lexer;
-                            }
-                            else
-                            {
-                                match.hit = false;
-                                break;
-                            }
-                        }
-                        *parentMatch9 = match;
-                    }
-                    *parentMatch2 = match;
-                }
-            }
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch10 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match(true);
-                    for (int32_t i : s59)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    *parentMatch10 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch11 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(true);
-                for (int32_t i : s60)
-                {
-                    if (*lexer == i)
-                    {
-                        ++lexer;
-                    }
-                    else
-                    {
-                        match.hit = false;
-                        break;
-                    }
-                }
-                *parentMatch11 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "TokenizedType");
-        else soul::lexer::WriteFailureToLog(lexer, "TokenizedType");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EnumeratedType(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EnumeratedType");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953213);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match = XmlParser<LexerT>::NotationType(lexer);
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch1 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::Enumeration(lexer);
-                *parentMatch1 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EnumeratedType");
-        else soul::lexer::WriteFailureToLog(lexer, "EnumeratedType");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::NotationType(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "NotationType");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953214);
-    std::unique_ptr<soul::parser::Value<std::string>> f;
-    std::unique_ptr<soul::parser::Value<std::string>> n;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match(true);
-                                for (int32_t i : s61)
-                                {
-                                    if (*lexer == i)
-                                    {
-                                        ++lexer;
-                                    }
-                                    else
-                                    {
-                                        match.hit = false;
-                                        break;
-                                    }
-                                }
-                                *parentMatch6 = match;
-                            }
-                            if (match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch7 = &match;
-                                {
-                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                    *parentMatch7 = match;
-                                }
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch8 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                if (*lexer == 40)
-                                {
-                                    ++lexer;
-                                    match.hit = true;
-                                }
-                                *parentMatch8 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch9 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                if (match.hit)
-                                {
-                                    *parentMatch10 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                }
-                            }
-                            *parentMatch9 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch11 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                        f.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                        *parentMatch11 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch12 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch13 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch14 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch15 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch16 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch17 = &match;
-                                            {
-                                                soul::parser::Match match(true);
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match* parentMatch18 = &match;
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch18 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                }
-                                                *parentMatch17 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch19 = &match;
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    if (*lexer == 124)
-                                                    {
-                                                        ++lexer;
-                                                        match.hit = true;
-                                                    }
-                                                    *parentMatch19 = match;
-                                                }
-                                                *parentMatch17 = match;
-                                            }
-                                            *parentMatch16 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch20 = &match;
-                                            {
-                                                soul::parser::Match match(true);
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match* parentMatch21 = &match;
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch21 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                }
-                                                *parentMatch20 = match;
-                                            }
-                                            *parentMatch16 = match;
-                                        }
-                                        *parentMatch15 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch22 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                                            n.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                                            *parentMatch22 = match;
-                                        }
-                                        *parentMatch15 = match;
-                                    }
-                                    *parentMatch14 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch13 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch12 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch23 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch24 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch24 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch23 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch25 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 41)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch25 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NotationType");
-        else soul::lexer::WriteFailureToLog(lexer, "NotationType");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Enumeration(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Enumeration");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953215);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 40)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                if (match.hit)
-                                {
-                                    *parentMatch6 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                }
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch7 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::Nmtoken(lexer);
-                        *parentMatch7 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch8 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch9 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch10 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch11 = &match;
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch12 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch13 = &match;
-                                            {
-                                                soul::parser::Match match(true);
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match* parentMatch14 = &match;
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch14 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                }
-                                                *parentMatch13 = match;
-                                            }
-                                            if (match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch15 = &match;
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    if (*lexer == 124)
-                                                    {
-                                                        ++lexer;
-                                                        match.hit = true;
-                                                    }
-                                                    *parentMatch15 = match;
-                                                }
-                                                *parentMatch13 = match;
-                                            }
-                                            *parentMatch12 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch16 = &match;
-                                            {
-                                                soul::parser::Match match(true);
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match* parentMatch17 = &match;
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                                    if (match.hit)
-                                                    {
-                                                        *parentMatch17 = match;
-                                                    }
-                                                    else
-                                                    {
-                                                        lexer.SetPos(save);
-                                                    }
-                                                }
-                                                *parentMatch16 = match;
-                                            }
-                                            *parentMatch12 = match;
-                                        }
-                                        *parentMatch11 = match;
-                                    }
-                                    if (match.hit)
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch18 = &match;
-                                        {
-                                            soul::parser::Match match = XmlParser<LexerT>::Nmtoken(lexer);
-                                            *parentMatch18 = match;
-                                        }
-                                        *parentMatch11 = match;
-                                    }
-                                    *parentMatch10 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch9 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch8 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch19 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch20 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch20 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch19 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch21 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 41)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch21 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Enumeration");
-        else soul::lexer::WriteFailureToLog(lexer, "Enumeration");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::Nmtoken(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "Nmtoken");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953216);
-    std::unique_ptr<soul::parser::Value<char32_t>> nameChar;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match = XmlParser<LexerT>::NameChar(lexer);
-        nameChar.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(true);
-        soul::parser::Match* parentMatch1 = &match;
-        while (true)
-        {
-            int64_t save = lexer.GetPos();
-            {
-                soul::parser::Match match = XmlParser<LexerT>::NameChar(lexer);
-                nameChar.reset(static_cast<soul::parser::Value<char32_t>*>(match.value));
-                if (match.hit)
-                {
-                    *parentMatch1 = match;
-                }
-                else
-                {
-                    lexer.SetPos(save);
-                    break;
-                }
-            }
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Nmtoken");
-        else soul::lexer::WriteFailureToLog(lexer, "Nmtoken");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::DefaultDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "DefaultDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953217);
-    std::unique_ptr<soul::parser::Value<std::string>> attValue;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            int64_t save = lexer.GetPos();
-            soul::parser::Match match(true);
-            for (int32_t i : s62)
-            {
-                if (*lexer == i)
-                {
-                    ++lexer;
-                }
-                else
-                {
-                    match.hit = false;
-                    break;
-                }
-            }
-            *parentMatch1 = match;
-            if (!match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch2 = &match;
-                lexer.SetPos(save);
-                {
-                    soul::parser::Match match(true);
-                    for (int32_t i : s63)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    *parentMatch2 = match;
-                }
-                *parentMatch1 = match;
-            }
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch3 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch4 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch5 = &match;
-                    {
-                        soul::parser::Match match(true);
-                        int64_t save = lexer.GetPos();
-                        soul::parser::Match* parentMatch6 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch7 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch8 = &match;
-                                {
-                                    soul::parser::Match match(true);
-                                    for (int32_t i : s64)
-                                    {
-                                        if (*lexer == i)
-                                        {
-                                            ++lexer;
-                                        }
-                                        else
-                                        {
-                                            match.hit = false;
-                                            break;
-                                        }
-                                    }
-                                    *parentMatch8 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch9 = &match;
-                                    {
-                                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                        *parentMatch9 = match;
-                                    }
-                                    *parentMatch8 = match;
-                                }
-                                *parentMatch7 = match;
-                            }
-                            if (match.hit)
-                            {
-                                *parentMatch6 = match;
-                            }
-                            else
-                            {
-                                lexer.SetPos(save);
-                            }
-                        }
-                        *parentMatch5 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch10 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::AttValue(lexer, processor);
-                            attValue.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                            *parentMatch10 = match;
-                        }
-                        *parentMatch5 = match;
-                    }
-                    *parentMatch4 = match;
-                }
-                *parentMatch3 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "DefaultDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "DefaultDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EntityDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EntityDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953218);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match = XmlParser<LexerT>::GEDecl(lexer, processor);
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch1 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::PEDecl(lexer, processor);
-                *parentMatch1 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EntityDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "EntityDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::GEDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "GEDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953219);
-    std::unique_ptr<soul::parser::Value<std::string>> entityName;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            for (int32_t i : s65)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            *parentMatch5 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch7 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                            entityName.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                            *parentMatch7 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        *parentMatch8 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch9 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::EntityDef(lexer, processor);
-                    *parentMatch9 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch10 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch11 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch11 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch10 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch12 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 62)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch12 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "GEDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "GEDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EntityDef(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EntityDef");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953220);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match = XmlParser<LexerT>::EntityValue(lexer, processor);
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch1 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch2 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch3 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::ExternalID(lexer);
-                        *parentMatch3 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch4 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match* parentMatch5 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::NDataDecl(lexer);
-                                if (match.hit)
-                                {
-                                    *parentMatch5 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                }
-                            }
-                            *parentMatch4 = match;
-                        }
-                        *parentMatch3 = match;
-                    }
-                    *parentMatch2 = match;
-                }
-                *parentMatch1 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EntityDef");
-        else soul::lexer::WriteFailureToLog(lexer, "EntityDef");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::EntityValue(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "EntityValue");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953221);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                if (*lexer == 34)
-                {
-                    ++lexer;
-                    match.hit = true;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(true);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        while (true)
-                        {
-                            int64_t save = lexer.GetPos();
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch5 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch6 = &match;
-                                    {
-                                        int64_t save = lexer.GetPos();
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch7 = &match;
-                                        {
-                                            int64_t save = lexer.GetPos();
-                                            soul::parser::Match match(lexer.Pos() != lexer.End());
-                                            for (const soul::ast::spg::Range& range : s66)
-                                            {
-                                                if (*lexer >= range.first && *lexer <= range.last)
-                                                {
-                                                    match.hit = false;
-                                                    break;
-                                                }
-                                            }
-                                            if (match.hit)
-                                            {
-                                                ++lexer;
-                                            }
-                                            *parentMatch7 = match;
-                                            if (!match.hit)
-                                            {
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch8 = &match;
-                                                lexer.SetPos(save);
-                                                {
-                                                    soul::parser::Match match = XmlParser<LexerT>::PEReference(lexer, processor);
-                                                    *parentMatch8 = match;
-                                                }
-                                                *parentMatch7 = match;
-                                            }
-                                        }
-                                        *parentMatch6 = match;
-                                        if (!match.hit)
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch9 = &match;
-                                            lexer.SetPos(save);
-                                            {
-                                                soul::parser::Match match = XmlParser<LexerT>::Reference(lexer, processor);
-                                                *parentMatch9 = match;
-                                            }
-                                            *parentMatch6 = match;
-                                        }
-                                    }
-                                    *parentMatch5 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    *parentMatch4 = match;
-                                }
-                                else
-                                {
-                                    lexer.SetPos(save);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch10 = &match;
-            {
-                soul::parser::Match match(false);
-                if (*lexer == 34)
-                {
-                    ++lexer;
-                    match.hit = true;
-                }
-                *parentMatch10 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch11 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch12 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch13 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 39)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch13 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch14 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            soul::parser::Match* parentMatch15 = &match;
-                            {
-                                while (true)
-                                {
-                                    int64_t save = lexer.GetPos();
-                                    {
-                                        soul::parser::Match match(false);
-                                        soul::parser::Match* parentMatch16 = &match;
-                                        {
-                                            soul::parser::Match match(false);
-                                            soul::parser::Match* parentMatch17 = &match;
-                                            {
-                                                int64_t save = lexer.GetPos();
-                                                soul::parser::Match match(false);
-                                                soul::parser::Match* parentMatch18 = &match;
-                                                {
-                                                    int64_t save = lexer.GetPos();
-                                                    soul::parser::Match match(lexer.Pos() != lexer.End());
-                                                    for (const soul::ast::spg::Range& range : s67)
-                                                    {
-                                                        if (*lexer >= range.first && *lexer <= range.last)
-                                                        {
-                                                            match.hit = false;
-                                                            break;
-                                                        }
-                                                    }
-                                                    if (match.hit)
-                                                    {
-                                                        ++lexer;
-                                                    }
-                                                    *parentMatch18 = match;
-                                                    if (!match.hit)
-                                                    {
-                                                        soul::parser::Match match(false);
-                                                        soul::parser::Match* parentMatch19 = &match;
-                                                        lexer.SetPos(save);
-                                                        {
-                                                            soul::parser::Match match = XmlParser<LexerT>::PEReference(lexer, processor);
-                                                            *parentMatch19 = match;
-                                                        }
-                                                        *parentMatch18 = match;
-                                                    }
-                                                }
-                                                *parentMatch17 = match;
-                                                if (!match.hit)
-                                                {
-                                                    soul::parser::Match match(false);
-                                                    soul::parser::Match* parentMatch20 = &match;
-                                                    lexer.SetPos(save);
-                                                    {
-                                                        soul::parser::Match match = XmlParser<LexerT>::Reference(lexer, processor);
-                                                        *parentMatch20 = match;
-                                                    }
-                                                    *parentMatch17 = match;
-                                                }
-                                            }
-                                            *parentMatch16 = match;
-                                        }
-                                        if (match.hit)
-                                        {
-                                            *parentMatch15 = match;
-                                        }
-                                        else
-                                        {
-                                            lexer.SetPos(save);
-                                            break;
-                                        }
-                                    }
-                                }
-                            }
-                            *parentMatch14 = match;
-                        }
-                        *parentMatch13 = match;
-                    }
-                    *parentMatch12 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch21 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        if (*lexer == 39)
-                        {
-                            ++lexer;
-                            match.hit = true;
-                        }
-                        *parentMatch21 = match;
-                    }
-                    *parentMatch12 = match;
-                }
-                *parentMatch11 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EntityValue");
-        else soul::lexer::WriteFailureToLog(lexer, "EntityValue");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::PEReference(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "PEReference");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953222);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 37)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch3 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 59)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch3 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PEReference");
-        else soul::lexer::WriteFailureToLog(lexer, "PEReference");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::PEDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "PEDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953223);
-    std::unique_ptr<soul::parser::Value<std::string>> peName;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch7 = &match;
-                                {
-                                    soul::parser::Match match(true);
-                                    for (int32_t i : s68)
-                                    {
-                                        if (*lexer == i)
-                                        {
-                                            ++lexer;
-                                        }
-                                        else
-                                        {
-                                            match.hit = false;
-                                            break;
-                                        }
-                                    }
-                                    *parentMatch7 = match;
-                                }
-                                if (match.hit)
-                                {
-                                    soul::parser::Match match(false);
-                                    soul::parser::Match* parentMatch8 = &match;
-                                    {
-                                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                        *parentMatch8 = match;
-                                    }
-                                    *parentMatch7 = match;
-                                }
-                                *parentMatch6 = match;
-                            }
-                            if (match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch9 = &match;
-                                {
-                                    soul::parser::Match match(false);
-                                    if (*lexer == 37)
-                                    {
-                                        ++lexer;
-                                        match.hit = true;
-                                    }
-                                    *parentMatch9 = match;
-                                }
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch10 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                *parentMatch10 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch11 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                            peName.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                            *parentMatch11 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch12 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        *parentMatch12 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch13 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::PEDef(lexer, processor);
-                    *parentMatch13 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch14 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch15 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch15 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch14 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch16 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 62)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch16 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PEDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "PEDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::PEDef(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "PEDef");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953224);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match = XmlParser<LexerT>::EntityValue(lexer, processor);
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch1 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::ExternalID(lexer);
-                *parentMatch1 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PEDef");
-        else soul::lexer::WriteFailureToLog(lexer, "PEDef");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::NDataDecl(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "NDataDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953225);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(true);
-                    for (int32_t i : s69)
-                    {
-                        if (*lexer == i)
-                        {
-                            ++lexer;
-                        }
-                        else
-                        {
-                            match.hit = false;
-                            break;
-                        }
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch4 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                *parentMatch4 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch5 = &match;
-        {
-            soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-            name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-            *parentMatch5 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NDataDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "NDataDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::NotationDecl(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "NotationDecl");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953226);
-    std::unique_ptr<soul::parser::Value<std::string>> name;
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch3 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch4 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch5 = &match;
-                        {
-                            soul::parser::Match match(true);
-                            for (int32_t i : s70)
-                            {
-                                if (*lexer == i)
-                                {
-                                    ++lexer;
-                                }
-                                else
-                                {
-                                    match.hit = false;
-                                    break;
-                                }
-                            }
-                            *parentMatch5 = match;
-                        }
-                        if (match.hit)
-                        {
-                            soul::parser::Match match(false);
-                            soul::parser::Match* parentMatch6 = &match;
-                            {
-                                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                                *parentMatch6 = match;
-                            }
-                            *parentMatch5 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    if (match.hit)
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch7 = &match;
-                        {
-                            soul::parser::Match match = XmlParser<LexerT>::Name(lexer);
-                            name.reset(static_cast<soul::parser::Value<std::string>*>(match.value));
-                            *parentMatch7 = match;
-                        }
-                        *parentMatch4 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                if (match.hit)
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch8 = &match;
-                    {
-                        soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                        *parentMatch8 = match;
-                    }
-                    *parentMatch3 = match;
-                }
-                *parentMatch2 = match;
-            }
-            if (match.hit)
-            {
-                soul::parser::Match match(false);
-                soul::parser::Match* parentMatch9 = &match;
-                {
-                    soul::parser::Match match(false);
-                    soul::parser::Match* parentMatch10 = &match;
-                    {
-                        soul::parser::Match match(false);
-                        soul::parser::Match* parentMatch11 = &match;
-                        {
-                            int64_t save = lexer.GetPos();
-                            soul::parser::Match match = XmlParser<LexerT>::ExternalID(lexer);
-                            *parentMatch11 = match;
-                            if (!match.hit)
-                            {
-                                soul::parser::Match match(false);
-                                soul::parser::Match* parentMatch12 = &match;
-                                lexer.SetPos(save);
-                                {
-                                    soul::parser::Match match = XmlParser<LexerT>::PublicID(lexer);
-                                    *parentMatch12 = match;
-                                }
-                                *parentMatch11 = match;
-                            }
-                        }
-                        *parentMatch10 = match;
-                    }
-                    *parentMatch9 = match;
-                }
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch13 = &match;
-            {
-                soul::parser::Match match(true);
-                int64_t save = lexer.GetPos();
-                soul::parser::Match* parentMatch14 = &match;
-                {
-                    soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                    if (match.hit)
-                    {
-                        *parentMatch14 = match;
-                    }
-                    else
-                    {
-                        lexer.SetPos(save);
-                    }
-                }
-                *parentMatch13 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch15 = &match;
-        {
-            soul::parser::Match match(false);
-            if (*lexer == 62)
-            {
-                ++lexer;
-                match.hit = true;
-            }
-            *parentMatch15 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NotationDecl");
-        else soul::lexer::WriteFailureToLog(lexer, "NotationDecl");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::DeclSep(LexerT& lexer, soul::xml::processor::XmlProcessor* processor)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "DeclSep");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953227);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        int64_t save = lexer.GetPos();
-        soul::parser::Match match = XmlParser<LexerT>::PEReference(lexer, processor);
-        *parentMatch0 = match;
-        if (!match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch1 = &match;
-            lexer.SetPos(save);
-            {
-                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                *parentMatch1 = match;
-            }
-            *parentMatch0 = match;
-        }
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "DeclSep");
-        else soul::lexer::WriteFailureToLog(lexer, "DeclSep");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template<typename LexerT>
-soul::parser::Match XmlParser<LexerT>::PublicID(LexerT& lexer)
-{
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    int64_t parser_debug_match_pos = 0;
-    bool parser_debug_write_to_log = lexer.Log() != nullptr;
-    if (parser_debug_write_to_log)
-    {
-        parser_debug_match_pos = lexer.GetPos();
-        soul::lexer::WriteBeginRuleToLog(lexer, "PublicID");
-    }
-    #endif
-    soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 4556688588539953228);
-    soul::parser::Match match(false);
-    soul::parser::Match* parentMatch0 = &match;
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch1 = &match;
-        {
-            soul::parser::Match match(true);
-            for (int32_t i : s71)
-            {
-                if (*lexer == i)
-                {
-                    ++lexer;
-                }
-                else
-                {
-                    match.hit = false;
-                    break;
-                }
-            }
-            *parentMatch1 = match;
-        }
-        if (match.hit)
-        {
-            soul::parser::Match match(false);
-            soul::parser::Match* parentMatch2 = &match;
-            {
-                soul::parser::Match match = XmlParser<LexerT>::S(lexer);
-                *parentMatch2 = match;
-            }
-            *parentMatch1 = match;
-        }
-        *parentMatch0 = match;
-    }
-    if (match.hit)
-    {
-        soul::parser::Match match(false);
-        soul::parser::Match* parentMatch3 = &match;
-        {
-            soul::parser::Match match = XmlParser<LexerT>::PubidLiteral(lexer);
-            *parentMatch3 = match;
-        }
-        *parentMatch0 = match;
-    }
-    #ifdef SOUL_PARSER_DEBUG_SUPPORT
-    if (parser_debug_write_to_log)
-    {
-        if (match.hit) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PublicID");
-        else soul::lexer::WriteFailureToLog(lexer, "PublicID");
-    }
-    #endif
-    if (!match.hit)
-    {
-        match.value = nullptr;
-    }
-    return match;
-}
-
-template struct XmlParser<soul::lexer::Lexer<soul::lexer::trivial::TrivialLexer<char32_t>, char32_t>>;
-
-} // namespace soul::xml::document::parser
@@ -6,56 +6,66 @@
 module soul.xml.parser;
 
 import util;
-import soul.lexer.trivial;
-import soul.xml.parser.rules;
-import soul.xml.document.parser;
+import soul.xml.scanner;
 import soul.xml.processor;
 
 namespace soul::xml::parser {
 
 void ParseXmlFile(const std::string& xmlFileName, XmlContentHandler* contentHandler)
 {
-    std::string xmlContent = util::ReadFile(xmlFileName);
-    std::u32string fileContent = util::ToUtf32(xmlContent);
-    ParseXmlContent(fileContent, xmlFileName, contentHandler);
+    util::FileStream fileStream(xmlFileName, util::OpenMode::read | util::OpenMode::binary);
+    ParseXmlStream(fileStream, xmlFileName, contentHandler);
 }
 
 void ParseXmlFile(const std::string& xmlFileName, XmlContentHandler* contentHandler, soul::lexer::FileMap& fileMap)
 {
     std::string xmlContent = util::ReadFile(xmlFileName);
-    std::u32string fileContent = util::ToUtf32(xmlContent);
-    return ParseXmlContent(std::move(fileContent), xmlFileName, contentHandler, fileMap);
+    ParseXmlContent(xmlContent, xmlFileName, contentHandler, fileMap);
 }
 
 void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler)
 {
-    ParseXmlContent(util::ToUtf32(xmlContent), systemId, contentHandler);
+    soul::xml::scanner::XmlScanner scanner(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), systemId);
+    soul::xml::processor::XmlProcessor processor(contentHandler);
+    scanner.Scan(&processor);
 }
 
 void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler, soul::lexer::FileMap& fileMap)
 {
-    ParseXmlContent(std::move(util::ToUtf32(xmlContent)), systemId, contentHandler, fileMap);
+    soul::xml::scanner::XmlScanner scanner(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), systemId);
+    int32_t fileId = fileMap.MapFile(systemId);
+    scanner.SetFile(fileId);
+    soul::xml::processor::XmlProcessor processor(contentHandler);
+    scanner.Scan(&processor);
+    fileMap.AddFileContent(fileId, util::ToUtf32(xmlContent), scanner.GetLineStartIndeces());
 }
 
 void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler)
 {
-    auto lexer = soul::lexer::trivial::MakeLexer(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), systemId);
-    lexer.SetRuleNameMapPtr(soul::xml::parser::rules::GetRuleNameMapPtr());
-    soul::xml::processor::XmlProcessor processor(contentHandler);
-    using LexerType = decltype(lexer);
-    soul::xml::document::parser::XmlParser<LexerType>::Parse(lexer, &processor);
+    ParseXmlContent(util::ToUtf8(xmlContent), systemId, contentHandler);
 }
 
 void ParseXmlContent(std::u32string&& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler, soul::lexer::FileMap& fileMap)
 {
-    auto lexer = soul::lexer::trivial::MakeLexer(xmlContent.c_str(), xmlContent.c_str() + xmlContent.length(), systemId);
-    lexer.SetRuleNameMapPtr(soul::xml::parser::rules::GetRuleNameMapPtr());
+    std::string content = util::ToUtf8(xmlContent);
+    soul::xml::scanner::XmlScanner scanner(content.c_str(), content.c_str() + content.length(), systemId);
     int32_t fileId = fileMap.MapFile(systemId);
-    lexer.SetFile(fileId);
+    scanner.SetFile(fileId);
+    soul::xml::processor::XmlProcessor processor(contentHandler);
+    scanner.Scan(&processor);
+    fileMap.AddFileContent(fileId, std::move(xmlContent), scanner.GetLineStartIndeces());
+}
+
+void ParseXmlStream(util::Stream& stream, const std::string& systemId, XmlContentHandler* contentHandler)
+{
+    ParseXmlStream(stream, systemId, contentHandler, defaultXmlChunkSize);
+}
+
+void ParseXmlStream(util::Stream& stream, const std::string& systemId, XmlContentHandler* contentHandler, int64_t chunkSize)
+{
+    soul::xml::scanner::XmlScanner scanner(stream, systemId, chunkSize);
     soul::xml::processor::XmlProcessor processor(contentHandler);
-    using LexerType = decltype(lexer);
-    soul::xml::document::parser::XmlParser<LexerType>::Parse(lexer, &processor);
-    fileMap.AddFileContent(fileId, std::move(xmlContent), std::move(lexer.GetLineStartIndeces()));
+    scanner.Scan(&processor);
 }
 
 } // namespace soul::xml::parser
@@ -8,11 +8,15 @@ export module soul.xml.parser;
 import std.core;
 import soul.xml.content.handler;
 import soul.lexer.file.map;
+import util.stream;
 
 export namespace soul::xml::parser {
 
+const int64_t defaultXmlChunkSize = 65536;
+
 //  =============================================================================
 //  ParseXmlFile parses given UTF-8 encoded XML file using given content handler.
+//  The file is read in chunks (see ParseXmlStream).
 //  =============================================================================
 
 void ParseXmlFile(const std::string& xmlFileName, XmlContentHandler* contentHandler);
@@ -43,4 +47,15 @@ void ParseXmlContent(const std::u32string& xmlContent, const std::string& system
 
 void ParseXmlContent(std::u32string&& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler, soul::lexer::FileMap& fileMap);
 
+//  ================================================================================================
+//  ParseXmlStream parses UTF-8 encoded XML read from given stream using given content handler.
+//  The content is read in chunks of chunkSize bytes and only the unprocessed part of it is kept
+//  in memory, so memory use does not grow with the size of the content.
+//  The systemId parameter is used for error messages only.
+//  ================================================================================================
+
+void ParseXmlStream(util::Stream& stream, const std::string& systemId, XmlContentHandler* contentHandler);
+
+void ParseXmlStream(util::Stream& stream, const std::string& systemId, XmlContentHandler* contentHandler, int64_t chunkSize);
+
 } // namespace soul::xml::parser
@@ -1,9 +0,0 @@
-export module soul.xml.parser.rules;
-
-import std.core;
-
-export namespace soul::xml::parser::rules {
-
-std::map<int64_t, std::string>* GetRuleNameMapPtr();
-
-} // soul::xml::parser::rules
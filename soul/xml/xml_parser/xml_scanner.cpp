@@ -0,0 +1,1035 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module;
+#if (defined(_M_X64) && !defined(_M_ARM64EC)) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SOUL_XML_SCANNER_SSE2
+#endif
+
+module soul.xml.scanner;
+
+import util;
+
+namespace soul::xml::scanner {
+
+//  ============================================================================================
+//  FindRunEnd returns a pointer to the first byte in [p, e) that is one of given delimiters,
+//  a control character or the first byte of a non-ASCII character, or e if there is no such byte.
+//  With SSE2 the range is scanned 16 bytes at a time.
+//  ============================================================================================
+
+const char* FindRunEnd(const char* p, const char* e, char d1, char d2, char d3)
+{
+#ifdef SOUL_XML_SCANNER_SSE2
+    const __m128i v1 = _mm_set1_epi8(d1);
+    const __m128i v2 = _mm_set1_epi8(d2);
+    const __m128i v3 = _mm_set1_epi8(d3);
+    const __m128i sp = _mm_set1_epi8(' ');
+    while (e - p >= 16)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, v1), _mm_cmpeq_epi8(x, v2)), _mm_or_si128(_mm_cmpeq_epi8(x, v3), _mm_cmplt_epi8(x, sp)));
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(m) | _mm_movemask_epi8(x));
+        if (mask != 0)
+        {
+            return p + std::countr_zero(mask);
+        }
+        p += 16;
+    }
+#endif
+    while (p != e)
+    {
+        char c = *p;
+        if (c == d1 || c == d2 || c == d3 || static_cast<uint8_t>(c) < 0x20u || static_cast<uint8_t>(c) >= 0x80u)
+        {
+            return p;
+        }
+        ++p;
+    }
+    return e;
+}
+
+bool IsNameStartChar(char32_t c)
+{
+    if (c < 0x80)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':';
+    }
+    return (c >= 0xC0 && c <= 0xD6) || (c >= 0xD8 && c <= 0xF6) || (c >= 0xF8 && c <= 0x2FF) || (c >= 0x370 && c <= 0x37D) || (c >= 0x37F && c <= 0x1FFF) ||
+        (c >= 0x200C && c <= 0x200D) || (c >= 0x2070 && c <= 0x218F) || (c >= 0x2C00 && c <= 0x2FEF) || (c >= 0x3001 && c <= 0xD7FF) ||
+        (c >= 0xF900 && c <= 0xFDCF) || (c >= 0xFDF0 && c <= 0xFFFD) || (c >= 0x10000 && c <= 0xEFFFF);
+}
+
+bool IsNameChar(char32_t c)
+{
+    if (IsNameStartChar(c)) return true;
+    return c == '-' || c == '.' || (c >= '0' && c <= '9') || c == 0xB7 || (c >= 0x300 && c <= 0x36F) || (c >= 0x203F && c <= 0x2040);
+}
+
+bool IsXmlChar(char32_t c)
+{
+    return c == 0x9 || c == 0xA || c == 0xD || (c >= 0x20 && c <= 0xD7FF) || (c >= 0xE000 && c <= 0xFFFD) || (c >= 0x10000 && c <= 0x10FFFF);
+}
+
+XmlScanner::XmlScanner(const char* start_, const char* end_, const std::string& fileName_) :
+    start(start_), end(end_), pos(start_), offset(0), stream(nullptr), buffer(), chunkSize(0), eof(true), mark(-1), fileName(fileName_), file(-1), line(1),
+    lineStart(0), colPos(0), col(1), lineStarts(1, 0), firstLine(1), offsetCol(1)
+{
+}
+
+XmlScanner::XmlScanner(util::Stream& stream_, const std::string& fileName_, int64_t chunkSize_) :
+    start(nullptr), end(nullptr), pos(nullptr), offset(0), stream(&stream_), buffer(), chunkSize(chunkSize_), eof(false), mark(-1), fileName(fileName_), file(-1),
+    line(1), lineStart(0), colPos(0), col(1), lineStarts(1, 0), firstLine(1), offsetCol(1)
+{
+    if (chunkSize <= 0)
+    {
+        throw std::runtime_error("soul::xml::scanner::XmlScanner: chunk size must be positive");
+    }
+}
+
+void XmlScanner::Scan(soul::xml::processor::XmlProcessor* processor)
+{
+    if (Lookahead("\xEF\xBB\xBF", 3))
+    {
+        pos += 3;
+        lineStart = Offset(pos);
+        lineStarts.back() = lineStart;
+        colPos = lineStart;
+    }
+    processor->StartDocument(this, GetSourcePos(Offset(pos)));
+    ScanProlog(processor);
+    ScanElement(processor);
+    ScanMisc(processor);
+    if (!AtEnd())
+    {
+        ThrowExpected("end of file");
+    }
+    processor->EndDocument();
+}
+
+soul::ast::SourcePos XmlScanner::GetSourcePos(int64_t at)
+{
+    if (at >= lineStart)
+    {
+        return soul::ast::SourcePos(at, file, line, Column(at));
+    }
+    auto it = std::upper_bound(lineStarts.begin(), lineStarts.end(), at);
+    if (it != lineStarts.begin())
+    {
+        --it;
+    }
+    int atLine = firstLine + static_cast<int>(it - lineStarts.begin());
+    return soul::ast::SourcePos(at, file, atLine, ColumnOf(*it, at));
+}
+
+void XmlScanner::ScanProlog(soul::xml::processor::XmlProcessor* processor)
+{
+    if (Lookahead("<?xml ", 6) || Lookahead("<?xml\t", 6) || Lookahead("<?xml\r", 6) || Lookahead("<?xml\n", 6))
+    {
+        ScanXmlDecl(processor);
+    }
+    ScanMisc(processor);
+    if (Lookahead("<!DOCTYPE", 9))
+    {
+        ScanDocTypeDecl(processor);
+        ScanMisc(processor);
+    }
+}
+
+void XmlScanner::ScanXmlDecl(soul::xml::processor::XmlProcessor* processor)
+{
+    pos += 5;
+    SkipS();
+    Expect("version", 7, "'version'");
+    ScanEq();
+    int64_t valuePos = Offset(pos);
+    std::string xmlVersion = ScanQuoted();
+    if (xmlVersion.length() < 3 || xmlVersion[0] != '1' || xmlVersion[1] != '.' ||
+        std::find_if(xmlVersion.begin() + 2, xmlVersion.end(), [](char c) { return c < '0' || c > '9'; }) != xmlVersion.end())
+    {
+        ThrowError("invalid XML version number", valuePos);
+    }
+    processor->XmlVersion(xmlVersion);
+    bool s = SkipS();
+    if (s && Lookahead("encoding", 8))
+    {
+        pos += 8;
+        ScanEq();
+        valuePos = Offset(pos);
+        std::string xmlEncoding = ScanQuoted();
+        bool valid = !xmlEncoding.empty() && ((xmlEncoding[0] >= 'a' && xmlEncoding[0] <= 'z') || (xmlEncoding[0] >= 'A' && xmlEncoding[0] <= 'Z'));
+        for (char c : xmlEncoding)
+        {
+            if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.' || c == '_' || c == '-'))
+            {
+                valid = false;
+            }
+        }
+        if (!valid)
+        {
+            ThrowError("invalid encoding name", valuePos);
+        }
+        processor->XmlEncoding(xmlEncoding);
+        s = SkipS();
+    }
+    if (s && Lookahead("standalone", 10))
+    {
+        pos += 10;
+        ScanEq();
+        valuePos = Offset(pos);
+        std::string yesNo = ScanQuoted();
+        if (yesNo == "yes")
+        {
+            processor->Standalone(true);
+        }
+        else if (yesNo == "no")
+        {
+            processor->Standalone(false);
+        }
+        else
+        {
+            ThrowError("'yes' or 'no' expected", valuePos);
+        }
+        SkipS();
+    }
+    Expect("?>", 2, "'?>'");
+}
+
+void XmlScanner::ScanMisc(soul::xml::processor::XmlProcessor* processor)
+{
+    while (true)
+    {
+        SkipS();
+        if (Lookahead("<!--", 4))
+        {
+            ScanComment(processor);
+        }
+        else if (Lookahead("<?", 2))
+        {
+            ScanPI(processor);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+void XmlScanner::ScanDocTypeDecl(soul::xml::processor::XmlProcessor* processor)
+{
+    pos += 9;
+    if (!SkipS())
+    {
+        ThrowExpected("white space");
+    }
+    ScanName();
+    SkipS();
+    if (Lookahead("SYSTEM", 6))
+    {
+        pos += 6;
+        SkipS();
+        ScanQuoted();
+        SkipS();
+    }
+    else if (Lookahead("PUBLIC", 6))
+    {
+        pos += 6;
+        SkipS();
+        ScanQuoted();
+        SkipS();
+        ScanQuoted();
+        SkipS();
+    }
+    if (Lookahead("[", 1))
+    {
+        ++pos;
+        while (true)
+        {
+            SkipS();
+            if (AtEnd())
+            {
+                ThrowExpected("']'");
+            }
+            if (*pos == ']')
+            {
+                ++pos;
+                SkipS();
+                break;
+            }
+            if (Lookahead("<!--", 4))
+            {
+                ScanComment(processor);
+            }
+            else if (Lookahead("<?", 2))
+            {
+                ScanPI(processor);
+            }
+            else if (Lookahead("<!", 2))
+            {
+                SkipMarkupDecl();
+            }
+            else if (*pos == '%')
+            {
+                ++pos;
+                ScanName();
+                Expect(";", 1, "';'");
+            }
+            else
+            {
+                ThrowExpected("markup declaration");
+            }
+        }
+    }
+    Expect(">", 1, "'>'");
+}
+
+void XmlScanner::SkipMarkupDecl()
+{
+    pos += 2;
+    while (true)
+    {
+        if (AtEnd())
+        {
+            ThrowExpected("'>'");
+        }
+        char c = *pos;
+        if (c == '>')
+        {
+            ++pos;
+            break;
+        }
+        else if (c == '"' || c == '\'')
+        {
+            ScanQuoted();
+        }
+        else if (c == '\n')
+        {
+            ++pos;
+            NewLine();
+        }
+        else
+        {
+            DecodeChar();
+        }
+    }
+}
+
+void XmlScanner::ScanElement(soul::xml::processor::XmlProcessor* processor)
+{
+    if (!Lookahead("<", 1))
+    {
+        ThrowExpected("element");
+    }
+    int depth = 0;
+    if (ScanStartTag(processor))
+    {
+        ++depth;
+    }
+    while (depth > 0)
+    {
+        ScanCharData(processor);
+        if (AtEnd())
+        {
+            ThrowExpected("end tag");
+        }
+        if (*pos == '&')
+        {
+            ScanReference(processor);
+        }
+        else if (Lookahead("</", 2))
+        {
+            ScanEndTag(processor);
+            --depth;
+        }
+        else if (Lookahead("<!--", 4))
+        {
+            ScanComment(processor);
+        }
+        else if (Lookahead("<![CDATA[", 9))
+        {
+            ScanCDSect(processor);
+        }
+        else if (Lookahead("<?", 2))
+        {
+            ScanPI(processor);
+        }
+        else if (ScanStartTag(processor))
+        {
+            ++depth;
+        }
+    }
+}
+
+bool XmlScanner::ScanStartTag(soul::xml::processor::XmlProcessor* processor)
+{
+    ++pos;
+    soul::ast::SourcePos sourcePos = GetSourcePos(Offset(pos));
+    std::string tagName = ScanName();
+    processor->BeginStartTag(sourcePos, tagName);
+    while (true)
+    {
+        bool s = SkipS();
+        if (Lookahead("/>", 2))
+        {
+            pos += 2;
+            processor->EndStartTag();
+            processor->EndTag(sourcePos, tagName);
+            return false;
+        }
+        else if (Lookahead(">", 1))
+        {
+            ++pos;
+            processor->EndStartTag();
+            return true;
+        }
+        else if (!s)
+        {
+            ThrowExpected("'>'");
+        }
+        ScanAttribute(processor);
+    }
+}
+
+void XmlScanner::ScanEndTag(soul::xml::processor::XmlProcessor* processor)
+{
+    pos += 2;
+    soul::ast::SourcePos sourcePos = GetSourcePos(Offset(pos));
+    std::string tagName = ScanName();
+    SkipS();
+    Expect(">", 1, "'>'");
+    processor->EndTag(sourcePos, tagName);
+}
+
+void XmlScanner::ScanAttribute(soul::xml::processor::XmlProcessor* processor)
+{
+    soul::ast::SourcePos sourcePos = GetSourcePos(Offset(pos));
+    std::string attName = ScanName();
+    ScanEq();
+    std::string attValue = ScanAttValue(processor);
+    processor->AddAttribute(sourcePos, attName, attValue);
+}
+
+std::string XmlScanner::ScanAttValue(soul::xml::processor::XmlProcessor* processor)
+{
+    if (AtEnd() || (*pos != '"' && *pos != '\''))
+    {
+        ThrowExpected("attribute value");
+    }
+    char quote = *pos;
+    ++pos;
+    processor->BeginAttributeValue();
+    while (true)
+    {
+        if (AtEnd())
+        {
+            ThrowExpected(std::string("'") + quote + "'");
+        }
+        const char* runEnd = FindRunEnd(pos, end, quote, '<', '&');
+        if (runEnd != pos)
+        {
+            processor->AddAttValueText(pos, runEnd);
+            pos = runEnd;
+            continue;
+        }
+        char c = *pos;
+        if (c == quote)
+        {
+            ++pos;
+            break;
+        }
+        else if (c == '<')
+        {
+            ThrowError("'<' not allowed in attribute value", Offset(pos));
+        }
+        else if (c == '&')
+        {
+            ScanReference(processor);
+        }
+        else if (c == '\n')
+        {
+            ++pos;
+            NewLine();
+            processor->AddAttValueChar('\n');
+        }
+        else
+        {
+            int64_t p = Offset(pos);
+            char32_t x = DecodeChar();
+            if (!IsXmlChar(x))
+            {
+                ThrowError("invalid character", p);
+            }
+            processor->AddAttValueChar(x);
+        }
+    }
+    std::string attValue = processor->AttValue();
+    processor->EndAttributeValue();
+    return attValue;
+}
+
+void XmlScanner::ScanReference(soul::xml::processor::XmlProcessor* processor)
+{
+    soul::ast::SourcePos sourcePos = GetSourcePos(Offset(pos));
+    if (Lookahead("&#", 2))
+    {
+        pos += 2;
+        bool hex = false;
+        if (Lookahead("x", 1))
+        {
+            ++pos;
+            hex = true;
+        }
+        int64_t digitStart = Offset(pos);
+        int32_t codePoint = 0;
+        while (!AtEnd() && codePoint <= 0x10FFFF)
+        {
+            char c = *pos;
+            if (c >= '0' && c <= '9')
+            {
+                codePoint = (hex ? 16 : 10) * codePoint + (c - '0');
+            }
+            else if (hex && c >= 'a' && c <= 'f')
+            {
+                codePoint = 16 * codePoint + 10 + (c - 'a');
+            }
+            else if (hex && c >= 'A' && c <= 'F')
+            {
+                codePoint = 16 * codePoint + 10 + (c - 'A');
+            }
+            else
+            {
+                break;
+            }
+            ++pos;
+        }
+        if (Offset(pos) == digitStart)
+        {
+            ThrowExpected(hex ? "hexadecimal digit" : "decimal digit");
+        }
+        if (!IsXmlChar(static_cast<char32_t>(codePoint)))
+        {
+            ThrowError("invalid character reference", digitStart);
+        }
+        Expect(";", 1, "';'");
+        processor->CharRef(sourcePos, static_cast<char32_t>(codePoint));
+    }
+    else
+    {
+        ++pos;
+        std::string entityName = ScanName();
+        Expect(";", 1, "';'");
+        processor->EntityRef(sourcePos, entityName);
+    }
+}
+
+void XmlScanner::ScanCharData(soul::xml::processor::XmlProcessor* processor)
+{
+    if (AtEnd() || *pos == '<' || *pos == '&') return;
+    int64_t prevMark = mark;
+    mark = Offset(pos);
+    soul::ast::SourcePos sourcePos = GetSourcePos(mark);
+    while (!AtEnd())
+    {
+        pos = FindRunEnd(pos, end, '<', '&', ']');
+        if (pos == end)
+        {
+            continue;
+        }
+        char c = *pos;
+        if (c == '<' || c == '&')
+        {
+            break;
+        }
+        else if (c == '\n')
+        {
+            ++pos;
+            NewLine();
+        }
+        else if (c == ']')
+        {
+            if (Lookahead("]]>", 3))
+            {
+                ThrowError("']]>' not allowed in character data", Offset(pos));
+            }
+            ++pos;
+        }
+        else
+        {
+            int64_t p = Offset(pos);
+            if (!IsXmlChar(DecodeChar()))
+            {
+                ThrowError("invalid character", p);
+            }
+        }
+    }
+    std::string text(Ptr(mark), pos);
+    mark = prevMark;
+    processor->Text(sourcePos, text);
+}
+
+void XmlScanner::ScanComment(soul::xml::processor::XmlProcessor* processor)
+{
+    soul::ast::SourcePos sourcePos = GetSourcePos(Offset(pos));
+    pos += 4;
+    std::string comment;
+    ScanUntil("-->", 3, comment);
+    processor->Comment(sourcePos, comment);
+}
+
+void XmlScanner::ScanPI(soul::xml::processor::XmlProcessor* processor)
+{
+    soul::ast::SourcePos sourcePos = GetSourcePos(Offset(pos));
+    pos += 2;
+    int64_t targetPos = Offset(pos);
+    std::string target = ScanName();
+    if (target.length() == 3 && (target[0] == 'x' || target[0] == 'X') && (target[1] == 'm' || target[1] == 'M') && (target[2] == 'l' || target[2] == 'L'))
+    {
+        ThrowError("processing instruction target '" + target + "' is reserved", targetPos);
+    }
+    std::string data;
+    if (SkipS())
+    {
+        ScanUntil("?>", 2, data);
+    }
+    else
+    {
+        Expect("?>", 2, "'?>'");
+    }
+    processor->PI(sourcePos, target, data);
+}
+
+void XmlScanner::ScanCDSect(soul::xml::processor::XmlProcessor* processor)
+{
+    soul::ast::SourcePos sourcePos = GetSourcePos(Offset(pos));
+    pos += 9;
+    std::string cdata;
+    ScanUntil("]]>", 3, cdata);
+    processor->CDataSection(sourcePos, cdata);
+}
+
+std::string XmlScanner::ScanName()
+{
+    if (AtEnd())
+    {
+        ThrowExpected("name");
+    }
+    int64_t prevMark = mark;
+    mark = Offset(pos);
+    if (static_cast<uint8_t>(*pos) < 0x80u)
+    {
+        if (!IsNameStartChar(static_cast<char32_t>(*pos)))
+        {
+            ThrowExpected("name");
+        }
+        ++pos;
+    }
+    else if (!IsNameStartChar(DecodeChar()))
+    {
+        pos = Ptr(mark);
+        ThrowExpected("name");
+    }
+    while (!AtEnd())
+    {
+        int64_t p = Offset(pos);
+        if (static_cast<uint8_t>(*pos) < 0x80u)
+        {
+            if (!IsNameChar(static_cast<char32_t>(*pos)))
+            {
+                break;
+            }
+            ++pos;
+        }
+        else if (!IsNameChar(DecodeChar()))
+        {
+            pos = Ptr(p);
+            break;
+        }
+    }
+    std::string name(Ptr(mark), pos);
+    mark = prevMark;
+    return name;
+}
+
+std::string XmlScanner::ScanQuoted()
+{
+    if (AtEnd() || (*pos != '"' && *pos != '\''))
+    {
+        ThrowExpected("quoted literal");
+    }
+    char quote = *pos;
+    ++pos;
+    int64_t prevMark = mark;
+    mark = Offset(pos);
+    while (true)
+    {
+        if (AtEnd())
+        {
+            ThrowExpected(std::string("'") + quote + "'");
+        }
+        char c = *pos;
+        if (c == quote)
+        {
+            break;
+        }
+        else if (c == '\n')
+        {
+            ++pos;
+            NewLine();
+        }
+        else
+        {
+            DecodeChar();
+        }
+    }
+    std::string value(Ptr(mark), pos);
+    mark = prevMark;
+    ++pos;
+    return value;
+}
+
+void XmlScanner::ScanEq()
+{
+    SkipS();
+    Expect("=", 1, "'='");
+    SkipS();
+}
+
+bool XmlScanner::SkipS()
+{
+    bool skipped = false;
+    while (!AtEnd())
+    {
+        char c = *pos;
+        if (c == '\n')
+        {
+            ++pos;
+            NewLine();
+        }
+        else if (c == ' ' || c == '\t' || c == '\r')
+        {
+            ++pos;
+        }
+        else
+        {
+            break;
+        }
+        skipped = true;
+    }
+    return skipped;
+}
+
+void XmlScanner::ScanUntil(const char* terminator, int terminatorLength, std::string& content)
+{
+    int64_t prevMark = mark;
+    mark = Offset(pos);
+    while (true)
+    {
+        if (AtEnd())
+        {
+            ThrowExpected("'" + std::string(terminator, terminatorLength) + "'");
+        }
+        char c = *pos;
+        if (c == terminator[0] && Lookahead(terminator, terminatorLength))
+        {
+            break;
+        }
+        else if (c == '\n')
+        {
+            ++pos;
+            NewLine();
+        }
+        else
+        {
+            int64_t p = Offset(pos);
+            if (!IsXmlChar(DecodeChar()))
+            {
+                ThrowError("invalid character", p);
+            }
+        }
+    }
+    content.assign(Ptr(mark), pos);
+    mark = prevMark;
+    pos += terminatorLength;
+}
+
+bool XmlScanner::AtEnd()
+{
+    return pos == end && !Fill(1);
+}
+
+bool XmlScanner::Lookahead(const char* s, int n)
+{
+    return (end - pos >= n || Fill(n)) && std::char_traits<char>::compare(pos, s, n) == 0;
+}
+
+void XmlScanner::Expect(const char* s, int n, const std::string& name)
+{
+    if (!Lookahead(s, n))
+    {
+        ThrowExpected(name);
+    }
+    pos += n;
+}
+
+char32_t XmlScanner::DecodeChar()
+{
+    uint8_t x = static_cast<uint8_t>(*pos);
+    if (x < 0x80u)
+    {
+        ++pos;
+        return static_cast<char32_t>(x);
+    }
+    int n = 0;
+    uint32_t c = 0;
+    uint32_t min = 0;
+    if ((x & 0xE0u) == 0xC0u)
+    {
+        n = 1;
+        c = x & 0x1Fu;
+        min = 0x80u;
+    }
+    else if ((x & 0xF0u) == 0xE0u)
+    {
+        n = 2;
+        c = x & 0x0Fu;
+        min = 0x800u;
+    }
+    else if ((x & 0xF8u) == 0xF0u)
+    {
+        n = 3;
+        c = x & 0x07u;
+        min = 0x10000u;
+    }
+    else
+    {
+        ThrowError("invalid UTF-8 sequence", Offset(pos));
+    }
+    if (end - pos <= n && !Fill(n + 1))
+    {
+        ThrowError("invalid UTF-8 sequence", Offset(pos));
+    }
+    for (int i = 1; i <= n; ++i)
+    {
+        uint8_t b = static_cast<uint8_t>(pos[i]);
+        if ((b & 0xC0u) != 0x80u)
+        {
+            ThrowError("invalid UTF-8 sequence", Offset(pos));
+        }
+        c = (c << 6) | (b & 0x3Fu);
+    }
+    if (c < min || c > 0x10FFFFu || (c >= 0xD800u && c <= 0xDFFFu))
+    {
+        ThrowError("invalid UTF-8 sequence", Offset(pos));
+    }
+    pos += n + 1;
+    return static_cast<char32_t>(c);
+}
+
+bool XmlScanner::Fill(int64_t n)
+{
+    while (end - pos < n)
+    {
+        if (eof)
+        {
+            return false;
+        }
+        Compact();
+        int64_t size = end - start;
+        if (static_cast<int64_t>(buffer.size()) < size + chunkSize)
+        {
+            buffer.resize(size + chunkSize);
+        }
+        int64_t posIndex = pos - start;
+        int64_t count = stream->Read(reinterpret_cast<uint8_t*>(buffer.data() + size), chunkSize);
+        if (count <= 0)
+        {
+            eof = true;
+            count = 0;
+        }
+        start = buffer.data();
+        end = start + size + count;
+        pos = start + posIndex;
+    }
+    return true;
+}
+
+void XmlScanner::Compact()
+{
+    int64_t keepFrom = Offset(pos);
+    if (mark != -1)
+    {
+        keepFrom = std::min(keepFrom, mark);
+    }
+    if (Offset(pos) - lineStart <= chunkSize)
+    {
+        keepFrom = std::min(keepFrom, lineStart);
+    }
+    if (colPos < keepFrom)
+    {
+        Column(keepFrom);
+    }
+    int64_t discardLines = std::upper_bound(lineStarts.begin(), lineStarts.end(), keepFrom) - lineStarts.begin() - 1;
+    if (keepFrom > offset)
+    {
+        offsetCol = ColumnOf(lineStarts[discardLines], keepFrom);
+    }
+    if (discardLines > 0)
+    {
+        lineStarts.erase(lineStarts.begin(), lineStarts.begin() + discardLines);
+        firstLine += static_cast<int>(discardLines);
+    }
+    int64_t discard = keepFrom - offset;
+    if (discard > 0)
+    {
+        int64_t posIndex = pos - start;
+        int64_t size = end - start;
+        std::char_traits<char>::move(buffer.data(), buffer.data() + discard, size - discard);
+        offset += discard;
+        start = buffer.data();
+        end = start + size - discard;
+        pos = start + posIndex - discard;
+    }
+}
+
+void XmlScanner::NewLine()
+{
+    ++line;
+    lineStart = Offset(pos);
+    lineStarts.push_back(lineStart);
+    colPos = lineStart;
+    col = 1;
+}
+
+int XmlScanner::Column(int64_t at)
+{
+    if (colPos > at || colPos < lineStart)
+    {
+        if (lineStart < offset)
+        {
+            colPos = offset;
+            col = offsetCol;
+        }
+        else
+        {
+            colPos = lineStart;
+            col = 1;
+        }
+    }
+    const char* p = Ptr(colPos);
+    const char* e = Ptr(at);
+    while (p < e)
+    {
+        if ((static_cast<uint8_t>(*p) & 0xC0u) != 0x80u)
+        {
+            ++col;
+        }
+        ++p;
+    }
+    colPos = at;
+    return col;
+}
+
+int XmlScanner::ColumnOf(int64_t atLineStart, int64_t at) const
+{
+    int64_t from = atLineStart;
+    int c = 1;
+    if (atLineStart < offset)
+    {
+        from = offset;
+        c = offsetCol;
+    }
+    const char* p = Ptr(from);
+    const char* e = Ptr(at);
+    while (p < e)
+    {
+        if ((static_cast<uint8_t>(*p) & 0xC0u) != 0x80u)
+        {
+            ++c;
+        }
+        ++p;
+    }
+    return c;
+}
+
+void XmlScanner::ThrowExpected(const std::string& name)
+{
+    soul::ast::SourcePos sourcePos = GetSourcePos(Offset(pos));
+    throw soul::lexer::ParsingException("parsing error at '" + fileName + ":" + std::to_string(sourcePos.line) + "': " + name + " expected:\n" +
+        ErrorLines(sourcePos), fileName, sourcePos);
+}
+
+void XmlScanner::ThrowError(const std::string& message, int64_t at)
+{
+    soul::ast::SourcePos sourcePos = GetSourcePos(at);
+    throw soul::lexer::ParsingException("parsing error at '" + fileName + ":" + std::to_string(sourcePos.line) + "': " + message + ":\n" +
+        ErrorLines(sourcePos), fileName, sourcePos);
+}
+
+std::string XmlScanner::ErrorLines(const soul::ast::SourcePos& sourcePos) const
+{
+    if (sourcePos.pos < offset)
+    {
+        return "(line " + std::to_string(sourcePos.line) + " column " + std::to_string(sourcePos.col) + " is no longer in the input buffer)";
+    }
+    const char* p = Ptr(std::min(sourcePos.pos, Offset(end)));
+    const char* ls = p;
+    while (ls != start && ls[-1] != '\n' && ls[-1] != '\r')
+    {
+        --ls;
+    }
+    const char* le = p;
+    while (le != end && *le != '\n' && *le != '\r')
+    {
+        ++le;
+    }
+    std::string lines;
+    int n = 0;
+    if (ls == start && lineStarts.front() < offset && sourcePos.line == firstLine)
+    {
+        lines.append("...");
+        n = 3;
+    }
+    lines.append(ls, le);
+    lines.append(1, '\n');
+    for (const char* q = ls; q != p; ++q)
+    {
+        if ((static_cast<uint8_t>(*q) & 0xC0u) != 0x80u)
+        {
+            ++n;
+        }
+    }
+    lines.append(n, ' ');
+    lines.append(1, '^');
+    return lines;
+}
+
+std::vector<int> XmlScanner::GetLineStartIndeces() const
+{
+    if (stream)
+    {
+        throw std::runtime_error("soul::xml::scanner::XmlScanner: line start indeces are not available when scanning a stream");
+    }
+    std::vector<int> lineStartIndeces;
+    lineStartIndeces.push_back(0);
+    int index = 0;
+    bool startOfLine = true;
+    for (const char* p = start; p != end; ++p)
+    {
+        if ((static_cast<uint8_t>(*p) & 0xC0u) != 0x80u)
+        {
+            if (startOfLine)
+            {
+                lineStartIndeces.push_back(index);
+            }
+            startOfLine = *p == '\n';
+            ++index;
+        }
+    }
+    lineStartIndeces.push_back(index);
+    return lineStartIndeces;
+}
+
+} // namespace soul::xml::scanner
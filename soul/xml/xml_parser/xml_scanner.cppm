@@ -0,0 +1,102 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.xml.scanner;
+
+import std.core;
+import soul.ast.source.pos;
+import soul.lexer;
+import soul.xml.processor;
+import util.stream;
+
+export namespace soul::xml::scanner {
+
+//  ===================================================================================================
+//  XmlScanner is a byte-level scanner for UTF-8 encoded XML content.
+//  It scans tags, attributes, character data, CDATA sections, comments and processing instructions
+//  in a single pass and reports them to an XmlProcessor.
+//  It does not convert the content to UTF-32 nor build a token vector.
+//
+//  XmlScanner implements the XmlLexer interface so that content handlers can use FileName() and
+//  ErrorLines() for error messages. The pos member of source positions is a byte offset to the content.
+//
+//  When constructed with a stream, XmlScanner reads the content in chunks of given size and keeps
+//  only the unprocessed part of the content in memory: the current line and the token being scanned.
+//  The line and column of a source position are computed when it is made, so they stay correct after 
+//  the line has been discarded; ErrorLines() then reports the line and column without the source text.
+//  ===================================================================================================
+
+class XmlScanner : public soul::xml::XmlLexer
+{
+public:
+    XmlScanner(const char* start_, const char* end_, const std::string& fileName_);
+    XmlScanner(util::Stream& stream_, const std::string& fileName_, int64_t chunkSize_);
+    void Scan(soul::xml::processor::XmlProcessor* processor);
+    int File() const { return file; }
+    void SetFile(int file_) { file = file_; }
+    int Line() const { return line; }
+    soul::ast::SourcePos GetSourcePos(int64_t at);
+    const std::string& FileName() const override { return fileName; }
+    std::string ErrorLines(const soul::ast::SourcePos& sourcePos) const override;
+    std::vector<int> GetLineStartIndeces() const;
+private:
+    void ScanProlog(soul::xml::processor::XmlProcessor* processor);
+    void ScanXmlDecl(soul::xml::processor::XmlProcessor* processor);
+    void ScanMisc(soul::xml::processor::XmlProcessor* processor);
+    void ScanDocTypeDecl(soul::xml::processor::XmlProcessor* processor);
+    void ScanElement(soul::xml::processor::XmlProcessor* processor);
+    bool ScanStartTag(soul::xml::processor::XmlProcessor* processor);
+    void ScanEndTag(soul::xml::processor::XmlProcessor* processor);
+    void ScanAttribute(soul::xml::processor::XmlProcessor* processor);
+    std::string ScanAttValue(soul::xml::processor::XmlProcessor* processor);
+    void ScanReference(soul::xml::processor::XmlProcessor* processor);
+    void ScanCharData(soul::xml::processor::XmlProcessor* processor);
+    void ScanComment(soul::xml::processor::XmlProcessor* processor);
+    void ScanPI(soul::xml::processor::XmlProcessor* processor);
+    void ScanCDSect(soul::xml::processor::XmlProcessor* processor);
+    std::string ScanName();
+    std::string ScanQuoted();
+    void ScanEq();
+    bool SkipS();
+    void SkipMarkupDecl();
+    void ScanUntil(const char* terminator, int terminatorLength, std::string& content);
+    bool AtEnd();
+    bool Lookahead(const char* s, int n);
+    void Expect(const char* s, int n, const std::string& name);
+    char32_t DecodeChar();
+    bool Fill(int64_t n);
+    void Compact();
+    int64_t Offset(const char* p) const { return offset + (p - start); }
+    const char* Ptr(int64_t at) const { return start + (at - offset); }
+    void NewLine();
+    int Column(int64_t at);
+    int ColumnOf(int64_t atLineStart, int64_t at) const;
+    [[noreturn]] void ThrowExpected(const std::string& name);
+    [[noreturn]] void ThrowError(const std::string& message, int64_t at);
+    const char* start;
+    const char* end;
+    const char* pos;
+    int64_t offset;
+    util::Stream* stream;
+    std::string buffer;
+    int64_t chunkSize;
+    bool eof;
+    int64_t mark;
+    std::string fileName;
+    int file;
+    int line;
+    int64_t lineStart;
+    int64_t colPos;
+    int col;
+    std::vector<int64_t> lineStarts;
+    int firstLine;
+    int offsetCol;
+};
+
+bool IsNameStartChar(char32_t c);
+bool IsNameChar(char32_t c);
+bool IsXmlChar(char32_t c);
+
+} // namespace soul::xml::scanner
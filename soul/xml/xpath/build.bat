@@ -1,3 +1,4 @@
 @echo off
 slg -v lexer.slg
 spg -v parser.spg
+call check_profile_guards.bat
@@ -0,0 +1,10 @@
+@echo off
+rem Fails if a rule of the generated XPath parser has no RuleProfileGuard.
+rem spg does not emit the guards yet, so regenerating xpath.parser.cpp drops them.
+setlocal
+set parser=%~dp0xpath.parser.cpp
+for /f %%c in ('find /c "soul::lexer::RuleGuard<LexerT> ruleGuard" ^< "%parser%"') do set rules=%%c
+for /f %%c in ('find /c "soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard" ^< "%parser%"') do set guards=%%c
+if "%guards%"=="%rules%" if not "%guards%"=="0" exit /b 0
+echo error: xpath.parser.cpp has %rules% rules but %guards% RuleProfileGuard blocks; restore the SOUL_PARSER_PROFILING_SUPPORT blocks that spg does not emit
+exit /b 1
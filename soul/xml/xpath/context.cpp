@@ -7,8 +7,64 @@ module soul.xml.xpath.context;
 
 namespace soul::xml::xpath {
 
-Context::Context(soul::xml::Node* node_, int pos_, int size_) : node(node_), pos(pos_), size(size_)
+NodeSetPool::NodeSetPool()
 {
 }
 
+std::unique_ptr<NodeSet> NodeSetPool::GetNodeSet()
+{
+    if (nodeSets.empty())
+    {
+        return std::unique_ptr<NodeSet>(new NodeSet());
+    }
+    std::unique_ptr<NodeSet> nodeSet = std::move(nodeSets.back());
+    nodeSets.pop_back();
+    return nodeSet;
+}
+
+void NodeSetPool::Release(std::unique_ptr<NodeSet>&& nodeSet)
+{
+    if (nodeSet)
+    {
+        nodeSet->Clear();
+        nodeSets.push_back(std::move(nodeSet));
+    }
+}
+
+void NodeSetPool::Release(std::unique_ptr<Object>&& object)
+{
+    if (object && object->IsNodeSet())
+    {
+        Release(std::unique_ptr<NodeSet>(static_cast<NodeSet*>(object.release())));
+    }
+}
+
+Context::Context(soul::xml::Node* node_, int pos_, int size_) : node(node_), pos(pos_), size(size_), pool(nullptr)
+{
+}
+
+Context::Context(soul::xml::Node* node_, int pos_, int size_, NodeSetPool* pool_) : node(node_), pos(pos_), size(size_), pool(pool_)
+{
+}
+
+std::unique_ptr<NodeSet> Context::MakeNodeSet() const
+{
+    if (pool)
+    {
+        return pool->GetNodeSet();
+    }
+    else
+    {
+        return std::unique_ptr<NodeSet>(new NodeSet());
+    }
+}
+
+void Context::Release(std::unique_ptr<Object>&& object) const
+{
+    if (pool)
+    {
+        pool->Release(std::move(object));
+    }
+}
+
 } // namespace soul::xml::xpath
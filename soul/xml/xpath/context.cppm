@@ -7,20 +7,42 @@ export module soul.xml.xpath.context;
 
 import std.core;
 import soul.xml.node;
+import soul.xml.xpath.object;
 
 export namespace soul::xml::xpath {
 
+//  ===================================================================================================
+//  NodeSetPool keeps node-sets that are no longer needed so that their storage can be reused 
+//  by the next evaluation. A pool is not thread-safe: each thread should use its own pool.
+//  ===================================================================================================
+
+class NodeSetPool
+{
+public:
+    NodeSetPool();
+    std::unique_ptr<NodeSet> GetNodeSet();
+    void Release(std::unique_ptr<NodeSet>&& nodeSet);
+    void Release(std::unique_ptr<Object>&& object);
+private:
+    std::vector<std::unique_ptr<NodeSet>> nodeSets;
+};
+
 class Context
 {
 public:
     Context(soul::xml::Node* node_, int pos_, int size_);
+    Context(soul::xml::Node* node_, int pos_, int size_, NodeSetPool* pool_);
     soul::xml::Node* Node() const { return node; }
     int Pos() const { return pos; }
     int Size() const { return size; }
+    NodeSetPool* Pool() const { return pool; }
+    std::unique_ptr<NodeSet> MakeNodeSet() const;
+    void Release(std::unique_ptr<Object>&& object) const;
 private:
     soul::xml::Node* node;
     int pos;
     int size;
+    NodeSetPool* pool;
 };
 
 } // namespace soul::xml::xpath
@@ -27,6 +27,103 @@ std::unique_ptr<soul::xml::xpath::expr::Expr> ParseXPathExpr(const std::string&
     return expr;
 }
 
+class XPathExprCache
+{
+public:
+    static XPathExprCache& Instance();
+    std::shared_ptr<soul::xml::xpath::expr::Expr> GetExpr(const std::string& xpathExpr);
+    void SetCapacity(int capacity_);
+    void Clear();
+private:
+    struct Entry
+    {
+        std::shared_ptr<soul::xml::xpath::expr::Expr> expr;
+        std::list<std::string>::iterator lruPos;
+    };
+    XPathExprCache();
+    void Trim();
+    std::mutex mtx;
+    int capacity;
+    std::list<std::string> lruList;
+    std::unordered_map<std::string, Entry> exprMap;
+};
+
+XPathExprCache& XPathExprCache::Instance()
+{
+    static XPathExprCache instance;
+    return instance;
+}
+
+XPathExprCache::XPathExprCache() : capacity(defaultXPathExprCacheCapacity)
+{
+}
+
+std::shared_ptr<soul::xml::xpath::expr::Expr> XPathExprCache::GetExpr(const std::string& xpathExpr)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = exprMap.find(xpathExpr);
+        if (it != exprMap.end())
+        {
+            lruList.splice(lruList.begin(), lruList, it->second.lruPos);
+            return it->second.expr;
+        }
+    }
+    std::shared_ptr<soul::xml::xpath::expr::Expr> expr(ParseXPathExpr(xpathExpr));
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = exprMap.find(xpathExpr);
+    if (it != exprMap.end())
+    {
+        lruList.splice(lruList.begin(), lruList, it->second.lruPos);
+        return it->second.expr;
+    }
+    if (capacity > 0)
+    {
+        lruList.push_front(xpathExpr);
+        exprMap[xpathExpr] = Entry{ expr, lruList.begin() };
+        Trim();
+    }
+    return expr;
+}
+
+void XPathExprCache::SetCapacity(int capacity_)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    capacity = capacity_;
+    Trim();
+}
+
+void XPathExprCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    exprMap.clear();
+    lruList.clear();
+}
+
+void XPathExprCache::Trim()
+{
+    while (static_cast<int>(lruList.size()) > std::max(capacity, 0))
+    {
+        exprMap.erase(lruList.back());
+        lruList.pop_back();
+    }
+}
+
+std::shared_ptr<soul::xml::xpath::expr::Expr> GetCompiledXPathExpr(const std::string& xpathExpr)
+{
+    return XPathExprCache::Instance().GetExpr(xpathExpr);
+}
+
+void SetXPathExprCacheCapacity(int capacity)
+{
+    XPathExprCache::Instance().SetCapacity(capacity);
+}
+
+void ClearXPathExprCache()
+{
+    XPathExprCache::Instance().Clear();
+}
+
 std::unique_ptr<soul::xml::xpath::Object> Evaluate(soul::xml::xpath::expr::Expr* expr, soul::xml::Node* node)
 {
     Context context(node, 1, 1);
@@ -35,7 +132,7 @@ std::unique_ptr<soul::xml::xpath::Object> Evaluate(soul::xml::xpath::expr::Expr*
 
 std::unique_ptr<soul::xml::xpath::Object> Evaluate(const std::string& xpathExpr, soul::xml::Node* node)
 {
-    std::unique_ptr<soul::xml::xpath::expr::Expr> expr = ParseXPathExpr(xpathExpr);
+    std::shared_ptr<soul::xml::xpath::expr::Expr> expr = GetCompiledXPathExpr(xpathExpr);
     return Evaluate(expr.get(), node);
 }
 
@@ -54,10 +151,39 @@ std::unique_ptr<soul::xml::xpath::NodeSet> EvaluateToNodeSet(soul::xml::xpath::e
 
 std::unique_ptr<soul::xml::xpath::NodeSet> EvaluateToNodeSet(const std::string& xpathExpr, soul::xml::Node* node)
 {
-    std::unique_ptr<soul::xml::xpath::expr::Expr> expr = ParseXPathExpr(xpathExpr);
+    std::shared_ptr<soul::xml::xpath::expr::Expr> expr = GetCompiledXPathExpr(xpathExpr);
     return EvaluateToNodeSet(expr.get(), node);
 }
 
+XPathEvaluator::XPathEvaluator()
+{
+}
+
+std::unique_ptr<soul::xml::xpath::Object> XPathEvaluator::Evaluate(const std::string& xpathExpr, soul::xml::Node* node)
+{
+    std::shared_ptr<soul::xml::xpath::expr::Expr> expr = GetCompiledXPathExpr(xpathExpr);
+    Context context(node, 1, 1, &pool);
+    return expr->Evaluate(context);
+}
+
+std::unique_ptr<soul::xml::xpath::NodeSet> XPathEvaluator::EvaluateToNodeSet(const std::string& xpathExpr, soul::xml::Node* node)
+{
+    std::unique_ptr<soul::xml::xpath::Object> result = Evaluate(xpathExpr, node);
+    if (result->IsNodeSet())
+    {
+        return std::unique_ptr<soul::xml::xpath::NodeSet>(static_cast<soul::xml::xpath::NodeSet*>(result.release()));
+    }
+    else
+    {
+        throw std::runtime_error("node-set result expected");
+    }
+}
+
+void XPathEvaluator::Release(std::unique_ptr<soul::xml::xpath::NodeSet>&& nodeSet)
+{
+    pool.Release(std::move(nodeSet));
+}
+
 std::unique_ptr<soul::xml::Document> EvaluateToXMLInfoDocument(soul::xml::xpath::expr::Expr* expr, const std::string& parsingError,
     soul::xml::Node* node, const std::string& xmlFileName)
 {
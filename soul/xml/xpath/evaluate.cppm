@@ -9,10 +9,43 @@ import std.core;
 import soul.xml.xpath.object;
 import soul.xml.xpath.expr;
 import soul.xml.node;
+import soul.xml.xpath.context;
 
 export namespace soul::xml::xpath {
 
 std::unique_ptr<soul::xml::xpath::expr::Expr> ParseXPathExpr(const std::string& xpathExpr);
+
+const int defaultXPathExprCacheCapacity = 256;
+
+//  ===================================================================================================
+//  GetCompiledXPathExpr returns a parsed XPath expression from a thread-safe cache keyed by the 
+//  expression text. The expression is parsed when it is requested for the first time. 
+//  Compiled expressions are immutable, so they can be evaluated by many threads at the same time.
+//  The cache keeps at most the given number of the most recently used expressions. An expression
+//  evicted from the cache or removed by ClearXPathExprCache stays alive while it is in use.
+//  ===================================================================================================
+
+std::shared_ptr<soul::xml::xpath::expr::Expr> GetCompiledXPathExpr(const std::string& xpathExpr);
+void SetXPathExprCacheCapacity(int capacity);
+void ClearXPathExprCache();
+
+//  ===================================================================================================
+//  XPathEvaluator evaluates cached XPath expressions reusing the storage of intermediate node-sets 
+//  from one evaluation to the next. Node-sets returned to the caller can be given back to the 
+//  evaluator by calling Release. An evaluator is not thread-safe: each thread should use its own.
+//  ===================================================================================================
+
+class XPathEvaluator
+{
+public:
+    XPathEvaluator();
+    std::unique_ptr<soul::xml::xpath::Object> Evaluate(const std::string& xpathExpr, soul::xml::Node* node);
+    std::unique_ptr<soul::xml::xpath::NodeSet> EvaluateToNodeSet(const std::string& xpathExpr, soul::xml::Node* node);
+    void Release(std::unique_ptr<soul::xml::xpath::NodeSet>&& nodeSet);
+private:
+    NodeSetPool pool;
+};
+
 std::unique_ptr<soul::xml::xpath::Object> Evaluate(soul::xml::xpath::expr::Expr* expr, soul::xml::Node* node);
 std::unique_ptr<soul::xml::xpath::Object> Evaluate(const std::string& xpathExpr, soul::xml::Node* node);
 std::unique_ptr<soul::xml::xpath::NodeSet> EvaluateToNodeSet(soul::xml::xpath::expr::Expr* expr, soul::xml::Node* node);
@@ -72,10 +72,61 @@ void NodeSelectionOperation::Apply(soul::xml::Node* node)
 {
     if (nodeTest->Select(node, axis))
     {
-        nodeSet.Add(node);
+        nodeSet.AddDistinct(node);
     }
 }
 
+struct NodeTestFilter
+{
+    NodeTestFilter() : nodeTest(nullptr), axis(soul::xml::Axis::child) {}
+    NodeTestFilter(NodeTest* nodeTest_, soul::xml::Axis axis_) : nodeTest(nodeTest_), axis(axis_) {}
+    bool operator()(soul::xml::Node* node) const { return nodeTest->Select(node, axis); }
+    NodeTest* nodeTest;
+    soul::xml::Axis axis;
+};
+
+template<typename Step, typename Filter>
+void SelectNodes(const soul::xml::AxisRange<Step, Filter>& range, NodeSet& nodeSet)
+{
+    for (soul::xml::Node* node : range)
+    {
+        nodeSet.AddDistinct(node);
+    }
+}
+
+template<typename Filter>
+bool SelectNodes(soul::xml::Node* contextNode, soul::xml::Axis axis, const Filter& filter, NodeSet& nodeSet)
+{
+    switch (axis)
+    {
+        case soul::xml::Axis::child: SelectNodes(soul::xml::Children(contextNode, filter), nodeSet); return true;
+        case soul::xml::Axis::descendant: SelectNodes(soul::xml::Descendants(contextNode, filter), nodeSet); return true;
+        case soul::xml::Axis::descendantOrSelf: SelectNodes(soul::xml::DescendantsOrSelf(contextNode, filter), nodeSet); return true;
+        case soul::xml::Axis::parent: SelectNodes(soul::xml::ParentOf(contextNode, filter), nodeSet); return true;
+        case soul::xml::Axis::ancestor: SelectNodes(soul::xml::Ancestors(contextNode, filter), nodeSet); return true;
+        case soul::xml::Axis::ancestorOrSelf: SelectNodes(soul::xml::AncestorsOrSelf(contextNode, filter), nodeSet); return true;
+        case soul::xml::Axis::followingSibling: SelectNodes(soul::xml::FollowingSiblings(contextNode, filter), nodeSet); return true;
+        case soul::xml::Axis::precedingSibling: SelectNodes(soul::xml::PrecedingSiblings(contextNode, filter), nodeSet); return true;
+        case soul::xml::Axis::self: SelectNodes(soul::xml::Self(contextNode, filter), nodeSet); return true;
+    }
+    return false;
+}
+
+bool IsReverseAxis(soul::xml::Axis axis)
+{
+    switch (axis)
+    {
+        case soul::xml::Axis::ancestor:
+        case soul::xml::Axis::ancestorOrSelf:
+        case soul::xml::Axis::preceding:
+        case soul::xml::Axis::precedingSibling:
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 NodeSet* NodeSetCast(Object* object)
 {
     if (object->IsNodeSet())
@@ -273,25 +324,122 @@ std::unique_ptr<soul::xml::xpath::Object> EvaluateAndExpr(Expr* left, Expr* righ
     return booleanFunction->Evaluate(context, rightArgs);
 }
 
-std::unique_ptr<soul::xml::xpath::Object> Compare(NodeSet* left, NodeSet* right, Operator op)
+std::vector<std::string> StringValues(NodeSet* nodeSet)
+{
+    std::vector<std::string> stringValues;
+    int n = nodeSet->Count();
+    stringValues.reserve(n);
+    for (int i = 0; i < n; ++i)
+    {
+        stringValues.push_back(StringValue(nodeSet->GetNode(i)));
+    }
+    return stringValues;
+}
+
+// The string value or number of each node is computed once; '=' probes a hash set of the smaller set's
+// string values, the other operators need only the distinct values or the least and greatest numbers.
+std::unique_ptr<soul::xml::xpath::Object> Compare(NodeSet* left, NodeSet* right, Operator op, Context& context)
 {
+    if (left->Count() == 0 || right->Count() == 0)
+    {
+        return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(false));
+    }
+    switch (op)
+    {
+        case Operator::equal:
+        {
+            std::vector<std::string> leftValues = StringValues(left);
+            std::vector<std::string> rightValues = StringValues(right);
+            if (leftValues.size() > rightValues.size())
+            {
+                std::swap(leftValues, rightValues);
+            }
+            std::unordered_set<std::string> leftSet(leftValues.begin(), leftValues.end());
+            for (const std::string& rightValue : rightValues)
+            {
+                if (leftSet.find(rightValue) != leftSet.end())
+                {
+                    return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(true));
+                }
+            }
+            return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(false));
+        }
+        case Operator::notEqual:
+        {
+            std::vector<std::string> leftValues = StringValues(left);
+            std::vector<std::string> rightValues = StringValues(right);
+            const std::string& first = leftValues.front();
+            for (const std::string& value : leftValues)
+            {
+                if (value != first)
+                {
+                    return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(true));
+                }
+            }
+            for (const std::string& value : rightValues)
+            {
+                if (value != first)
+                {
+                    return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(true));
+                }
+            }
+            return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(false));
+        }
+    }
+    double leftMin = std::numeric_limits<double>::infinity();
+    double leftMax = -std::numeric_limits<double>::infinity();
+    double rightMin = std::numeric_limits<double>::infinity();
+    double rightMax = -std::numeric_limits<double>::infinity();
+    bool leftHasNumber = false;
+    bool rightHasNumber = false;
     int n = left->Count();
     for (int i = 0; i < n; ++i)
     {
-        soul::xml::Node* leftNode = left->GetNode(i);
-        std::string leftStringValue = StringValue(leftNode);
-        int m = right->Count();
-        for (int j = 0; j < m; ++j)
+        std::unique_ptr<soul::xml::xpath::Object> leftAsNumber = ToNumber(left->GetNode(i), context);
+        double value = NumberCast(leftAsNumber.get())->Value();
+        if (std::isnan(value)) continue;
+        leftMin = std::min(leftMin, value);
+        leftMax = std::max(leftMax, value);
+        leftHasNumber = true;
+    }
+    int m = right->Count();
+    for (int j = 0; j < m; ++j)
+    {
+        std::unique_ptr<soul::xml::xpath::Object> rightAsNumber = ToNumber(right->GetNode(j), context);
+        double value = NumberCast(rightAsNumber.get())->Value();
+        if (std::isnan(value)) continue;
+        rightMin = std::min(rightMin, value);
+        rightMax = std::max(rightMax, value);
+        rightHasNumber = true;
+    }
+    bool result = false;
+    if (leftHasNumber && rightHasNumber)
+    {
+        switch (op)
         {
-            soul::xml::Node* rightNode = right->GetNode(j);
-            std::string rightStringValue = StringValue(rightNode);
-            if (Compare(leftStringValue, rightStringValue, op))
+            case Operator::less:
+            {
+                result = leftMin < rightMax;
+                break;
+            }
+            case Operator::greater:
             {
-                return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(true));
+                result = leftMax > rightMin;
+                break;
+            }
+            case Operator::lessOrEqual:
+            {
+                result = leftMin <= rightMax;
+                break;
+            }
+            case Operator::greaterOrEqual:
+            {
+                result = leftMax >= rightMin;
+                break;
             }
         }
     }
-    return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(false));
+    return std::unique_ptr<soul::xml::xpath::Object>(new Boolean(result));
 }
 
 std::unique_ptr<soul::xml::xpath::Object> Compare(NodeSet* left, Boolean* right, Operator op, Context& context)
@@ -426,7 +574,7 @@ std::unique_ptr<soul::xml::xpath::Object> Compare(Expr* left, Expr* right, Opera
                 case ObjectKind::nodeSet:
                 {
                     NodeSet* rightNodeSet = static_cast<NodeSet*>(rightOperand.get());
-                    return Compare(leftNodeSet, rightNodeSet, op);
+                    return Compare(leftNodeSet, rightNodeSet, op, context);
                 }
                 case ObjectKind::boolean:
                 {
@@ -574,7 +722,7 @@ std::unique_ptr<soul::xml::xpath::Object> EvaluateUnionExpr(Expr* left, Expr* ri
     NodeSet* leftNodeSet = NodeSetCast(leftOperand.get());
     std::unique_ptr<soul::xml::xpath::Object> rightOperand = right->Evaluate(context);
     NodeSet* rightNodeSet = NodeSetCast(rightOperand.get());
-    std::unique_ptr<soul::xml::xpath::NodeSet> result(new soul::xml::xpath::NodeSet());
+    std::unique_ptr<soul::xml::xpath::NodeSet> result = context.MakeNodeSet();
     int n = leftNodeSet->Count();
     for (int i = 0; i < n; ++i)
     {
@@ -585,6 +733,9 @@ std::unique_ptr<soul::xml::xpath::Object> EvaluateUnionExpr(Expr* left, Expr* ri
     {
         result->Add(rightNodeSet->GetNode(j));
     }
+    result->SortInDocumentOrder();
+    context.Release(std::move(leftOperand));
+    context.Release(std::move(rightOperand));
     return std::unique_ptr<soul::xml::xpath::Object>(result.release()); 
 }
 
@@ -592,12 +743,21 @@ std::unique_ptr<soul::xml::xpath::Object> EvaluateCombineStepExpr(Expr* left, Ex
 {
     std::unique_ptr<soul::xml::xpath::Object> leftOperand = left->Evaluate(context);
     NodeSet* leftNodeSet = NodeSetCast(leftOperand.get());
-    std::unique_ptr<soul::xml::xpath::NodeSet> result(new soul::xml::xpath::NodeSet());
     int n = leftNodeSet->Count();
+    if (n == 1)
+    {
+        // the node set selected from a single left node is already distinct and in document order, so it is the result as such
+        Context rightContext(leftNodeSet->GetNode(0), 1, 1, context.Pool());
+        std::unique_ptr<soul::xml::xpath::Object> rightOperand = right->Evaluate(rightContext);
+        NodeSetCast(rightOperand.get());
+        context.Release(std::move(leftOperand));
+        return rightOperand;
+    }
+    std::unique_ptr<soul::xml::xpath::NodeSet> result = context.MakeNodeSet();
     for (int i = 0; i < n; ++i)
     {
         soul::xml::Node* leftNode = leftNodeSet->GetNode(i);
-        Context rightContext(leftNode, i + 1, n);
+        Context rightContext(leftNode, i + 1, n, context.Pool());
         std::unique_ptr<soul::xml::xpath::Object> rightOperand = right->Evaluate(rightContext);
         NodeSet* rightNodeSet = NodeSetCast(rightOperand.get());
         int m = rightNodeSet->Count();
@@ -606,7 +766,10 @@ std::unique_ptr<soul::xml::xpath::Object> EvaluateCombineStepExpr(Expr* left, Ex
             soul::xml::Node* rightNode = rightNodeSet->GetNode(j);
             result->Add(rightNode);
         }
+        context.Release(std::move(rightOperand));
     }
+    result->SortInDocumentOrder();
+    context.Release(std::move(leftOperand));
     return std::unique_ptr<soul::xml::xpath::Object>(result.release()); 
 }
 
@@ -770,12 +933,12 @@ std::unique_ptr<soul::xml::xpath::Object> FilterExpr::Evaluate(Context& context)
     if (subjectResult->IsNodeSet())
     {
         std::unique_ptr<soul::xml::xpath::NodeSet> nodeSet(static_cast<soul::xml::xpath::NodeSet*>(subjectResult.release()));
-        std::unique_ptr<soul::xml::xpath::NodeSet> filteredNodeSet(new soul::xml::xpath::NodeSet());
+        std::unique_ptr<soul::xml::xpath::NodeSet> filteredNodeSet = context.MakeNodeSet();
         int n = nodeSet->Count();
         for (int i = 0; i < n; ++i)
         {
             soul::xml::Node* node = nodeSet->GetNode(i);
-            Context filterContext(node, i + 1, n);
+            Context filterContext(node, i + 1, n, context.Pool());
             std::unique_ptr<soul::xml::xpath::Object> result = predicate->Evaluate(filterContext);
             bool include = false;
             if (result->IsNumber())
@@ -794,10 +957,12 @@ std::unique_ptr<soul::xml::xpath::Object> FilterExpr::Evaluate(Context& context)
             }
             if (include)
             {
-                filteredNodeSet->Add(node);
+                filteredNodeSet->AddDistinct(node);
             }
+            context.Release(std::move(result));
         }
         std::swap(nodeSet, filteredNodeSet);
+        context.Release(std::unique_ptr<soul::xml::xpath::Object>(filteredNodeSet.release()));
         return std::unique_ptr<soul::xml::xpath::Object>(nodeSet.release());
     }
     else
@@ -996,19 +1161,229 @@ void LocationStepExpr::AddPredicate(Expr* predicate)
     predicates.push_back(std::unique_ptr<Expr>(predicate));
 }
 
+bool IsAttributeEqualsLiteral(Expr* predicate, const std::string*& attributeName, const std::string*& value)
+{
+    if (predicate->Kind() != ExprKind::binaryExpr)
+    {
+        return false;
+    }
+    BinaryExpr* binaryExpr = static_cast<BinaryExpr*>(predicate);
+    if (binaryExpr->Op() != Operator::equal)
+    {
+        return false;
+    }
+    Expr* step = binaryExpr->Left();
+    Expr* literal = binaryExpr->Right();
+    if (step->Kind() == ExprKind::literal)
+    {
+        std::swap(step, literal);
+    }
+    if (step->Kind() != ExprKind::locationStepExpr || literal->Kind() != ExprKind::literal)
+    {
+        return false;
+    }
+    LocationStepExpr* attributeStep = static_cast<LocationStepExpr*>(step);
+    if (attributeStep->GetAxis() != soul::xml::Axis::attribute || attributeStep->GetNodeTest()->Kind() != NodeTestKind::nameTest ||
+        !attributeStep->Predicates().empty())
+    {
+        return false;
+    }
+    attributeName = &static_cast<NameNodeTest*>(attributeStep->GetNodeTest())->Name();
+    value = &static_cast<Literal*>(literal)->Value();
+    return true;
+}
+
+bool UsesContextPosition(Expr* expr)
+{
+    switch (expr->Kind())
+    {
+        case ExprKind::unaryExpr:
+        {
+            return UsesContextPosition(static_cast<UnaryExpr*>(expr)->Operand());
+        }
+        case ExprKind::binaryExpr:
+        {
+            BinaryExpr* binaryExpr = static_cast<BinaryExpr*>(expr);
+            return UsesContextPosition(binaryExpr->Left()) || UsesContextPosition(binaryExpr->Right());
+        }
+        case ExprKind::filterExpr:
+        {
+            return UsesContextPosition(static_cast<FilterExpr*>(expr)->Subject());
+        }
+        case ExprKind::functionCall:
+        {
+            FunctionCall* functionCall = static_cast<FunctionCall*>(expr);
+            if (functionCall->FunctionName() == "position" || functionCall->FunctionName() == "last")
+            {
+                return true;
+            }
+            return std::any_of(functionCall->Arguments().cbegin(), functionCall->Arguments().cend(), [](const auto& arg) { return UsesContextPosition(arg.get()); });
+        }
+    }
+    return false;
+}
+
+// A predicate is non-positional if it cannot evaluate to a number and does not call position() or last() for its own context node.
+
+bool IsNonPositionalPredicate(Expr* predicate)
+{
+    if (UsesContextPosition(predicate))
+    {
+        return false;
+    }
+    switch (predicate->Kind())
+    {
+        case ExprKind::unaryExpr:
+        {
+            UnaryExpr* unaryExpr = static_cast<UnaryExpr*>(predicate);
+            return unaryExpr->Op() == Operator::parens && IsNonPositionalPredicate(unaryExpr->Operand());
+        }
+        case ExprKind::binaryExpr:
+        {
+            switch (static_cast<BinaryExpr*>(predicate)->Op())
+            {
+                case Operator::plus: case Operator::minus: case Operator::mul: case Operator::div: case Operator::mod:
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case ExprKind::root: case ExprKind::filterExpr: case ExprKind::locationStepExpr: case ExprKind::literal:
+        {
+            return true;
+        }
+        case ExprKind::functionCall:
+        {
+            const std::string& functionName = static_cast<FunctionCall*>(predicate)->FunctionName();
+            return functionName == "boolean" || functionName == "string";
+        }
+    }
+    return false;
+}
+
+bool IsOnAxis(soul::xml::Node* node, soul::xml::ParentNode* contextNode, soul::xml::Axis axis)
+{
+    if (axis == soul::xml::Axis::child)
+    {
+        return node->Parent() == contextNode;
+    }
+    if (axis == soul::xml::Axis::descendantOrSelf && node == contextNode)
+    {
+        return true;
+    }
+    soul::xml::Node* ancestor = node->Parent();
+    while (ancestor)
+    {
+        if (ancestor == contextNode)
+        {
+            return true;
+        }
+        ancestor = ancestor->Parent();
+    }
+    return false;
+}
+
+bool LocationStepExpr::SelectFromIndex(Context& context, NodeSet& nodeSet) const
+{
+    if (predicates.empty())
+    {
+        return false;
+    }
+    if (axis != soul::xml::Axis::child && axis != soul::xml::Axis::descendant && axis != soul::xml::Axis::descendantOrSelf)
+    {
+        return false;
+    }
+    soul::xml::Node* node = context.Node();
+    if (!node->IsDocumentNode() && !node->IsElementNode())
+    {
+        return false;
+    }
+    const std::string* attributeName = nullptr;
+    const std::string* value = nullptr;
+    if (!IsAttributeEqualsLiteral(predicates.front().get(), attributeName, value))
+    {
+        return false;
+    }
+    soul::xml::ParentNode* contextNode = static_cast<soul::xml::ParentNode*>(node);
+    soul::xml::Document* document = contextNode->ContainingDocument();
+    if (!document)
+    {
+        return false;
+    }
+    soul::xml::AttributeIndex* index = document->GetAttributeIndex(document->GetNameTable()->Find(*attributeName));
+    if (!index)
+    {
+        return false;
+    }
+    const std::vector<soul::xml::Element*>* elements = index->Find(*value);
+    if (elements)
+    {
+        bool fromDocument = contextNode == document && axis != soul::xml::Axis::child;
+        for (soul::xml::Element* element : *elements)
+        {
+            if (nodeTest->Select(element, axis) && (fromDocument || IsOnAxis(element, contextNode, axis)))
+            {
+                nodeSet.AddDistinct(element);
+            }
+        }
+        nodeSet.SortInDocumentOrder();
+    }
+    return true;
+}
+
+bool LocationStepExpr::SelectFromAxis(Context& context, NodeSet& nodeSet) const
+{
+    if (axis == soul::xml::Axis::attribute || axis == soul::xml::Axis::ns)
+    {
+        return false;
+    }
+    soul::xml::Node* contextNode = context.Node();
+    switch (nodeTest->Kind())
+    {
+        case NodeTestKind::nameTest:
+        {
+            NameNodeTest* nameNodeTest = static_cast<NameNodeTest*>(nodeTest.get());
+            return SelectNodes(contextNode, axis, soul::xml::ElementNamed(contextNode->Names().Find(nameNodeTest->Name())), nodeSet);
+        }
+        case NodeTestKind::principalNodeTest:
+        {
+            return SelectNodes(contextNode, axis, soul::xml::ElementNode(), nodeSet);
+        }
+        case NodeTestKind::anyNodeTest:
+        {
+            return SelectNodes(contextNode, axis, soul::xml::AnyNode(), nodeSet);
+        }
+        default:
+        {
+            return SelectNodes(contextNode, axis, NodeTestFilter(nodeTest.get(), axis), nodeSet);
+        }
+    }
+}
+
 std::unique_ptr<soul::xml::xpath::Object> LocationStepExpr::Evaluate(Context& context) const
 {
-    std::unique_ptr<soul::xml::xpath::NodeSet> nodeSet(new soul::xml::xpath::NodeSet());
-    NodeSelectionOperation selectNodes(nodeTest.get(), *nodeSet, axis);
-    context.Node()->Walk(selectNodes, axis);
-    for (const auto& predicate : predicates)
+    std::unique_ptr<soul::xml::xpath::NodeSet> nodeSet = context.MakeNodeSet();
+    int firstPredicate = 0;
+    if (SelectFromIndex(context, *nodeSet))
+    {
+        firstPredicate = 1;
+    }
+    else if (!SelectFromAxis(context, *nodeSet))
     {
-        std::unique_ptr<soul::xml::xpath::NodeSet> filteredNodeSet(new soul::xml::xpath::NodeSet());
+        NodeSelectionOperation selectNodes(nodeTest.get(), *nodeSet, axis);
+        context.Node()->Walk(selectNodes, axis);
+    }
+    int predicateCount = predicates.size();
+    for (int p = firstPredicate; p < predicateCount; ++p)
+    {
+        Expr* predicate = predicates[p].get();
+        std::unique_ptr<soul::xml::xpath::NodeSet> filteredNodeSet = context.MakeNodeSet();
         int n = nodeSet->Count();
         for (int i = 0; i < n; ++i)
         {
             soul::xml::Node* node = nodeSet->GetNode(i);
-            Context filterContext(node, i + 1, n);
+            Context filterContext(node, i + 1, n, context.Pool());
             std::unique_ptr<soul::xml::xpath::Object> predicateResult = predicate->Evaluate(filterContext);
             bool include = false;
             if (predicateResult->IsNumber())
@@ -1027,10 +1402,16 @@ std::unique_ptr<soul::xml::xpath::Object> LocationStepExpr::Evaluate(Context& co
             }
             if (include)
             {
-                filteredNodeSet->Add(node);
+                filteredNodeSet->AddDistinct(node);
             }
+            context.Release(std::move(predicateResult));
         }
         std::swap(nodeSet, filteredNodeSet);
+        context.Release(std::unique_ptr<soul::xml::xpath::Object>(filteredNodeSet.release()));
+    }
+    if (IsReverseAxis(axis))
+    {
+        nodeSet->SortInDocumentOrder();
     }
     return std::unique_ptr<soul::xml::xpath::Object>(nodeSet.release());
 }
@@ -1135,6 +1516,19 @@ soul::xml::Element* FunctionCall::ToXmlElement() const
 
 Expr* MakeSlashSlashExpr(Expr* left, Expr* right)
 {
+    if (right->Kind() == ExprKind::locationStepExpr)
+    {
+        LocationStepExpr* step = static_cast<LocationStepExpr*>(right);
+        if (step->GetAxis() == soul::xml::Axis::child && 
+            std::all_of(step->Predicates().cbegin(), step->Predicates().cend(), [](const auto& predicate) { return IsNonPositionalPredicate(predicate.get()); }))
+        {
+            // left//x[p] selects the same nodes as left/descendant::x[p] when no predicate is positional. The descendant step 
+            // yields its nodes in document order without a combine step for each descendant of left and the sort after it,
+            // and it can use the attribute index once instead of once for each descendant of left.
+            step->SetAxis(soul::xml::Axis::descendant);
+            return new BinaryExpr(Operator::slash, left, step);
+        }
+    }
     return new BinaryExpr(Operator::slash, left,
         new BinaryExpr(Operator::slash, 
             new LocationStepExpr(soul::xml::Axis::descendantOrSelf, new NodeTest(NodeTestKind::anyNodeTest)),
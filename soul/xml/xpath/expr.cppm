@@ -10,6 +10,7 @@ import soul.xml.xpath.object;
 import soul.xml.xpath.context;
 import soul.xml.axis;
 import soul.xml.element;
+import soul.xml.name.table;
 
 export namespace soul::xml::xpath::expr {
 
@@ -144,16 +145,27 @@ private:
     std::string name;
 };
 
+//  ===================================================================================================
+//  A child or descendant step whose first predicate is of the form [@attr='literal'] selects its
+//  nodes from the attribute index of the document when the document indexes the attribute.
+//  Other steps iterate the axis with the axis ranges of soul.xml.axis.iterator, the name test and
+//  '*' being matched inline. The following, preceding and attribute axes are walked with Node::Walk.
+//  ===================================================================================================
+
 class LocationStepExpr : public Expr
 {
 public:
     LocationStepExpr(soul::xml::Axis axis_, NodeTest* nodeTest_);
+    soul::xml::Axis GetAxis() const { return axis; }
+    void SetAxis(soul::xml::Axis axis_) { axis = axis_; }
     NodeTest* GetNodeTest() const { return nodeTest.get(); }
     void AddPredicate(Expr* predicate);
     const std::vector<std::unique_ptr<Expr>>& Predicates() const { return predicates; }
     std::unique_ptr<soul::xml::xpath::Object> Evaluate(Context& context) const override;
     soul::xml::Element* ToXmlElement() const override;
 private:
+    bool SelectFromIndex(Context& context, NodeSet& nodeSet) const;
+    bool SelectFromAxis(Context& context, NodeSet& nodeSet) const;
     soul::xml::Axis axis;
     std::unique_ptr<NodeTest> nodeTest;
     std::vector<std::unique_ptr<Expr>> predicates;
@@ -198,6 +210,7 @@ public:
     FunctionCall(const std::string& functionName_);
     const std::string& FunctionName() const { return functionName; }
     void AddArgument(Expr* argument);
+    const std::vector<std::unique_ptr<Expr>>& Arguments() const { return arguments; }
     std::unique_ptr<soul::xml::xpath::Object> Evaluate(Context& context) const override;
     soul::xml::Element* ToXmlElement() const override;
 private:
@@ -8,6 +8,7 @@ module soul.xml.xpath.object;
 import soul.xml.text;
 import soul.xml.processing.instruction;
 import soul.xml.comment;
+import soul.xml.parent.node;
 
 namespace soul::xml::xpath {
 
@@ -49,9 +50,186 @@ NodeSet::NodeSet() : Object(ObjectKind::nodeSet)
 
 void NodeSet::Add(soul::xml::Node* node)
 {
-    if (std::find(nodes.cbegin(), nodes.cend(), node) == nodes.cend())
+    if (!Contains(node))
     {
-        nodes.push_back(node);
+        AddDistinct(node);
+    }
+}
+
+void NodeSet::AddDistinct(soul::xml::Node* node)
+{
+    nodes.push_back(node);
+    if (!nodeSet.empty())
+    {
+        nodeSet.insert(node);
+    }
+    else if (nodes.size() == nodeSetHashThreshold)
+    {
+        nodeSet.insert(nodes.cbegin(), nodes.cend());
+    }
+}
+
+bool NodeSet::Contains(soul::xml::Node* node) const
+{
+    if (nodeSet.empty())
+    {
+        return std::find(nodes.cbegin(), nodes.cend(), node) != nodes.cend();
+    }
+    else
+    {
+        return nodeSet.find(node) != nodeSet.cend();
+    }
+}
+
+void NodeSet::Clear()
+{
+    nodes.clear();
+    if (nodeSet.empty())
+    {
+        return;
+    }
+    //  clearing a hash set costs its bucket count, so a table much larger than its contents is dropped instead of cleared
+    if (nodeSet.size() * 4 < nodeSet.bucket_count())
+    {
+        std::unordered_set<soul::xml::Node*>().swap(nodeSet);
+    }
+    else
+    {
+        nodeSet.clear();
+    }
+}
+
+//  ===================================================================================================
+//  DocumentOrderRanks numbers the nodes of a node set in document order. It puts the children of each
+//  ancestor of a member that are members or ancestors of members in document order, walking only the
+//  sibling lists that contain such a child, each of them only once and up to the last such child.
+//  Then it ranks the nodes by a preorder walk of the tree formed by the members and their ancestors.
+//  ===================================================================================================
+
+class DocumentOrderRanks
+{
+public:
+    DocumentOrderRanks(const std::vector<soul::xml::Node*>& nodes);
+    int64_t Rank(soul::xml::Node* node) const { return ranks.find(node)->second; }
+private:
+    void AddPath(soul::xml::Node* node);
+    void OrderChildren(soul::xml::Node* parent, std::vector<soul::xml::Node*>& children);
+    void AssignRanks(soul::xml::Node* root);
+    std::unordered_map<soul::xml::Node*, std::vector<soul::xml::Node*>> childrenOnPath;
+    std::unordered_map<soul::xml::Node*, int64_t> ranks;
+    std::vector<soul::xml::Node*> roots;
+    int64_t rankCount;
+};
+
+DocumentOrderRanks::DocumentOrderRanks(const std::vector<soul::xml::Node*>& nodes) : rankCount(0)
+{
+    for (soul::xml::Node* node : nodes)
+    {
+        AddPath(node);
+    }
+    for (auto& parentChildren : childrenOnPath)
+    {
+        OrderChildren(parentChildren.first, parentChildren.second);
+    }
+    for (soul::xml::Node* root : roots)
+    {
+        AssignRanks(root);
+    }
+}
+
+void DocumentOrderRanks::AddPath(soul::xml::Node* node)
+{
+    while (ranks.insert(std::make_pair(node, 0)).second)
+    {
+        soul::xml::Node* parent = node->Parent();
+        if (!parent)
+        {
+            //  nodes of different trees are ordered by the first appearance of their tree
+            roots.push_back(node);
+            break;
+        }
+        childrenOnPath[parent].push_back(node);
+        node = parent;
+    }
+}
+
+void DocumentOrderRanks::OrderChildren(soul::xml::Node* parent, std::vector<soul::xml::Node*>& children)
+{
+    std::vector<soul::xml::Node*> childNodes;
+    std::vector<soul::xml::Node*> orderedChildren;
+    orderedChildren.reserve(children.size());
+    for (soul::xml::Node* child : children)
+    {
+        if (!child->IsAttributeNode())
+        {
+            childNodes.push_back(child);
+        }
+    }
+    if (childNodes.size() < children.size())
+    {
+        //  attributes come after their element and before the children of the element
+        soul::xml::Element* element = static_cast<soul::xml::Element*>(parent);
+        for (const soul::xml::AttributeEntry& attribute : element->Attributes())
+        {
+            if (attribute.HasNode())
+            {
+                soul::xml::AttributeNode* attributeNode = element->GetAttributeNode(attribute.GetName());
+                if (std::find(children.cbegin(), children.cend(), attributeNode) != children.cend())
+                {
+                    orderedChildren.push_back(attributeNode);
+                }
+            }
+        }
+    }
+    if (!childNodes.empty())
+    {
+        std::sort(childNodes.begin(), childNodes.end());
+        int64_t count = childNodes.size();
+        int64_t found = 0;
+        for (soul::xml::Node* child = static_cast<soul::xml::ParentNode*>(parent)->FirstChild(); child && found < count; child = child->Next())
+        {
+            if (std::binary_search(childNodes.cbegin(), childNodes.cend(), child))
+            {
+                orderedChildren.push_back(child);
+                ++found;
+            }
+        }
+    }
+    std::swap(children, orderedChildren);
+}
+
+void DocumentOrderRanks::AssignRanks(soul::xml::Node* root)
+{
+    std::vector<soul::xml::Node*> stack;
+    stack.push_back(root);
+    while (!stack.empty())
+    {
+        soul::xml::Node* node = stack.back();
+        stack.pop_back();
+        ranks[node] = rankCount++;
+        auto it = childrenOnPath.find(node);
+        if (it != childrenOnPath.end())
+        {
+            stack.insert(stack.end(), it->second.crbegin(), it->second.crend());
+        }
+    }
+}
+
+void NodeSet::SortInDocumentOrder()
+{
+    if (InDocumentOrder(nodes)) return;
+    DocumentOrderRanks ranks(nodes);
+    std::vector<std::pair<int64_t, soul::xml::Node*>> rankedNodes;
+    rankedNodes.reserve(nodes.size());
+    for (soul::xml::Node* node : nodes)
+    {
+        rankedNodes.push_back(std::make_pair(ranks.Rank(node), node));
+    }
+    std::sort(rankedNodes.begin(), rankedNodes.end());
+    int n = rankedNodes.size();
+    for (int i = 0; i < n; ++i)
+    {
+        nodes[i] = rankedNodes[i].second;
     }
 }
 
@@ -67,6 +245,74 @@ Node* NodeSet::GetNode(int index) const
     }
 }
 
+bool Precedes(soul::xml::Node* left, soul::xml::Node* right)
+{
+    if (left == right) return false;
+    int leftDepth = 0;
+    for (soul::xml::Node* n = left->Parent(); n; n = n->Parent())
+    {
+        ++leftDepth;
+    }
+    int rightDepth = 0;
+    for (soul::xml::Node* n = right->Parent(); n; n = n->Parent())
+    {
+        ++rightDepth;
+    }
+    soul::xml::Node* l = left;
+    soul::xml::Node* r = right;
+    while (leftDepth > rightDepth)
+    {
+        l = l->Parent();
+        --leftDepth;
+    }
+    while (rightDepth > leftDepth)
+    {
+        r = r->Parent();
+        --rightDepth;
+    }
+    if (l == r)
+    {
+        return l == left;
+    }
+    while (l->Parent() != r->Parent())
+    {
+        l = l->Parent();
+        r = r->Parent();
+    }
+    soul::xml::ParentNode* parent = l->Parent();
+    if (!parent) return false;
+    if (l->IsAttributeNode() || r->IsAttributeNode())
+    {
+        if (!r->IsAttributeNode()) return true;
+        if (!l->IsAttributeNode()) return false;
+        if (parent->IsElementNode())
+        {
+            soul::xml::Element* element = static_cast<soul::xml::Element*>(parent);
+            for (const auto& attribute : element->Attributes())
+            {
+                if (attribute.GetName() == l->GetName()) return true;
+                if (attribute.GetName() == r->GetName()) return false;
+            }
+        }
+        return false;
+    }
+    for (soul::xml::Node* n = l->Next(); n; n = n->Next())
+    {
+        if (n == r) return true;
+    }
+    return false;
+}
+
+bool InDocumentOrder(const std::vector<soul::xml::Node*>& nodes)
+{
+    int n = nodes.size();
+    for (int i = 1; i < n; ++i)
+    {
+        if (!Precedes(nodes[i - 1], nodes[i])) return false;
+    }
+    return true;
+}
+
 soul::xml::Element* NodeSet::ToXmlElement() const
 {
     soul::xml::Element* element = soul::xml::MakeElement("node-set");
@@ -85,10 +331,9 @@ soul::xml::Element* NodeSet::ToXmlElement() const
             nodeElement->AppendChild(attributesElement);
             for (const auto& attr : elementNode->Attributes())
             {
-                soul::xml::AttributeNode* attributeNode = attr.second.get();
                 soul::xml::Element* attributeElement = soul::xml::MakeElement("attribute");
-                attributeElement->SetAttribute("name", attributeNode->Name());
-                attributeElement->SetAttribute("value", attributeNode->Value());
+                attributeElement->SetAttribute("name", attr.Name());
+                attributeElement->SetAttribute("value", std::string(attr.Value()));
                 attributesElement->AppendChild(attributeElement);
             }
         }
@@ -105,22 +350,22 @@ soul::xml::Element* NodeSet::ToXmlElement() const
         {
             soul::xml::Text* textNode = static_cast<soul::xml::Text*>(node);
             soul::xml::Element* textElement = soul::xml::MakeElement("text");
-            textElement->SetAttribute("value", textNode->Data());
+            textElement->SetAttribute("value", std::string(textNode->Data()));
             nodeElement->AppendChild(textElement);
         }
         else if (node->IsProcessingInstructionNode())
         {
             soul::xml::ProcessingInstruction* processingInstructionNode = static_cast<soul::xml::ProcessingInstruction*>(node);
             soul::xml::Element* processingInstructionElement = soul::xml::MakeElement("processing-instruction");
-            processingInstructionElement->SetAttribute("target", processingInstructionNode->Target());
-            processingInstructionElement->SetAttribute("data", processingInstructionNode->Data());
+            processingInstructionElement->SetAttribute("target", std::string(processingInstructionNode->Target()));
+            processingInstructionElement->SetAttribute("data", std::string(processingInstructionNode->Data()));
             nodeElement->AppendChild(processingInstructionElement);
         }
         else if (node->IsCommentNode())
         {
             soul::xml::Comment* commentNode = static_cast<soul::xml::Comment*>(node);
             soul::xml::Element* commentElement = soul::xml::MakeElement("comment");
-            commentElement->SetAttribute("data", commentNode->Data());
+            commentElement->SetAttribute("data", std::string(commentNode->Data()));
             nodeElement->AppendChild(commentElement);
         }
         element->AppendChild(nodeElement);
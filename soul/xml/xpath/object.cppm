@@ -33,6 +33,15 @@ private:
     ObjectKind kind;
 };
 
+//  ===================================================================================================
+//  NodeSet keeps its nodes in a vector in the order they were added. 
+//  Membership is checked with a linear search while the set is small, and with a hash set after that.
+//  SortInDocumentOrder puts the nodes in document order. It sorts the nodes by the positions of their
+//  ancestors among their siblings, so its cost depends on the depth of the nodes and not on the size of the document.
+//  ===================================================================================================
+
+const int nodeSetHashThreshold = 16;
+
 class NodeSet : public Object
 {
 public:
@@ -40,12 +49,20 @@ public:
     const std::vector<soul::xml::Node*>& Nodes() const { return nodes; }
     int Count() const { return nodes.size(); }
     void Add(soul::xml::Node* node);
+    void AddDistinct(soul::xml::Node* node);
+    bool Contains(soul::xml::Node* node) const;
+    void Clear();
+    void SortInDocumentOrder();
     Node* GetNode(int index) const;
     soul::xml::Element* ToXmlElement() const override;
 private:
     std::vector<soul::xml::Node*> nodes;
+    std::unordered_set<soul::xml::Node*> nodeSet;
 };
 
+bool Precedes(soul::xml::Node* left, soul::xml::Node* right);
+bool InDocumentOrder(const std::vector<soul::xml::Node*>& nodes);
+
 class Boolean : public Object
 {
 public:
@@ -0,0 +1,364 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+module soul.xml.xpath.streaming;
+
+import soul.xml.xpath.expr;
+import soul.xml.xpath.evaluate;
+import soul.xml.parser;
+import soul.xml.dom;
+import util;
+
+namespace soul::xml::xpath {
+
+[[noreturn]] void ThrowNotSupported(const std::string& xpathExpr, const std::string& reason)
+{
+    throw std::runtime_error("XPath expression '" + xpathExpr + "' not supported by the streaming matcher: " + reason);
+}
+
+void CollectLocationSteps(soul::xml::xpath::expr::Expr* expr, std::vector<soul::xml::xpath::expr::LocationStepExpr*>& locationSteps, const std::string& xpathExpr)
+{
+    switch (expr->Kind())
+    {
+        case soul::xml::xpath::expr::ExprKind::binaryExpr:
+        {
+            soul::xml::xpath::expr::BinaryExpr* binaryExpr = static_cast<soul::xml::xpath::expr::BinaryExpr*>(expr);
+            if (binaryExpr->Op() == soul::xml::xpath::expr::Operator::slash)
+            {
+                CollectLocationSteps(binaryExpr->Left(), locationSteps, xpathExpr);
+                CollectLocationSteps(binaryExpr->Right(), locationSteps, xpathExpr);
+                return;
+            }
+            break;
+        }
+        case soul::xml::xpath::expr::ExprKind::root:
+        {
+            if (locationSteps.empty())
+            {
+                return;
+            }
+            break;
+        }
+        case soul::xml::xpath::expr::ExprKind::locationStepExpr:
+        {
+            locationSteps.push_back(static_cast<soul::xml::xpath::expr::LocationStepExpr*>(expr));
+            return;
+        }
+    }
+    ThrowNotSupported(xpathExpr, "location path expected");
+}
+
+const soul::xml::Name* GetAttributeName(soul::xml::xpath::expr::Expr* expr, soul::xml::NameTable& names)
+{
+    if (expr->Kind() != soul::xml::xpath::expr::ExprKind::locationStepExpr) return nullptr;
+    soul::xml::xpath::expr::LocationStepExpr* locationStep = static_cast<soul::xml::xpath::expr::LocationStepExpr*>(expr);
+    if (locationStep->GetAxis() != soul::xml::Axis::attribute) return nullptr;
+    if (!locationStep->Predicates().empty()) return nullptr;
+    soul::xml::xpath::expr::NodeTest* nodeTest = locationStep->GetNodeTest();
+    if (nodeTest->Kind() != soul::xml::xpath::expr::NodeTestKind::nameTest) return nullptr;
+    return names.Intern(static_cast<soul::xml::xpath::expr::NameNodeTest*>(nodeTest)->Name());
+}
+
+StreamingPredicate MakeStreamingPredicate(soul::xml::xpath::expr::Expr* predicate, const std::string& xpathExpr, soul::xml::NameTable& names)
+{
+    const soul::xml::Name* attributeName = GetAttributeName(predicate, names);
+    if (attributeName)
+    {
+        return StreamingPredicate(attributeName);
+    }
+    if (predicate->Kind() == soul::xml::xpath::expr::ExprKind::binaryExpr)
+    {
+        soul::xml::xpath::expr::BinaryExpr* binaryExpr = static_cast<soul::xml::xpath::expr::BinaryExpr*>(predicate);
+        if (binaryExpr->Op() == soul::xml::xpath::expr::Operator::equal)
+        {
+            soul::xml::xpath::expr::Expr* attribute = binaryExpr->Left();
+            soul::xml::xpath::expr::Expr* literal = binaryExpr->Right();
+            if (literal->Kind() != soul::xml::xpath::expr::ExprKind::literal)
+            {
+                std::swap(attribute, literal);
+            }
+            attributeName = GetAttributeName(attribute, names);
+            if (attributeName && literal->Kind() == soul::xml::xpath::expr::ExprKind::literal)
+            {
+                return StreamingPredicate(attributeName, static_cast<soul::xml::xpath::expr::Literal*>(literal)->Value());
+            }
+        }
+    }
+    ThrowNotSupported(xpathExpr, "predicate '" + predicate->Str() + "' is not of the form [@attr] or [@attr='literal']");
+}
+
+std::vector<StreamingStep> CompileStreamingSteps(const std::string& xpathExpr, soul::xml::NameTable& names)
+{
+    std::unique_ptr<soul::xml::xpath::expr::Expr> expr = ParseXPathExpr(xpathExpr);
+    std::vector<soul::xml::xpath::expr::LocationStepExpr*> locationSteps;
+    CollectLocationSteps(expr.get(), locationSteps, xpathExpr);
+    std::vector<StreamingStep> steps;
+    bool descendant = false;
+    for (soul::xml::xpath::expr::LocationStepExpr* locationStep : locationSteps)
+    {
+        soul::xml::Axis axis = locationStep->GetAxis();
+        soul::xml::xpath::expr::NodeTest* nodeTest = locationStep->GetNodeTest();
+        if (nodeTest->Kind() == soul::xml::xpath::expr::NodeTestKind::anyNodeTest && locationStep->Predicates().empty())
+        {
+            if (axis == soul::xml::Axis::descendantOrSelf)
+            {
+                descendant = true;
+                continue;
+            }
+            else if (axis == soul::xml::Axis::self && !descendant)
+            {
+                continue;
+            }
+        }
+        if (axis == soul::xml::Axis::descendant)
+        {
+            descendant = true;
+        }
+        else if (axis != soul::xml::Axis::child)
+        {
+            ThrowNotSupported(xpathExpr, "axis '" + soul::xml::AxisName(axis) + "' is not forward child or descendant axis");
+        }
+        const soul::xml::Name* name = nullptr;
+        switch (nodeTest->Kind())
+        {
+            case soul::xml::xpath::expr::NodeTestKind::nameTest:
+            {
+                name = names.Intern(static_cast<soul::xml::xpath::expr::NameNodeTest*>(nodeTest)->Name());
+                break;
+            }
+            case soul::xml::xpath::expr::NodeTestKind::principalNodeTest:
+            {
+                break;
+            }
+            default:
+            {
+                ThrowNotSupported(xpathExpr, "name test or '*' expected");
+            }
+        }
+        StreamingStep step(descendant ? soul::xml::Axis::descendant : soul::xml::Axis::child, name);
+        for (const auto& predicate : locationStep->Predicates())
+        {
+            step.AddPredicate(MakeStreamingPredicate(predicate.get(), xpathExpr, names));
+        }
+        steps.push_back(std::move(step));
+        descendant = false;
+    }
+    if (steps.empty() || descendant)
+    {
+        ThrowNotSupported(xpathExpr, "path must end with an element step");
+    }
+    return steps;
+}
+
+StreamingPredicate::StreamingPredicate(const soul::xml::Name* attributeName_) : attributeName(attributeName_), hasValue(false)
+{
+}
+
+StreamingPredicate::StreamingPredicate(const soul::xml::Name* attributeName_, const std::string& value_) : attributeName(attributeName_), hasValue(true), value(value_)
+{
+}
+
+bool StreamingPredicate::Matches(const soul::xml::processor::Attributes& attributes) const
+{
+    const std::string* attributeValue = attributes.GetAttributeValue(attributeName);
+    if (!attributeValue) return false;
+    return !hasValue || *attributeValue == value;
+}
+
+StreamingStep::StreamingStep(soul::xml::Axis axis_, const soul::xml::Name* name_) : axis(axis_), name(name_)
+{
+}
+
+void StreamingStep::AddPredicate(const StreamingPredicate& predicate)
+{
+    predicates.push_back(predicate);
+}
+
+bool StreamingStep::Matches(const soul::xml::Name* elementName, const soul::xml::processor::Attributes& attributes) const
+{
+    if (name && name != elementName) return false;
+    for (const auto& predicate : predicates)
+    {
+        if (!predicate.Matches(attributes)) return false;
+    }
+    return true;
+}
+
+StreamingMatcher::StreamingMatcher(const std::string& xpathExpr_, const StreamingMatchCallback& callback_) :
+    StreamingMatcher(xpathExpr_, callback_, &soul::xml::NameTable::Default())
+{
+}
+
+StreamingMatcher::StreamingMatcher(const std::string& xpathExpr_, const StreamingMatchCallback& callback_, soul::xml::NameTable* nameTable_) :
+    xpathExpr(xpathExpr_), steps(CompileStreamingSteps(xpathExpr, *nameTable_)), callback(callback_), matchCount(0)
+{
+    SetNameTable(nameTable_);
+}
+
+void StreamingMatcher::StartDocument(const soul::ast::SourcePos& sourcePos)
+{
+    states.clear();
+    states.push_back(0);
+    stateStart.clear();
+    stateStart.push_back(0);
+    match.reset();
+    elementStack.clear();
+    textContent.Clear();
+    matchCount = 0;
+}
+
+void StreamingMatcher::Comment(const soul::ast::SourcePos& sourcePos, const std::string& comment)
+{
+    if (!match) return;
+    AddTextContent();
+    elementStack.back()->AppendChild(new soul::xml::Comment(sourcePos, comment));
+}
+
+void StreamingMatcher::PI(const soul::ast::SourcePos& sourcePos, const std::string& target, const std::string& data)
+{
+    if (!match) return;
+    AddTextContent();
+    elementStack.back()->AppendChild(new soul::xml::ProcessingInstruction(sourcePos, target, data));
+}
+
+void StreamingMatcher::Text(const soul::ast::SourcePos& sourcePos, const std::string& text)
+{
+    if (!match) return;
+    textContent.Add(sourcePos, text);
+}
+
+void StreamingMatcher::CDataSection(const soul::ast::SourcePos& sourcePos, const std::string& cdata)
+{
+    if (!match) return;
+    AddTextContent();
+    elementStack.back()->AppendChild(new soul::xml::CDataSection(sourcePos, cdata));
+}
+
+void StreamingMatcher::StartElement(const soul::ast::SourcePos& sourcePos, const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName,
+    const soul::xml::processor::Attributes& attributes)
+{
+    soul::xml::NameTable* names = GetNameTable();
+    StartElement(sourcePos, names->InternString(namespaceUri), names->Intern(qualifiedName), attributes);
+}
+
+void StreamingMatcher::StartElement(const soul::ast::SourcePos& sourcePos, const std::string* namespaceUri, const soul::xml::Name* name,
+    const soul::xml::processor::Attributes& attributes)
+{
+    int parentStart = stateStart.back();
+    int parentEnd = static_cast<int>(states.size());
+    stateStart.push_back(parentEnd);
+    bool matched = false;
+    if (!match)
+    {
+        int n = static_cast<int>(steps.size());
+        for (int i = parentStart; i < parentEnd; ++i)
+        {
+            int state = states[i];
+            const StreamingStep& step = steps[state];
+            if (step.GetAxis() == soul::xml::Axis::descendant)
+            {
+                if (std::find(states.begin() + parentEnd, states.end(), state) == states.end())
+                {
+                    states.push_back(state);
+                }
+            }
+            if (step.Matches(name, attributes))
+            {
+                int next = state + 1;
+                if (next == n)
+                {
+                    matched = true;
+                }
+                else if (std::find(states.begin() + parentEnd, states.end(), next) == states.end())
+                {
+                    states.push_back(next);
+                }
+            }
+        }
+        if (!matched) return;
+    }
+    else
+    {
+        AddTextContent(true);
+    }
+    soul::xml::Element* element = new soul::xml::Element(sourcePos, name);
+    element->ReserveAttributes(attributes.GetAttributes().size());
+    for (const auto& attribute : attributes.GetAttributes())
+    {
+        element->SetAttribute(sourcePos, attribute->GetName(), attribute->Value());
+    }
+    element->SetNamespaceUri(namespaceUri);
+    if (matched)
+    {
+        match.reset(element);
+        textContent.Clear();
+    }
+    else
+    {
+        elementStack.back()->AppendChild(element);
+    }
+    elementStack.push_back(element);
+}
+
+void StreamingMatcher::EndElement(const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName)
+{
+    if (match)
+    {
+        AddTextContent();
+        elementStack.pop_back();
+        if (elementStack.empty())
+        {
+            ++matchCount;
+            callback(std::move(match));
+            match.reset();
+        }
+    }
+    states.resize(stateStart.back());
+    stateStart.pop_back();
+}
+
+void StreamingMatcher::SkippedEntity(const soul::ast::SourcePos& sourcePos, const std::string& entityName)
+{
+    if (!match) return;
+    AddTextContent();
+    elementStack.back()->AppendChild(new soul::xml::EntityReference(sourcePos, entityName));
+}
+
+void StreamingMatcher::AddTextContent()
+{
+    AddTextContent(false);
+}
+
+void StreamingMatcher::AddTextContent(bool addSpace)
+{
+    textContent.AppendTo(elementStack.empty() ? nullptr : elementStack.back(), nullptr, addSpace);
+}
+
+int64_t StreamXmlFile(const std::string& xmlFileName, const std::string& xpathExpr, const StreamingMatchCallback& callback)
+{
+    return StreamXmlFile(xmlFileName, xpathExpr, callback, &soul::xml::NameTable::Default());
+}
+
+int64_t StreamXmlFile(const std::string& xmlFileName, const std::string& xpathExpr, const StreamingMatchCallback& callback, soul::xml::NameTable* nameTable)
+{
+    StreamingMatcher matcher(xpathExpr, callback, nameTable);
+    soul::xml::parser::ParseXmlFile(xmlFileName, &matcher);
+    return matcher.MatchCount();
+}
+
+int64_t StreamXmlContent(const std::string& xmlContent, const std::string& systemId, const std::string& xpathExpr, const StreamingMatchCallback& callback)
+{
+    return StreamXmlContent(xmlContent, systemId, xpathExpr, callback, &soul::xml::NameTable::Default());
+}
+
+int64_t StreamXmlContent(const std::string& xmlContent, const std::string& systemId, const std::string& xpathExpr, const StreamingMatchCallback& callback,
+    soul::xml::NameTable* nameTable)
+{
+    StreamingMatcher matcher(xpathExpr, callback, nameTable);
+    soul::xml::parser::ParseXmlContent(xmlContent, systemId, &matcher);
+    return matcher.MatchCount();
+}
+
+} // namespace soul::xml::xpath
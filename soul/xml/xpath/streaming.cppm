@@ -0,0 +1,109 @@
+// =================================
+// Copyright (c) 2024 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+export module soul.xml.xpath.streaming;
+
+import std.core;
+import soul.xml.content.handler;
+import soul.xml.processor.attribute;
+import soul.xml.element;
+import soul.xml.name.table;
+import soul.xml.axis;
+import soul.xml.document.handler;
+import soul.ast.source.pos;
+
+export namespace soul::xml::xpath {
+
+//  ===================================================================================================
+//  StreamingMatcher evaluates a forward-only subset of XPath while an XML document is being parsed.
+//  The supported expressions are location paths consisting of child and descendant steps, for example
+//  '/diagram/*', '//class[@name='Foo']' or 'diagram/elements/*[@kind]'. A step may have a name test
+//  or '*' as its node test, and any number of attribute predicates of the form [@attr] or
+//  [@attr='literal']. A relative path is evaluated relative to the document node.
+//
+//  An element matched by the expression is built into a subtree of its own and delivered to the
+//  callback when its end tag has been parsed. Content outside the matched subtrees is not stored,
+//  so large documents can be processed in constant memory. Matches nested inside a subtree that
+//  has already been matched are part of the outer subtree and are not delivered separately.
+//
+//  The matched subtrees are detached from any document. Their names are interned in the name table
+//  given to the matcher, or in the default name table if none is given. The default table is never
+//  cleared, so a long-running process that streams documents with many distinct names should give
+//  a table of its own and keep it alive as long as the matched subtrees are in use.
+//
+//  Constructing a StreamingMatcher for an expression outside the subset throws std::runtime_error.
+//  ===================================================================================================
+
+using StreamingMatchCallback = std::function<void(std::unique_ptr<soul::xml::Element>&&)>;
+
+class StreamingPredicate
+{
+public:
+    StreamingPredicate(const soul::xml::Name* attributeName_);
+    StreamingPredicate(const soul::xml::Name* attributeName_, const std::string& value_);
+    bool Matches(const soul::xml::processor::Attributes& attributes) const;
+private:
+    const soul::xml::Name* attributeName;
+    bool hasValue;
+    std::string value;
+};
+
+class StreamingStep
+{
+public:
+    StreamingStep(soul::xml::Axis axis_, const soul::xml::Name* name_);
+    soul::xml::Axis GetAxis() const { return axis; }
+    void AddPredicate(const StreamingPredicate& predicate);
+    bool Matches(const soul::xml::Name* elementName, const soul::xml::processor::Attributes& attributes) const;
+private:
+    soul::xml::Axis axis;
+    const soul::xml::Name* name;
+    std::vector<StreamingPredicate> predicates;
+};
+
+class StreamingMatcher : public soul::xml::XmlContentHandler
+{
+public:
+    StreamingMatcher(const std::string& xpathExpr_, const StreamingMatchCallback& callback_);
+    StreamingMatcher(const std::string& xpathExpr_, const StreamingMatchCallback& callback_, soul::xml::NameTable* nameTable_);
+    int64_t MatchCount() const { return matchCount; }
+    void StartDocument(const soul::ast::SourcePos& sourcePos) override;
+    void Comment(const soul::ast::SourcePos& sourcePos, const std::string& comment) override;
+    void PI(const soul::ast::SourcePos& sourcePos, const std::string& target, const std::string& data) override;
+    void Text(const soul::ast::SourcePos& sourcePos, const std::string& text) override;
+    void CDataSection(const soul::ast::SourcePos& sourcePos, const std::string& cdata) override;
+    void StartElement(const soul::ast::SourcePos& sourcePos, const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName,
+        const soul::xml::processor::Attributes& attributes) override;
+    void StartElement(const soul::ast::SourcePos& sourcePos, const std::string* namespaceUri, const soul::xml::Name* name,
+        const soul::xml::processor::Attributes& attributes) override;
+    void EndElement(const std::string& namespaceUri, const std::string& localName, const std::string& qualifiedName) override;
+    void SkippedEntity(const soul::ast::SourcePos& sourcePos, const std::string& entityName) override;
+private:
+    void AddTextContent();
+    void AddTextContent(bool addSpace);
+    std::string xpathExpr;
+    std::vector<StreamingStep> steps;
+    StreamingMatchCallback callback;
+    std::vector<int> states;
+    std::vector<int> stateStart;
+    std::unique_ptr<soul::xml::Element> match;
+    std::vector<soul::xml::Element*> elementStack;
+    soul::xml::TextContent textContent;
+    int64_t matchCount;
+};
+
+//  ===================================================================================================
+//  StreamXmlFile parses given XML file and calls the callback for each element matched by given
+//  XPath expression. Returns the number of matched elements. The names of the matched elements are
+//  interned in given name table, or in the default name table if none is given.
+//  ===================================================================================================
+
+int64_t StreamXmlFile(const std::string& xmlFileName, const std::string& xpathExpr, const StreamingMatchCallback& callback);
+int64_t StreamXmlFile(const std::string& xmlFileName, const std::string& xpathExpr, const StreamingMatchCallback& callback, soul::xml::NameTable* nameTable);
+int64_t StreamXmlContent(const std::string& xmlContent, const std::string& systemId, const std::string& xpathExpr, const StreamingMatchCallback& callback);
+int64_t StreamXmlContent(const std::string& xmlContent, const std::string& systemId, const std::string& xpathExpr, const StreamingMatchCallback& callback,
+    soul::xml::NameTable* nameTable);
+
+} // namespace soul::xml::xpath
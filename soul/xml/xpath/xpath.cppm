@@ -11,3 +11,4 @@ export import soul.xml.xpath.object;
 export import soul.xml.xpath.token;
 export import soul.xml.xpath.evaluate;
 export import soul.xml.xpath.context;
+export import soul.xml.xpath.streaming;
@@ -68,6 +68,9 @@ soul::parser::Match XPathParser<LexerT>::Expr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127425);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127425);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> orExpr;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
@@ -86,6 +89,9 @@ soul::parser::Match XPathParser<LexerT>::Expr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Expr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, orExpr.release());
             }
         }
@@ -98,6 +104,9 @@ soul::parser::Match XPathParser<LexerT>::Expr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "Expr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -118,6 +127,9 @@ soul::parser::Match XPathParser<LexerT>::OrExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127426);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127426);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> left;
     std::unique_ptr<soul::xml::xpath::expr::Expr> right;
@@ -213,6 +225,9 @@ soul::parser::Match XPathParser<LexerT>::OrExpr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "OrExpr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -225,6 +240,9 @@ soul::parser::Match XPathParser<LexerT>::OrExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "OrExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -245,6 +263,9 @@ soul::parser::Match XPathParser<LexerT>::AndExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127427);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127427);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> left;
     std::unique_ptr<soul::xml::xpath::expr::Expr> right;
@@ -340,6 +361,9 @@ soul::parser::Match XPathParser<LexerT>::AndExpr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AndExpr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -352,6 +376,9 @@ soul::parser::Match XPathParser<LexerT>::AndExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AndExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -372,6 +399,9 @@ soul::parser::Match XPathParser<LexerT>::EqualityExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127428);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127428);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> left;
     std::unique_ptr<soul::parser::Value<soul::xml::xpath::expr::Operator>> op;
@@ -482,6 +512,9 @@ soul::parser::Match XPathParser<LexerT>::EqualityExpr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EqualityExpr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -494,6 +527,9 @@ soul::parser::Match XPathParser<LexerT>::EqualityExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "EqualityExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -514,6 +550,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127429);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127429);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> left;
     std::unique_ptr<soul::parser::Value<soul::xml::xpath::expr::Operator>> op;
@@ -624,6 +663,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalExpr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "RelationalExpr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -636,6 +678,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "RelationalExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -656,6 +701,9 @@ soul::parser::Match XPathParser<LexerT>::AdditiveExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127430);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127430);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> left;
     std::unique_ptr<soul::parser::Value<soul::xml::xpath::expr::Operator>> op;
@@ -766,6 +814,9 @@ soul::parser::Match XPathParser<LexerT>::AdditiveExpr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AdditiveExpr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -778,6 +829,9 @@ soul::parser::Match XPathParser<LexerT>::AdditiveExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AdditiveExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -798,6 +852,9 @@ soul::parser::Match XPathParser<LexerT>::MultiplicativeExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127431);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127431);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> left;
     std::unique_ptr<soul::parser::Value<soul::xml::xpath::expr::Operator>> op;
@@ -908,6 +965,9 @@ soul::parser::Match XPathParser<LexerT>::MultiplicativeExpr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "MultiplicativeExpr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -920,6 +980,9 @@ soul::parser::Match XPathParser<LexerT>::MultiplicativeExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "MultiplicativeExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -940,6 +1003,9 @@ soul::parser::Match XPathParser<LexerT>::UnaryExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127432);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127432);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> subject;
     std::unique_ptr<soul::xml::xpath::expr::Expr> unionExpr;
     soul::parser::Match match(false);
@@ -974,6 +1040,9 @@ soul::parser::Match XPathParser<LexerT>::UnaryExpr(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "UnaryExpr");
                             #endif
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
                             return soul::parser::Match(true, new soul::xml::xpath::expr::UnaryExpr(soul::xml::xpath::expr::Operator::minus, subject.release()));
                         }
                     }
@@ -1002,6 +1071,9 @@ soul::parser::Match XPathParser<LexerT>::UnaryExpr(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "UnaryExpr");
                             #endif
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
                             return soul::parser::Match(true, unionExpr.release());
                         }
                     }
@@ -1019,6 +1091,9 @@ soul::parser::Match XPathParser<LexerT>::UnaryExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "UnaryExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -1039,6 +1114,9 @@ soul::parser::Match XPathParser<LexerT>::UnionExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127433);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127433);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> left;
     std::unique_ptr<soul::xml::xpath::expr::Expr> right;
@@ -1139,6 +1217,9 @@ soul::parser::Match XPathParser<LexerT>::UnionExpr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "UnionExpr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -1151,6 +1232,9 @@ soul::parser::Match XPathParser<LexerT>::UnionExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "UnionExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -1171,6 +1255,9 @@ soul::parser::Match XPathParser<LexerT>::PathExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127434);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127434);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> locationPath;
     std::unique_ptr<soul::xml::xpath::expr::Expr> functionCall;
@@ -1225,6 +1312,9 @@ soul::parser::Match XPathParser<LexerT>::PathExpr(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PathExpr");
                         #endif
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
                         return soul::parser::Match(true, locationPath.release());
                     }
                 }
@@ -1314,6 +1404,9 @@ soul::parser::Match XPathParser<LexerT>::PathExpr(LexerT& lexer)
                                                                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                                                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PathExpr");
                                                                 #endif
+                                                                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                                                ruleProfileGuard.SetSuccess();
+                                                                #endif
                                                                 return soul::parser::Match(true, new soul::xml::xpath::expr::BinaryExpr(soul::xml::xpath::expr::Operator::slash, expr.release(), right.release()));
                                                             }
                                                         }
@@ -1322,6 +1415,9 @@ soul::parser::Match XPathParser<LexerT>::PathExpr(LexerT& lexer)
                                                                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                                                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PathExpr");
                                                                 #endif
+                                                                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                                                ruleProfileGuard.SetSuccess();
+                                                                #endif
                                                                 return soul::parser::Match(true, soul::xml::xpath::expr::MakeSlashSlashExpr(expr.release(), right.release()));
                                                             }
                                                         }
@@ -1348,6 +1444,9 @@ soul::parser::Match XPathParser<LexerT>::PathExpr(LexerT& lexer)
                                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PathExpr");
                                         #endif
+                                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                        ruleProfileGuard.SetSuccess();
+                                        #endif
                                         return soul::parser::Match(true, expr.release());
                                     }
                                 }
@@ -1371,6 +1470,9 @@ soul::parser::Match XPathParser<LexerT>::PathExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "PathExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -1391,6 +1493,9 @@ soul::parser::Match XPathParser<LexerT>::LocationPath(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127435);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127435);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> absoluteLocationPath;
     std::unique_ptr<soul::xml::xpath::expr::Expr> relativeLocationPath;
     soul::parser::Match match(false);
@@ -1409,6 +1514,9 @@ soul::parser::Match XPathParser<LexerT>::LocationPath(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "LocationPath");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, absoluteLocationPath.release());
                 }
             }
@@ -1433,6 +1541,9 @@ soul::parser::Match XPathParser<LexerT>::LocationPath(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "LocationPath");
                             #endif
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
                             return soul::parser::Match(true, relativeLocationPath.release());
                         }
                     }
@@ -1450,6 +1561,9 @@ soul::parser::Match XPathParser<LexerT>::LocationPath(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "LocationPath");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -1470,6 +1584,9 @@ soul::parser::Match XPathParser<LexerT>::AbsoluteLocationPath(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127436);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127436);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> abbreviatedAbsoluteLocationPath;
     std::unique_ptr<soul::xml::xpath::expr::Expr> right;
@@ -1576,6 +1693,9 @@ soul::parser::Match XPathParser<LexerT>::AbsoluteLocationPath(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AbsoluteLocationPath");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -1588,6 +1708,9 @@ soul::parser::Match XPathParser<LexerT>::AbsoluteLocationPath(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AbsoluteLocationPath");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -1608,6 +1731,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedAbsoluteLocationPath(LexerT&
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127437);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127437);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> right;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
@@ -1637,6 +1763,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedAbsoluteLocationPath(LexerT&
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AbbreviatedAbsoluteLocationPath");
                         #endif
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
                         return soul::parser::Match(true, soul::xml::xpath::expr::MakeSlashSlashExpr(new soul::xml::xpath::expr::Root, right.release()));
                     }
                 }
@@ -1653,6 +1782,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedAbsoluteLocationPath(LexerT&
         else soul::lexer::WriteFailureToLog(lexer, "AbbreviatedAbsoluteLocationPath");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -1673,6 +1805,9 @@ soul::parser::Match XPathParser<LexerT>::RelativeLocationPath(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127438);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127438);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> left;
     std::unique_ptr<soul::parser::Value<soul::xml::xpath::expr::Operator>> op;
@@ -1785,6 +1920,9 @@ soul::parser::Match XPathParser<LexerT>::RelativeLocationPath(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "RelativeLocationPath");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -1797,6 +1935,9 @@ soul::parser::Match XPathParser<LexerT>::RelativeLocationPath(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "RelativeLocationPath");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -1817,8 +1958,11 @@ soul::parser::Match XPathParser<LexerT>::Step(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127439);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127439);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::LocationStepExpr> expr = std::unique_ptr<soul::xml::xpath::expr::LocationStepExpr>();
-    std::unique_ptr<soul::parser::Value<soul::xml::Axis>> axis;
+    soul::parser::InlineValue<soul::xml::Axis> axis;
     std::unique_ptr<soul::xml::xpath::expr::NodeTest> nodeTest;
     std::unique_ptr<soul::xml::xpath::expr::Expr> predicate;
     std::unique_ptr<soul::xml::xpath::expr::LocationStepExpr> abbreviatedStep;
@@ -1840,7 +1984,7 @@ soul::parser::Match XPathParser<LexerT>::Step(LexerT& lexer)
                     soul::parser::Match* parentMatch4 = &match;
                     {
                         soul::parser::Match match = XPathParser<LexerT>::AxisSpecifier(lexer);
-                        axis.reset(static_cast<soul::parser::Value<soul::xml::Axis>*>(match.value));
+                        axis = match.GetInlineValue<soul::xml::Axis>();
                         *parentMatch4 = match;
                     }
                     if (match.hit)
@@ -1856,7 +2000,7 @@ soul::parser::Match XPathParser<LexerT>::Step(LexerT& lexer)
                                 nodeTest.reset(static_cast<soul::xml::xpath::expr::NodeTest*>(match.value));
                                 if (match.hit)
                                 {
-                                    expr.reset(new soul::xml::xpath::expr::LocationStepExpr(axis->value, nodeTest.release()));
+                                    expr.reset(new soul::xml::xpath::expr::LocationStepExpr(axis.value, nodeTest.release()));
                                 }
                                 *parentMatch6 = match;
                             }
@@ -1943,6 +2087,9 @@ soul::parser::Match XPathParser<LexerT>::Step(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Step");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -1955,6 +2102,9 @@ soul::parser::Match XPathParser<LexerT>::Step(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "Step");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -1975,8 +2125,11 @@ soul::parser::Match XPathParser<LexerT>::AxisSpecifier(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127440);
-    std::unique_ptr<soul::parser::Value<soul::xml::Axis>> axis;
-    std::unique_ptr<soul::parser::Value<soul::xml::Axis>> abbreviatedAxisSpecifier;
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127440);
+    #endif
+    soul::parser::InlineValue<soul::xml::Axis> axis;
+    soul::parser::InlineValue<soul::xml::Axis> abbreviatedAxisSpecifier;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -1985,7 +2138,7 @@ soul::parser::Match XPathParser<LexerT>::AxisSpecifier(LexerT& lexer)
         soul::parser::Match* parentMatch1 = &match;
         {
             soul::parser::Match match = XPathParser<LexerT>::AxisName(lexer);
-            axis.reset(static_cast<soul::parser::Value<soul::xml::Axis>*>(match.value));
+            axis = match.GetInlineValue<soul::xml::Axis>();
             *parentMatch1 = match;
         }
         if (match.hit)
@@ -2009,7 +2162,10 @@ soul::parser::Match XPathParser<LexerT>::AxisSpecifier(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisSpecifier");
                             #endif
-                            return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(axis->value));
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
+                            return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(axis.value));
                         }
                     }
                     *parentMatch3 = match;
@@ -2030,14 +2186,17 @@ soul::parser::Match XPathParser<LexerT>::AxisSpecifier(LexerT& lexer)
                 {
                     int64_t pos = lexer.GetPos();
                     soul::parser::Match match = XPathParser<LexerT>::AbbreviatedAxisSpecifier(lexer);
-                    abbreviatedAxisSpecifier.reset(static_cast<soul::parser::Value<soul::xml::Axis>*>(match.value));
+                    abbreviatedAxisSpecifier = match.GetInlineValue<soul::xml::Axis>();
                     if (match.hit)
                     {
                         {
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisSpecifier");
                             #endif
-                            return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(abbreviatedAxisSpecifier->value));
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
+                            return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(abbreviatedAxisSpecifier.value));
                         }
                     }
                     *parentMatch5 = match;
@@ -2054,6 +2213,9 @@ soul::parser::Match XPathParser<LexerT>::AxisSpecifier(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AxisSpecifier");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2074,6 +2236,9 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127441);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127441);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -2094,7 +2259,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::ancestor));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::ancestor));
                     }
                 }
                 case ANCESTOR_OR_SELF: {
@@ -2102,7 +2270,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::ancestorOrSelf));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::ancestorOrSelf));
                     }
                 }
                 case ATTRIBUTE: {
@@ -2110,7 +2281,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::attribute));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::attribute));
                     }
                 }
                 case CHILD: {
@@ -2118,7 +2292,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::child));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::child));
                     }
                 }
                 case DESCENDANT: {
@@ -2126,7 +2303,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::descendant));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::descendant));
                     }
                 }
                 case DESCENDANT_OR_SELF: {
@@ -2134,7 +2314,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::descendantOrSelf));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::descendantOrSelf));
                     }
                 }
                 case FOLLOWING: {
@@ -2142,7 +2325,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::following));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::following));
                     }
                 }
                 case FOLLOWING_SIBLING: {
@@ -2150,7 +2336,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::followingSibling));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::followingSibling));
                     }
                 }
                 case NAMESPACE: {
@@ -2158,7 +2347,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::ns));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::ns));
                     }
                 }
                 case PARENT: {
@@ -2166,7 +2358,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::parent));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::parent));
                     }
                 }
                 case PRECEDING: {
@@ -2174,7 +2369,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::preceding));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::preceding));
                     }
                 }
                 case PRECEDING_SIBLING: {
@@ -2182,7 +2380,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::precedingSibling));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::precedingSibling));
                     }
                 }
                 case SELF: {
@@ -2190,7 +2391,10 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AxisName");
                         #endif
-                        return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::self));
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
+                        return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::self));
                     }
                 }
                 default: {
@@ -2212,6 +2416,9 @@ soul::parser::Match XPathParser<LexerT>::AxisName(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AxisName");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2232,6 +2439,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedAxisSpecifier(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127442);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127442);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -2252,7 +2462,10 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedAxisSpecifier(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AbbreviatedAxisSpecifier");
                     #endif
-                    return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::attribute));
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
+                    return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::attribute));
                 }
             }
             *parentMatch1 = match;
@@ -2275,7 +2488,10 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedAxisSpecifier(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AbbreviatedAxisSpecifier");
                             #endif
-                            return soul::parser::Match(true, new soul::parser::Value<soul::xml::Axis>(soul::xml::Axis::child));
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
+                            return soul::parser::Match(true, soul::parser::InlineValue<soul::xml::Axis>(soul::xml::Axis::child));
                         }
                     }
                     *parentMatch3 = match;
@@ -2292,6 +2508,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedAxisSpecifier(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AbbreviatedAxisSpecifier");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2312,6 +2531,9 @@ soul::parser::Match XPathParser<LexerT>::NodeTest(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127443);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127443);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Literal> pi;
     std::unique_ptr<soul::xml::xpath::expr::NodeTest> nodeType;
     std::unique_ptr<soul::xml::xpath::expr::NodeTest> nameTest;
@@ -2398,6 +2620,9 @@ soul::parser::Match XPathParser<LexerT>::NodeTest(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NodeTest");
                             #endif
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
                             return soul::parser::Match(true, new soul::xml::xpath::expr::PILiteralNodeTest(pi.release()));
                         }
                     }
@@ -2467,6 +2692,9 @@ soul::parser::Match XPathParser<LexerT>::NodeTest(LexerT& lexer)
                                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NodeTest");
                                     #endif
+                                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                    ruleProfileGuard.SetSuccess();
+                                    #endif
                                     return soul::parser::Match(true, nodeType.release());
                                 }
                             }
@@ -2501,6 +2729,9 @@ soul::parser::Match XPathParser<LexerT>::NodeTest(LexerT& lexer)
                                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NodeTest");
                                 #endif
+                                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                ruleProfileGuard.SetSuccess();
+                                #endif
                                 return soul::parser::Match(true, nameTest.release());
                             }
                         }
@@ -2520,6 +2751,9 @@ soul::parser::Match XPathParser<LexerT>::NodeTest(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "NodeTest");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2540,6 +2774,9 @@ soul::parser::Match XPathParser<LexerT>::Literal(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127444);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127444);
+    #endif
     soul::parser::Match match(false);
     int64_t pos = lexer.GetPos();
     switch (*lexer)
@@ -2552,6 +2789,9 @@ soul::parser::Match XPathParser<LexerT>::Literal(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Literal");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::xml::xpath::expr::Literal(soul::xml::xpath::token::parser::ParseDQString(lexer.FileName(), lexer.GetToken(pos))));
                 }
             }
@@ -2565,6 +2805,9 @@ soul::parser::Match XPathParser<LexerT>::Literal(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Literal");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::xml::xpath::expr::Literal(soul::xml::xpath::token::parser::ParseSQString(lexer.FileName(), lexer.GetToken(pos))));
                 }
             }
@@ -2578,6 +2821,9 @@ soul::parser::Match XPathParser<LexerT>::Literal(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "Literal");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2598,6 +2844,9 @@ soul::parser::Match XPathParser<LexerT>::NodeType(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127445);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127445);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -2618,6 +2867,9 @@ soul::parser::Match XPathParser<LexerT>::NodeType(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NodeType");
                         #endif
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
                         return soul::parser::Match(true, new soul::xml::xpath::expr::NodeTest(soul::xml::xpath::expr::NodeTestKind::commentNodeTest));
                     }
                 }
@@ -2626,6 +2878,9 @@ soul::parser::Match XPathParser<LexerT>::NodeType(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NodeType");
                         #endif
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
                         return soul::parser::Match(true, new soul::xml::xpath::expr::NodeTest(soul::xml::xpath::expr::NodeTestKind::textNodeTest));
                     }
                 }
@@ -2634,6 +2889,9 @@ soul::parser::Match XPathParser<LexerT>::NodeType(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NodeType");
                         #endif
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
                         return soul::parser::Match(true, new soul::xml::xpath::expr::NodeTest(soul::xml::xpath::expr::NodeTestKind::piNodeTest));
                     }
                 }
@@ -2642,6 +2900,9 @@ soul::parser::Match XPathParser<LexerT>::NodeType(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NodeType");
                         #endif
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
                         return soul::parser::Match(true, new soul::xml::xpath::expr::NodeTest(soul::xml::xpath::expr::NodeTestKind::anyNodeTest));
                     }
                 }
@@ -2664,6 +2925,9 @@ soul::parser::Match XPathParser<LexerT>::NodeType(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "NodeType");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2684,6 +2948,9 @@ soul::parser::Match XPathParser<LexerT>::NameTest(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127446);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127446);
+    #endif
     std::unique_ptr<soul::parser::Value<std::string>> ncname;
     std::unique_ptr<soul::parser::Value<std::string>> qname;
     soul::parser::Match match(false);
@@ -2710,6 +2977,9 @@ soul::parser::Match XPathParser<LexerT>::NameTest(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NameTest");
                         #endif
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
                         return soul::parser::Match(true, new soul::xml::xpath::expr::NodeTest(soul::xml::xpath::expr::NodeTestKind::principalNodeTest));
                     }
                 }
@@ -2770,6 +3040,9 @@ soul::parser::Match XPathParser<LexerT>::NameTest(LexerT& lexer)
                                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NameTest");
                                         #endif
+                                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                        ruleProfileGuard.SetSuccess();
+                                        #endif
                                         return soul::parser::Match(true, new soul::xml::xpath::expr::PrefixNodeTest(ncname->value));
                                     }
                                 }
@@ -2803,6 +3076,9 @@ soul::parser::Match XPathParser<LexerT>::NameTest(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NameTest");
                             #endif
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
                             return soul::parser::Match(true, new soul::xml::xpath::expr::NameNodeTest(qname->value));
                         }
                     }
@@ -2820,6 +3096,9 @@ soul::parser::Match XPathParser<LexerT>::NameTest(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "NameTest");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2840,6 +3119,9 @@ soul::parser::Match XPathParser<LexerT>::NCName(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127447);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127447);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -2856,6 +3138,9 @@ soul::parser::Match XPathParser<LexerT>::NCName(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "NCName");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, new soul::parser::Value<std::string>(util::ToUtf8(lexer.GetToken(pos).ToString())));
             }
         }
@@ -2868,6 +3153,9 @@ soul::parser::Match XPathParser<LexerT>::NCName(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "NCName");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2888,6 +3176,9 @@ soul::parser::Match XPathParser<LexerT>::QName(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127448);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127448);
+    #endif
     std::unique_ptr<soul::parser::Value<std::string>> prefixedName;
     std::unique_ptr<soul::parser::Value<std::string>> unprefixedName;
     soul::parser::Match match(false);
@@ -2906,6 +3197,9 @@ soul::parser::Match XPathParser<LexerT>::QName(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "QName");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<std::string>(prefixedName->value));
                 }
             }
@@ -2930,6 +3224,9 @@ soul::parser::Match XPathParser<LexerT>::QName(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "QName");
                             #endif
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
                             return soul::parser::Match(true, new soul::parser::Value<std::string>(unprefixedName->value));
                         }
                     }
@@ -2947,6 +3244,9 @@ soul::parser::Match XPathParser<LexerT>::QName(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "QName");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -2967,6 +3267,9 @@ soul::parser::Match XPathParser<LexerT>::PrefixedName(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127449);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127449);
+    #endif
     std::unique_ptr<soul::parser::Value<std::string>> prefix;
     std::unique_ptr<soul::parser::Value<std::string>> localPart;
     soul::parser::Match match(false);
@@ -3022,6 +3325,9 @@ soul::parser::Match XPathParser<LexerT>::PrefixedName(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PrefixedName");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, new soul::parser::Value<std::string>(prefix->value + ":" + localPart->value));
             }
         }
@@ -3034,6 +3340,9 @@ soul::parser::Match XPathParser<LexerT>::PrefixedName(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "PrefixedName");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3054,6 +3363,9 @@ soul::parser::Match XPathParser<LexerT>::Prefix(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127450);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127450);
+    #endif
     std::unique_ptr<soul::parser::Value<std::string>> ncname;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
@@ -3067,6 +3379,9 @@ soul::parser::Match XPathParser<LexerT>::Prefix(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Prefix");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, new soul::parser::Value<std::string>(ncname->value));
             }
         }
@@ -3079,6 +3394,9 @@ soul::parser::Match XPathParser<LexerT>::Prefix(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "Prefix");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3099,6 +3417,9 @@ soul::parser::Match XPathParser<LexerT>::UnprefixedName(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127451);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127451);
+    #endif
     std::unique_ptr<soul::parser::Value<std::string>> localPart;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
@@ -3112,6 +3433,9 @@ soul::parser::Match XPathParser<LexerT>::UnprefixedName(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "UnprefixedName");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, new soul::parser::Value<std::string>(localPart->value));
             }
         }
@@ -3124,6 +3448,9 @@ soul::parser::Match XPathParser<LexerT>::UnprefixedName(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "UnprefixedName");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3144,6 +3471,9 @@ soul::parser::Match XPathParser<LexerT>::LocalPart(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127452);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127452);
+    #endif
     std::unique_ptr<soul::parser::Value<std::string>> ncname;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
@@ -3157,6 +3487,9 @@ soul::parser::Match XPathParser<LexerT>::LocalPart(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "LocalPart");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, new soul::parser::Value<std::string>(ncname->value));
             }
         }
@@ -3169,6 +3502,9 @@ soul::parser::Match XPathParser<LexerT>::LocalPart(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "LocalPart");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3189,6 +3525,9 @@ soul::parser::Match XPathParser<LexerT>::Predicate(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127453);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127453);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
@@ -3247,6 +3586,9 @@ soul::parser::Match XPathParser<LexerT>::Predicate(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Predicate");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -3259,6 +3601,9 @@ soul::parser::Match XPathParser<LexerT>::Predicate(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "Predicate");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3279,6 +3624,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedStep(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127454);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127454);
+    #endif
     soul::parser::Match match(false);
     int64_t pos = lexer.GetPos();
     switch (*lexer)
@@ -3291,6 +3639,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedStep(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AbbreviatedStep");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::xml::xpath::expr::LocationStepExpr(soul::xml::Axis::parent, new soul::xml::xpath::expr::NodeTest(soul::xml::xpath::expr::NodeTestKind::anyNodeTest)));
                 }
             }
@@ -3304,6 +3655,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedStep(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AbbreviatedStep");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::xml::xpath::expr::LocationStepExpr(soul::xml::Axis::self, new soul::xml::xpath::expr::NodeTest(soul::xml::xpath::expr::NodeTestKind::anyNodeTest)));
                 }
             }
@@ -3317,6 +3671,9 @@ soul::parser::Match XPathParser<LexerT>::AbbreviatedStep(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AbbreviatedStep");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3337,6 +3694,9 @@ soul::parser::Match XPathParser<LexerT>::FunctionCall(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127455);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127455);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::FunctionCall> functionCall = std::unique_ptr<soul::xml::xpath::expr::FunctionCall>();
     std::unique_ptr<soul::parser::Value<std::string>> functionName;
     std::unique_ptr<soul::xml::xpath::expr::Expr> arg;
@@ -3516,6 +3876,9 @@ soul::parser::Match XPathParser<LexerT>::FunctionCall(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "FunctionCall");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, functionCall.release());
             }
         }
@@ -3528,6 +3891,9 @@ soul::parser::Match XPathParser<LexerT>::FunctionCall(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "FunctionCall");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3548,6 +3914,9 @@ soul::parser::Match XPathParser<LexerT>::FunctionName(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127456);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127456);
+    #endif
     std::unique_ptr<soul::parser::Value<std::string>> qname;
     std::unique_ptr<soul::xml::xpath::expr::NodeTest> nodeType;
     soul::parser::Match match(false);
@@ -3591,6 +3960,9 @@ soul::parser::Match XPathParser<LexerT>::FunctionName(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "FunctionName");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, new soul::parser::Value<std::string>(qname->value));
             }
         }
@@ -3603,6 +3975,9 @@ soul::parser::Match XPathParser<LexerT>::FunctionName(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "FunctionName");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3623,6 +3998,9 @@ soul::parser::Match XPathParser<LexerT>::Argument(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127457);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127457);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
@@ -3636,6 +4014,9 @@ soul::parser::Match XPathParser<LexerT>::Argument(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Argument");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -3648,6 +4029,9 @@ soul::parser::Match XPathParser<LexerT>::Argument(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "Argument");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3668,6 +4052,9 @@ soul::parser::Match XPathParser<LexerT>::FilterExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127458);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127458);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr = std::unique_ptr<soul::xml::xpath::expr::Expr>();
     std::unique_ptr<soul::xml::xpath::expr::Expr> primaryExpr;
     std::unique_ptr<soul::xml::xpath::expr::Expr> predicate;
@@ -3748,6 +4135,9 @@ soul::parser::Match XPathParser<LexerT>::FilterExpr(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "FilterExpr");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, expr.release());
             }
         }
@@ -3760,6 +4150,9 @@ soul::parser::Match XPathParser<LexerT>::FilterExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "FilterExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -3780,6 +4173,9 @@ soul::parser::Match XPathParser<LexerT>::PrimaryExpr(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127459);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127459);
+    #endif
     std::unique_ptr<soul::xml::xpath::expr::Expr> functionCall;
     std::unique_ptr<soul::xml::xpath::expr::Expr> variableReference;
     std::unique_ptr<soul::xml::xpath::expr::Expr> expr;
@@ -3813,6 +4209,9 @@ soul::parser::Match XPathParser<LexerT>::PrimaryExpr(LexerT& lexer)
                                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PrimaryExpr");
                                 #endif
+                                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                ruleProfileGuard.SetSuccess();
+                                #endif
                                 return soul::parser::Match(true, functionCall.release());
                             }
                         }
@@ -3837,6 +4236,9 @@ soul::parser::Match XPathParser<LexerT>::PrimaryExpr(LexerT& lexer)
                                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PrimaryExpr");
                                         #endif
+                                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                        ruleProfileGuard.SetSuccess();
+                                        #endif
                                         return soul::parser::Match(true, variableReference.release());
                                     }
                                 }
@@ -3911,6 +4313,9 @@ soul::parser::Match XPathParser<LexerT>::PrimaryExpr(LexerT& lexer)
                                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PrimaryExpr");
                                     #endif
+                                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                    ruleProfileGuard.SetSuccess();
+                                    #endif
                                     return soul::parser::Match(true, new soul::xml::xpath::expr::UnaryExpr(soul::xml::xpath::expr::Operator::parens, expr.release()));
                                 }
                             }
@@ -3940,6 +4345,9 @@ soul::parser::Match XPathParser<LexerT>::PrimaryExpr(LexerT& lexer)
                                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PrimaryExpr");
                                 #endif
+                                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                ruleProfileGuard.SetSuccess();
+                                #endif
                                 return soul::parser::Match(true, literal.release());
                             }
                         }
@@ -3969,6 +4377,9 @@ soul::parser::Match XPathParser<LexerT>::PrimaryExpr(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "PrimaryExpr");
                             #endif
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
                             return soul::parser::Match(true, number.release());
                         }
                     }
@@ -3986,6 +4397,9 @@ soul::parser::Match XPathParser<LexerT>::PrimaryExpr(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "PrimaryExpr");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4006,6 +4420,9 @@ soul::parser::Match XPathParser<LexerT>::VariableReference(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127460);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127460);
+    #endif
     std::unique_ptr<soul::parser::Value<std::string>> qname;
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
@@ -4044,6 +4461,9 @@ soul::parser::Match XPathParser<LexerT>::VariableReference(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "VariableReference");
                 #endif
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
                 return soul::parser::Match(true, new soul::xml::xpath::expr::VariableReference(qname->value));
             }
         }
@@ -4056,6 +4476,9 @@ soul::parser::Match XPathParser<LexerT>::VariableReference(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "VariableReference");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4076,6 +4499,9 @@ soul::parser::Match XPathParser<LexerT>::Number(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127461);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127461);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -4092,7 +4518,10 @@ soul::parser::Match XPathParser<LexerT>::Number(LexerT& lexer)
                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "Number");
                 #endif
-                return soul::parser::Match(true, new soul::xml::xpath::expr::NumberExpr(lexer.GetToken(pos).ToDouble()));
+                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                ruleProfileGuard.SetSuccess();
+                #endif
+                return soul::parser::Match(true, new soul::xml::xpath::expr::NumberExpr(lexer.GetToken(pos).ToDouble(&lexer)));
             }
         }
         *parentMatch0 = match;
@@ -4104,6 +4533,9 @@ soul::parser::Match XPathParser<LexerT>::Number(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "Number");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4124,6 +4556,9 @@ soul::parser::Match XPathParser<LexerT>::EqualityOp(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127462);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127462);
+    #endif
     soul::parser::Match match(false);
     int64_t pos = lexer.GetPos();
     switch (*lexer)
@@ -4136,6 +4571,9 @@ soul::parser::Match XPathParser<LexerT>::EqualityOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EqualityOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::equal));
                 }
             }
@@ -4149,6 +4587,9 @@ soul::parser::Match XPathParser<LexerT>::EqualityOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "EqualityOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::notEqual));
                 }
             }
@@ -4162,6 +4603,9 @@ soul::parser::Match XPathParser<LexerT>::EqualityOp(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "EqualityOp");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4182,6 +4626,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalOp(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127463);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127463);
+    #endif
     soul::parser::Match match(false);
     int64_t pos = lexer.GetPos();
     switch (*lexer)
@@ -4194,6 +4641,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "RelationalOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::less));
                 }
             }
@@ -4207,6 +4657,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "RelationalOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::greater));
                 }
             }
@@ -4220,6 +4673,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "RelationalOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::lessOrEqual));
                 }
             }
@@ -4233,6 +4689,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "RelationalOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::greaterOrEqual));
                 }
             }
@@ -4246,6 +4705,9 @@ soul::parser::Match XPathParser<LexerT>::RelationalOp(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "RelationalOp");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4266,6 +4728,9 @@ soul::parser::Match XPathParser<LexerT>::AdditiveOp(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127464);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127464);
+    #endif
     soul::parser::Match match(false);
     int64_t pos = lexer.GetPos();
     switch (*lexer)
@@ -4278,6 +4743,9 @@ soul::parser::Match XPathParser<LexerT>::AdditiveOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AdditiveOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::plus));
                 }
             }
@@ -4291,6 +4759,9 @@ soul::parser::Match XPathParser<LexerT>::AdditiveOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "AdditiveOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::minus));
                 }
             }
@@ -4304,6 +4775,9 @@ soul::parser::Match XPathParser<LexerT>::AdditiveOp(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AdditiveOp");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4324,6 +4798,9 @@ soul::parser::Match XPathParser<LexerT>::MultiplicativeOp(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127465);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127465);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -4348,6 +4825,9 @@ soul::parser::Match XPathParser<LexerT>::MultiplicativeOp(LexerT& lexer)
                         #ifdef SOUL_PARSER_DEBUG_SUPPORT
                         if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "MultiplicativeOp");
                         #endif
+                        #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                        ruleProfileGuard.SetSuccess();
+                        #endif
                         return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::mul));
                     }
                 }
@@ -4371,6 +4851,9 @@ soul::parser::Match XPathParser<LexerT>::MultiplicativeOp(LexerT& lexer)
                                 #ifdef SOUL_PARSER_DEBUG_SUPPORT
                                 if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "MultiplicativeOp");
                                 #endif
+                                #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                                ruleProfileGuard.SetSuccess();
+                                #endif
                                 return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::div));
                             }
                         }
@@ -4399,6 +4882,9 @@ soul::parser::Match XPathParser<LexerT>::MultiplicativeOp(LexerT& lexer)
                             #ifdef SOUL_PARSER_DEBUG_SUPPORT
                             if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "MultiplicativeOp");
                             #endif
+                            #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                            ruleProfileGuard.SetSuccess();
+                            #endif
                             return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::mod));
                         }
                     }
@@ -4416,6 +4902,9 @@ soul::parser::Match XPathParser<LexerT>::MultiplicativeOp(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "MultiplicativeOp");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4436,6 +4925,9 @@ soul::parser::Match XPathParser<LexerT>::CombinePathOp(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127466);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127466);
+    #endif
     soul::parser::Match match(false);
     int64_t pos = lexer.GetPos();
     switch (*lexer)
@@ -4448,6 +4940,9 @@ soul::parser::Match XPathParser<LexerT>::CombinePathOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "CombinePathOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::slash));
                 }
             }
@@ -4461,6 +4956,9 @@ soul::parser::Match XPathParser<LexerT>::CombinePathOp(LexerT& lexer)
                     #ifdef SOUL_PARSER_DEBUG_SUPPORT
                     if (parser_debug_write_to_log) soul::lexer::WriteSuccessToLog(lexer, parser_debug_match_pos, "CombinePathOp");
                     #endif
+                    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+                    ruleProfileGuard.SetSuccess();
+                    #endif
                     return soul::parser::Match(true, new soul::parser::Value<soul::xml::xpath::expr::Operator>(soul::xml::xpath::expr::Operator::slashSlash));
                 }
             }
@@ -4474,6 +4972,9 @@ soul::parser::Match XPathParser<LexerT>::CombinePathOp(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "CombinePathOp");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4494,6 +4995,9 @@ soul::parser::Match XPathParser<LexerT>::OrKeyword(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127467);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127467);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -4522,6 +5026,9 @@ soul::parser::Match XPathParser<LexerT>::OrKeyword(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "OrKeyword");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4542,6 +5049,9 @@ soul::parser::Match XPathParser<LexerT>::AndKeyword(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127468);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127468);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -4570,6 +5080,9 @@ soul::parser::Match XPathParser<LexerT>::AndKeyword(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "AndKeyword");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4590,6 +5103,9 @@ soul::parser::Match XPathParser<LexerT>::DivKeyword(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127469);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127469);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -4618,6 +5134,9 @@ soul::parser::Match XPathParser<LexerT>::DivKeyword(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "DivKeyword");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4638,6 +5157,9 @@ soul::parser::Match XPathParser<LexerT>::ModKeyword(LexerT& lexer)
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127470);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127470);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -4666,6 +5188,9 @@ soul::parser::Match XPathParser<LexerT>::ModKeyword(LexerT& lexer)
         else soul::lexer::WriteFailureToLog(lexer, "ModKeyword");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -4686,6 +5211,9 @@ soul::parser::Match XPathParser<LexerT>::ProcessingInstructionKeyword(LexerT& le
     }
     #endif
     soul::lexer::RuleGuard<LexerT> ruleGuard(lexer, 6774979419569127471);
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    soul::lexer::RuleProfileGuard<LexerT> ruleProfileGuard(lexer, 6774979419569127471);
+    #endif
     soul::parser::Match match(false);
     soul::parser::Match* parentMatch0 = &match;
     {
@@ -4714,6 +5242,9 @@ soul::parser::Match XPathParser<LexerT>::ProcessingInstructionKeyword(LexerT& le
         else soul::lexer::WriteFailureToLog(lexer, "ProcessingInstructionKeyword");
     }
     #endif
+    #ifdef SOUL_PARSER_PROFILING_SUPPORT
+    if (match.hit) ruleProfileGuard.SetSuccess();
+    #endif
     if (!match.hit)
     {
         match.value = nullptr;
@@ -31,9 +31,6 @@ void Diagram::SetCanvas(Canvas* canvas_)
 
 void Diagram::Save(const std::string& filePath)
 {
-    std::ofstream file(filePath);
-    util::CodeFormatter formatter(file);
-    formatter.SetIndentSize(1);
     soul::xml::Document diagramDoc;
     soul::xml::Element* diagramElement = soul::xml::MakeElement("diagram");
     std::vector<ContainerElement*> containerElements;
@@ -65,7 +62,10 @@ void Diagram::Save(const std::string& filePath)
         diagramElement->AppendChild(relationshipElement->ToXml());
     }
     diagramDoc.AppendChild(diagramElement);
-    diagramDoc.Write(formatter);
+    util::FileStream file(filePath, util::OpenMode::write);
+    soul::xml::XmlSerializer serializer(file);
+    serializer.SetIndentSize(1);
+    serializer.Write(&diagramDoc);
 }
 
 void Diagram::Load(const std::string& filePath)
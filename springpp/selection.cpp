@@ -207,10 +207,7 @@ std::u32string Selection::Copy()
         std::unique_ptr<soul::xml::Element> xmlElement(clonedElement->ToXml());
         elementDoc.DocumentElement()->AppendChild(xmlElement.release());
     }
-    std::stringstream strstream;
-    util::CodeFormatter formatter(strstream);
-    elementDoc.Write(formatter);
-    return util::ToUtf32(strstream.str());
+    return util::ToUtf32(soul::xml::ToXmlString(&elementDoc, true));
 }
 
 void Selection::SaveImage(const std::string& fileName, const Padding& margins, wing::ImageFormat imageFormat)
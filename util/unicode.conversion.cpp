@@ -3,6 +3,12 @@
 // Distributed under the MIT license
 // =================================
 
+module;
+#if (defined(_M_X64) && !defined(_M_ARM64EC)) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTIL_UNICODE_SSE2
+#endif
+
 module util.unicode;
 
 import std.core;
@@ -23,52 +29,103 @@ void ThrowInvalidUtf8Sequence()
     throw UnicodeException("invalid UTF-8 sequence");
 }
 
-std::u32string ToUtf32(const std::string& utf8Str)
+//  ===================================================================================================
+//  The conversions run in two phases: a block kernel converts runs of characters that map one to one
+//  (ASCII for UTF-8, non-surrogates for UTF-16) a vector at a time, and a scalar decoder or encoder
+//  handles the rest one sequence at a time. The result string is sized once up front. The kernels use
+//  SSE2, which every x64 target has, and a 64-bit word at a time on other targets.
+//  ===================================================================================================
+
+inline std::size_t AsciiPrefixLength(const char* p, std::size_t n)
 {
-    std::u32string result;
-    const char* p = utf8Str.c_str();
-    int bytesRemaining = int(utf8Str.length());
-    while (bytesRemaining > 0)
+    std::size_t i = 0;
+#ifdef UTIL_UNICODE_SSE2
+    while (i + 16 <= n)
     {
-        char8_t c = *p;
-        uint8_t x = static_cast<uint8_t>(c);
-        if ((x & 0x80u) == 0u)
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(v));
+        if (mask != 0)
         {
-            result.append(1, static_cast<char32_t>(static_cast<uint32_t>(x)));
-            --bytesRemaining;
-            ++p;
+            return i + std::countr_zero(mask);
         }
-        else if ((x & 0xE0u) == 0xC0u)
+        i += 16;
+    }
+#endif
+    while (i + 8 <= n)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, p + i, 8);
+        uint64_t high = word & 0x8080808080808080ull;
+        if (high != 0)
+        {
+            return i + std::countr_zero(high) / 8;
+        }
+        i += 8;
+    }
+    while (i < n && (static_cast<uint8_t>(p[i]) & 0x80u) == 0)
+    {
+        ++i;
+    }
+    return i;
+}
+
+inline void WidenAscii(const char* p, std::size_t n, char32_t* out)
+{
+    std::size_t i = 0;
+#ifdef UTIL_UNICODE_SSE2
+    __m128i zero = _mm_setzero_si128();
+    while (i + 16 <= n)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 12), _mm_unpackhi_epi16(hi, zero));
+        i += 16;
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        out[i] = static_cast<char32_t>(static_cast<uint8_t>(p[i]));
+    }
+}
+
+inline uint8_t Utf8ContinuationByte(const char* p)
+{
+    uint8_t b = static_cast<uint8_t>(*p);
+    if ((b & 0xC0u) != 0x80u)
+    {
+        ThrowInvalidUtf8Sequence();
+    }
+    return b & 0x3Fu;
+}
+
+std::u32string ToUtf32(const std::string& utf8Str)
+{
+    std::u32string result;
+    result.resize(utf8Str.length());
+    char32_t* out = result.data();
+    const char* p = utf8Str.data();
+    const char* end = p + utf8Str.length();
+    while (p != end)
+    {
+        std::size_t ascii = AsciiPrefixLength(p, end - p);
+        WidenAscii(p, ascii, out);
+        p += ascii;
+        out += ascii;
+        if (p == end) break;
+        uint32_t x = static_cast<uint8_t>(*p);
+        std::ptrdiff_t bytesRemaining = end - p;
+        if ((x & 0xE0u) == 0xC0u)
         {
             if (bytesRemaining < 2)
             {
                 ThrowInvalidUtf8Sequence();
             }
-            char32_t u = static_cast<char32_t>(static_cast<uint32_t>(0u));
-            uint8_t b1 = static_cast<uint8_t>(p[1]);
-            if ((b1 & 0xC0u) != 0x80u)
-            {
-                ThrowInvalidUtf8Sequence();
-            }
-            uint8_t shift = 0u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b1 & 1u;
-                b1 = b1 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b0 = x;
-            for (uint8_t i = 0u; i < 5u; ++i)
-            {
-                uint8_t bit = b0 & 1u;
-                b0 = b0 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            result.append(1, u);
-            bytesRemaining = bytesRemaining - 2;
-            p = p + 2;
+            *out++ = static_cast<char32_t>(((x & 0x1Fu) << 6) | Utf8ContinuationByte(p + 1));
+            p += 2;
         }
         else if ((x & 0xF0u) == 0xE0u)
         {
@@ -76,43 +133,10 @@ std::u32string ToUtf32(const std::string& utf8Str)
             {
                 ThrowInvalidUtf8Sequence();
             }
-            char32_t u = static_cast<char32_t>(static_cast<uint32_t>(0u));
-            uint8_t b2 = static_cast<uint8_t>(p[2]);
-            if ((b2 & 0xC0u) != 0x80u)
-            {
-                ThrowInvalidUtf8Sequence();
-            }
-            uint8_t shift = 0u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b2 & 1u;
-                b2 = b2 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b1 = static_cast<uint8_t>(p[1]);
-            if ((b1 & 0xC0u) != 0x80u)
-            {
-                ThrowInvalidUtf8Sequence();
-            }
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b1 & 1u;
-                b1 = b1 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b0 = x;
-            for (uint8_t i = 0u; i < 4u; ++i)
-            {
-                uint8_t bit = b0 & 1u;
-                b0 = b0 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            result.append(1, u);
-            bytesRemaining = bytesRemaining - 3;
-            p = p + 3;
+            uint32_t b2 = Utf8ContinuationByte(p + 2);
+            uint32_t b1 = Utf8ContinuationByte(p + 1);
+            *out++ = static_cast<char32_t>(((x & 0x0Fu) << 12) | (b1 << 6) | b2);
+            p += 3;
         }
         else if ((x & 0xF8u) == 0xF0u)
         {
@@ -120,146 +144,132 @@ std::u32string ToUtf32(const std::string& utf8Str)
             {
                 ThrowInvalidUtf8Sequence();
             }
-            char32_t u = static_cast<char32_t>(static_cast<uint32_t>(0u));
-            uint8_t b3 = static_cast<uint8_t>(p[3]);
-            if ((b3 & 0xC0u) != 0x80u)
-            {
-                ThrowInvalidUtf8Sequence();
-            }
-            uint8_t shift = 0u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b3 & 1u;
-                b3 = b3 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b2 = static_cast<uint8_t>(p[2]);
-            if ((b2 & 0xC0u) != 0x80u)
-            {
-                ThrowInvalidUtf8Sequence();
-            }
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b2 & 1u;
-                b2 = b2 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b1 = static_cast<uint8_t>(p[1]);
-            if ((b1 & 0xC0u) != 0x80u)
-            {
-                ThrowInvalidUtf8Sequence();
-            }
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b1 & 1u;
-                b1 = b1 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b0 = x;
-            for (uint8_t i = 0u; i < 3u; ++i)
-            {
-                uint8_t bit = b0 & 1u;
-                b0 = b0 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            result.append(1, u);
-            bytesRemaining = bytesRemaining - 4;
-            p = p + 4;
+            uint32_t b3 = Utf8ContinuationByte(p + 3);
+            uint32_t b2 = Utf8ContinuationByte(p + 2);
+            uint32_t b1 = Utf8ContinuationByte(p + 1);
+            *out++ = static_cast<char32_t>(((x & 0x07u) << 18) | (b1 << 12) | (b2 << 6) | b3);
+            p += 4;
         }
         else
         {
             ThrowInvalidUtf8Sequence();
         }
     }
+    result.resize(out - result.data());
     return result;
 }
 
+inline std::size_t NonSurrogatePrefixLength(const char16_t* p, std::size_t n)
+{
+    std::size_t i = 0;
+#ifdef UTIL_UNICODE_SSE2
+    __m128i surrogateMask = _mm_set1_epi16(static_cast<short>(0xF800));
+    __m128i surrogateBits = _mm_set1_epi16(static_cast<short>(0xD800));
+    while (i + 8 <= n)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(v, surrogateMask), surrogateBits);
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(surrogates));
+        if (mask != 0)
+        {
+            return i + std::countr_zero(mask) / 2;
+        }
+        i += 8;
+    }
+#endif
+    while (i < n && (static_cast<uint16_t>(p[i]) & 0xF800u) != 0xD800u)
+    {
+        ++i;
+    }
+    return i;
+}
+
+inline void WidenUtf16(const char16_t* p, std::size_t n, char32_t* out)
+{
+    std::size_t i = 0;
+#ifdef UTIL_UNICODE_SSE2
+    __m128i zero = _mm_setzero_si128();
+    while (i + 8 <= n)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi16(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), _mm_unpackhi_epi16(v, zero));
+        i += 8;
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        out[i] = static_cast<char32_t>(p[i]);
+    }
+}
+
 std::u32string ToUtf32(const std::u16string& utf16Str)
 {
     std::u32string result;
-    const char16_t* w = utf16Str.c_str();
-    int remaining = int(utf16Str.length());
-    while (remaining > 0)
+    result.resize(utf16Str.length());
+    char32_t* out = result.data();
+    const char16_t* w = utf16Str.data();
+    const char16_t* end = w + utf16Str.length();
+    while (w != end)
     {
-        char16_t w1 = *w++;
-        --remaining;
-        if (static_cast<uint16_t>(w1) < 0xD800u || static_cast<uint16_t>(w1) > 0xDFFFu)
+        std::size_t n = NonSurrogatePrefixLength(w, end - w);
+        WidenUtf16(w, n, out);
+        w += n;
+        out += n;
+        if (w == end) break;
+        uint32_t w1 = static_cast<uint16_t>(*w++);
+        if (w1 > 0xDBFFu || w == end)
         {
-            result.append(1, w1);
+            ThrowUnicodeException("invalid UTF-16 sequence");
         }
-        else
+        uint32_t w2 = static_cast<uint16_t>(*w++);
+        if (w2 < 0xDC00u || w2 > 0xDFFFu)
         {
-            if (static_cast<uint16_t>(w1) < 0xD800u || static_cast<uint16_t>(w1) > 0xDBFFu)
-            {
-                ThrowUnicodeException("invalid UTF-16 sequence");
-            }
-            if (remaining > 0)
-            {
-                char16_t w2 = *w++;
-                --remaining;
-                if (static_cast<uint16_t>(w2) < 0xDC00u || static_cast<uint16_t>(w2) > 0xDFFFu)
-                {
-                    ThrowUnicodeException("invalid UTF-16 sequence");
-                }
-                else
-                {
-                    char32_t uprime = static_cast<char32_t>(((0x03FFu & static_cast<uint32_t>(w1)) << 10u) | (0x03FFu & static_cast<uint32_t>(w2)));
-                    char32_t u = static_cast<char32_t>(static_cast<uint32_t>(uprime) + 0x10000u);
-                    result.append(1, u);
-                }
-            }
-            else
-            {
-                ThrowUnicodeException("invalid UTF-16 sequence");
-            }
+            ThrowUnicodeException("invalid UTF-16 sequence");
         }
+        *out++ = static_cast<char32_t>((((w1 & 0x03FFu) << 10) | (w2 & 0x03FFu)) + 0x10000u);
     }
+    result.resize(out - result.data());
     return result;
 }
 
 std::u16string ToUtf16(const std::u32string& utf32Str)
 {
+    std::size_t length = utf32Str.length();
+    for (char32_t u : utf32Str)
+    {
+        length += static_cast<uint32_t>(u) >= 0x10000u;
+    }
     std::u16string result;
+    result.resize(length);
+    char16_t* out = result.data();
     for (char32_t u : utf32Str)
     {
-        if (static_cast<uint32_t>(u) > 0x10FFFFu)
+        uint32_t x = static_cast<uint32_t>(u);
+        if (x < 0xD800u)
         {
-            ThrowUnicodeException("invalid UTF-32 code point");
+            *out++ = static_cast<char16_t>(x);
         }
-        if (static_cast<uint32_t>(u) < 0x10000u)
+        else if (x < 0x10000u)
         {
-            if (static_cast<uint32_t>(u) >= 0xD800 && static_cast<uint32_t>(u) <= 0xDFFF)
+            if (x <= 0xDFFFu)
             {
                 ThrowUnicodeException("invalid UTF-32 code point (reserved for UTF-16)");
             }
-            char16_t x = static_cast<char16_t>(u);
-            result.append(1, x);
+            *out++ = static_cast<char16_t>(x);
+        }
+        else if (x <= 0x10FFFFu)
+        {
+            uint32_t uprime = x - 0x10000u;
+            *out++ = static_cast<char16_t>(0xD800u | (uprime >> 10));
+            *out++ = static_cast<char16_t>(0xDC00u | (uprime & 0x03FFu));
         }
         else
         {
-            char32_t uprime = static_cast<char32_t>(static_cast<uint32_t>(u) - 0x10000u);
-            char16_t w1 = static_cast<char16_t>(0xD800u);
-            char16_t w2 = static_cast<char16_t>(0xDC00u);
-            for (uint16_t i = 0u; i < 10u; ++i)
-            {
-                uint16_t bit = static_cast<uint16_t>(static_cast<uint32_t>(uprime) & (static_cast<uint32_t>(0x1u) << i));
-                w2 = static_cast<char16_t>(static_cast<uint16_t>(w2) | bit);
-            }
-            for (uint16_t i = 10u; i < 20u; ++i)
-            {
-                uint16_t bit = static_cast<uint16_t>((static_cast<uint32_t>(uprime) & (static_cast<uint32_t>(0x1u) << i)) >> 10u);
-                w1 = static_cast<char16_t>(static_cast<uint16_t>(w1) | bit);
-            }
-            result.append(1, w1);
-            result.append(1, w2);
+            ThrowUnicodeException("invalid UTF-32 code point");
         }
     }
     return result;
-
 }
 
 std::u16string ToUtf16(const std::string& utf8Str)
@@ -267,87 +277,77 @@ std::u16string ToUtf16(const std::string& utf8Str)
     return ToUtf16(ToUtf32(utf8Str));
 }
 
+inline std::size_t NarrowAscii(const char32_t* p, std::size_t n, char* out)
+{
+    std::size_t i = 0;
+#ifdef UTIL_UNICODE_SSE2
+    __m128i nonAscii = _mm_set1_epi32(static_cast<int>(0xFFFFFF80u));
+    while (i + 16 <= n)
+    {
+        __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 4));
+        __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 8));
+        __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 12));
+        __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3)), nonAscii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, _mm_setzero_si128())) != 0xFFFF)
+        {
+            break;
+        }
+        __m128i w0 = _mm_packs_epi32(v0, v1);
+        __m128i w1 = _mm_packs_epi32(v2, v3);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(w0, w1));
+        i += 16;
+    }
+#endif
+    while (i < n && static_cast<uint32_t>(p[i]) < 0x80u)
+    {
+        out[i] = static_cast<char>(p[i]);
+        ++i;
+    }
+    return i;
+}
+
 std::string ToUtf8(const std::u32string& utf32Str)
 {
-    std::string result;
+    std::size_t length = utf32Str.length();
     for (char32_t c : utf32Str)
     {
         uint32_t x = static_cast<uint32_t>(c);
+        length += (x >= 0x80u) + (x >= 0x800u) + (x >= 0x10000u);
+    }
+    std::string result;
+    result.resize(length);
+    char* out = result.data();
+    const char32_t* p = utf32Str.data();
+    const char32_t* end = p + utf32Str.length();
+    while (p != end)
+    {
+        std::size_t ascii = NarrowAscii(p, end - p, out);
+        p += ascii;
+        out += ascii;
+        if (p == end) break;
+        uint32_t x = static_cast<uint32_t>(*p++);
         if (x < 0x80u)
         {
-            result.append(1, static_cast<char>(x & 0x7Fu));
+            *out++ = static_cast<char>(x);
         }
         else if (x < 0x800u)
         {
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b0 = 0xC0u;
-            for (uint8_t i = 0u; i < 5u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char8_t>(b0));
-            result.append(1, static_cast<char8_t>(b1));
+            *out++ = static_cast<char>(0xC0u | (x >> 6));
+            *out++ = static_cast<char>(0x80u | (x & 0x3Fu));
         }
         else if (x < 0x10000u)
         {
-            uint8_t b2 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b2 = b2 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b0 = 0xE0u;
-            for (uint8_t i = 0u; i < 4u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char8_t>(b0));
-            result.append(1, static_cast<char8_t>(b1));
-            result.append(1, static_cast<char8_t>(b2));
+            *out++ = static_cast<char>(0xE0u | (x >> 12));
+            *out++ = static_cast<char>(0x80u | ((x >> 6) & 0x3Fu));
+            *out++ = static_cast<char>(0x80u | (x & 0x3Fu));
         }
         else if (x < 0x110000u)
         {
-            uint8_t b3 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b3 = b3 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b2 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b2 = b2 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b0 = 0xF0u;
-            for (uint8_t i = 0u; i < 3u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char8_t>(b0));
-            result.append(1, static_cast<char8_t>(b1));
-            result.append(1, static_cast<char8_t>(b2));
-            result.append(1, static_cast<char8_t>(b3));
+            *out++ = static_cast<char>(0xF0u | (x >> 18));
+            *out++ = static_cast<char>(0x80u | ((x >> 12) & 0x3Fu));
+            *out++ = static_cast<char>(0x80u | ((x >> 6) & 0x3Fu));
+            *out++ = static_cast<char>(0x80u | (x & 0x3Fu));
         }
         else
         {
@@ -357,6 +357,37 @@ std::string ToUtf8(const std::u32string& utf32Str)
     return result;
 }
 
+void AppendUtf8(std::string& utf8Str, char32_t c)
+{
+    uint32_t x = static_cast<uint32_t>(c);
+    if (x < 0x80u)
+    {
+        utf8Str.append(1, static_cast<char>(x));
+    }
+    else if (x < 0x800u)
+    {
+        utf8Str.append(1, static_cast<char>(0xC0u | (x >> 6)));
+        utf8Str.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
+    }
+    else if (x < 0x10000u)
+    {
+        utf8Str.append(1, static_cast<char>(0xE0u | (x >> 12)));
+        utf8Str.append(1, static_cast<char>(0x80u | ((x >> 6) & 0x3Fu)));
+        utf8Str.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
+    }
+    else if (x < 0x110000u)
+    {
+        utf8Str.append(1, static_cast<char>(0xF0u | (x >> 18)));
+        utf8Str.append(1, static_cast<char>(0x80u | ((x >> 12) & 0x3Fu)));
+        utf8Str.append(1, static_cast<char>(0x80u | ((x >> 6) & 0x3Fu)));
+        utf8Str.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
+    }
+    else
+    {
+        ThrowUnicodeException("invalid UTF-32 code point");
+    }
+}
+
 std::string ToUtf8(const std::u16string& utf16Str)
 {
     return ToUtf8(ToUtf32(utf16Str));
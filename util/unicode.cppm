@@ -29,6 +29,7 @@ std::u16string ToUtf16(const std::string& u8str);
 std::string ToUtf8(const std::u32string& utf32Str);
 std::string ToUtf8(const std::u16string& utf16Str);
 std::string ToUtf8(const std::string& utf8Str) { return utf8Str; }
+void AppendUtf8(std::string& utf8Str, char32_t c);
 
 class Utf8ToUtf32Engine
 {